@@ -0,0 +1,42 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace jogasaki::api::kvsservice {
+
+/**
+ * @brief the end point kind of the scan range
+ */
+enum class scan_bound : std::uint32_t {
+    /**
+     * @brief unbound scan (the end point key is ignored).
+     */
+    unbound = 0,
+
+    /**
+     * @brief contains records on the key.
+     */
+    inclusive = 1,
+
+    /**
+     * @brief does not contain records on the key.
+     */
+    exclusive = 2,
+};
+
+}
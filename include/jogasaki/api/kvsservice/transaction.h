@@ -15,12 +15,17 @@
  */
 #pragma once
 
+#include <functional>
 #include <future>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <cstddef>
 #include <cstdint>
+#include <string>
 #include <string_view>
 
+#include <google/protobuf/repeated_field.h>
 #include <tateyama/proto/kvs/data.pb.h>
 #include <tateyama/proto/kvs/response.pb.h>
 #include <sharksfin/api.h>
@@ -31,6 +36,7 @@
 #include "index.h"
 #include "put_option.h"
 #include "remove_option.h"
+#include "scan_bound.h"
 #include "status.h"
 #include "transaction_state.h"
 
@@ -38,13 +44,25 @@ namespace jogasaki::api::impl {
 class database;
 }
 
+namespace yugawara::storage {
+class table;
+}
+
 namespace jogasaki::api::kvsservice {
 
+class secondary_index_writer;
+
 /**
  * @brief a transaction of KVS database
  */
 class alignas(64) transaction {
 public:
+    /**
+     * @brief the consumer of the records read by scan()
+     * @details the consumer may move the content out of the record. Returning other than status::ok stops the scan
+     * and the status is returned from scan().
+     */
+    using scan_consumer = std::function<status(tateyama::proto::kvs::data::Record&)>;
 
     /**
      * @brief create new object
@@ -60,8 +78,9 @@ public:
 
     /**
      * @brief destructor the object
+     * @details the storage handles cached by this object are disposed
      */
-    ~transaction() = default;
+    ~transaction();
 
     /**
      * @brief retrieves the system_id of this transaction
@@ -128,6 +147,25 @@ public:
     [[nodiscard]] status put(std::string_view table_name, tateyama::proto::kvs::data::Record const &record,
                              put_option opt = put_option::create_or_update);
 
+    /**
+     * @brief put the records to the table
+     * @details each record is put in the same way as put() for single record. The records skipped by the option
+     * (status::already_exists for put_option::create, or status::not_found for put_option::update) are not counted
+     * and don't stop the batch.
+     * If a record fails with other error, the transaction is aborted so that the records put before the failure
+     * are not committed partially, and the error is returned.
+     * @param table_name the full qualified name of the table
+     * @param records the records to be put
+     * @param opt option to set put mode
+     * @param written [out] the number of the records actually written
+     * @return status::ok if all records were processed
+     * @return otherwise if error was occurred, and then the transaction is aborted
+     */
+    [[nodiscard]] status put(std::string_view table_name,
+                             google::protobuf::RepeatedPtrField<tateyama::proto::kvs::data::Record> const &records,
+                             put_option opt,
+                             std::size_t &written);
+
     /**
      * @brief get the record for the given primary key
      * @param table_name the full qualified name of the table
@@ -147,6 +185,19 @@ public:
     [[nodiscard]] status get(std::string_view table_name, tateyama::proto::kvs::data::Record const &primary_key,
                              tateyama::proto::kvs::data::Record &record);
 
+    /**
+     * @brief get the records for the given primary keys
+     * @details the keys whose records are not found are omitted from the result.
+     * @param table_name the full qualified name of the table
+     * @param primary_keys the primary keys for searching
+     * @param records [out] the records found, in the order of the keys
+     * @return status::ok if all keys were processed
+     * @return otherwise if error was occurred
+     */
+    [[nodiscard]] status get(std::string_view table_name,
+                             google::protobuf::RepeatedPtrField<tateyama::proto::kvs::data::Record> const &primary_keys,
+                             google::protobuf::RepeatedPtrField<tateyama::proto::kvs::data::Record> &records);
+
     /**
      * @brief remove the record for the given primary key
      * @param table_name the full qualified name of the table
@@ -166,6 +217,53 @@ public:
                                 tateyama::proto::kvs::data::Record const &primary_key,
                                 remove_option opt = remove_option::counting);
 
+    /**
+     * @brief remove the records for the given primary keys
+     * @details each record is removed in the same way as remove() for single record. The keys whose records are not
+     * found are not counted and don't stop the batch.
+     * If a key fails with other error, the transaction is aborted so that the records removed before the failure
+     * are not committed partially, and the error is returned.
+     * @param table_name the full qualified name of the table
+     * @param primary_keys the keys for searching
+     * @param opt option to set remove mode
+     * @param removed [out] the number of the records actually removed
+     * @return status::ok if all keys were processed
+     * @return otherwise if error was occurred, and then the transaction is aborted
+     */
+    [[nodiscard]] status remove(std::string_view table_name,
+                                google::protobuf::RepeatedPtrField<tateyama::proto::kvs::data::Record> const &primary_keys,
+                                remove_option opt,
+                                std::size_t &removed);
+
+    /**
+     * @brief scan the records in the primary key range
+     * @param table_name the full qualified name of the table
+     * @param lower_key the lower end point key. It should contain the leading columns of the primary key,
+     * and is ignored if lower_bound is scan_bound::unbound.
+     * @param lower_bound the lower end point kind
+     * @param upper_key the upper end point key. It should contain the leading columns of the primary key,
+     * and is ignored if upper_bound is scan_bound::unbound.
+     * @param upper_bound the upper end point kind
+     * @param consumer the consumer called for each record in the range, in the key order.
+     * The record contains all columns of the table and the order of each column is undefined.
+     * Unlike other operations, this function acquires transaction_mutex() by itself only while reading the entries,
+     * and the consumer is called without it so that slow consumers don't block other requests on the transaction.
+     * The caller must not hold transaction_mutex().
+     * @param reverse whether the records are read from tail to head
+     * @return status::ok if the scan completed
+     * @return status::err_inactive_transaction if the transaction is inactive and the request is rejected
+     * @return status::err_invalid_argument if the end point key isn't a leading part of the primary key
+     * @return the status returned by the consumer if it stopped the scan
+     * @return otherwise if error was occurred
+     */
+    [[nodiscard]] status scan(std::string_view table_name,
+                              tateyama::proto::kvs::data::Record const &lower_key,
+                              scan_bound lower_bound,
+                              tateyama::proto::kvs::data::Record const &upper_key,
+                              scan_bound upper_bound,
+                              scan_consumer const &consumer,
+                              bool reverse = false);
+
     /**
      * @brief set error information
      * @see get_error_info()
@@ -189,6 +287,18 @@ public:
     [[nodiscard]] status dispose();
 
 private:
+    /**
+     * @brief the table resolved by this transaction
+     * @details the table schema and the storage handle are kept until the transaction is destroyed, so that
+     * the operations on the same table don't resolve them again.
+     */
+    struct table_entry {
+        std::shared_ptr<yugawara::storage::table const> table_{};
+        sharksfin::StorageHandle storage_{};
+        bool has_secondary_index_{};
+        std::shared_ptr<secondary_index_writer> secondaries_{};
+    };
+
     jogasaki::api::impl::database *db_{};
     sharksfin::DatabaseHandle db_handle_{};
     sharksfin::TransactionControlHandle ctrl_handle_{};
@@ -201,7 +311,15 @@ private:
     // commit/abort called flag, locked by mtx_tx_
     bool commit_abort_called_{};
 
+    // the cached tables and the encoding buffers reused by the operations, locked by mtx_tx_
+    std::map<std::string, table_entry, std::less<>> tables_{};
+    std::string key_buffer_{};
+    std::string value_buffer_{};
+    std::string old_value_buffer_{};
+
     status is_active() const noexcept;
-    status get_storage(std::string_view name, sharksfin::StorageHandle &storage);
+    status find_table(std::string_view name, table_entry*& entry);
+    status put_with_secondaries(table_entry& entry, std::string_view key, std::string_view value, put_option opt);
+    status remove_with_secondaries(table_entry& entry, std::string_view key, remove_option opt);
 };
 }
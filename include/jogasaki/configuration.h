@@ -499,6 +499,30 @@ public:
         key_distribution_ = arg;
     }
 
+    [[nodiscard]] std::size_t key_distribution_sample_count() const noexcept {
+        return key_distribution_sample_count_;
+    }
+
+    void key_distribution_sample_count(std::size_t arg) noexcept {
+        key_distribution_sample_count_ = arg;
+    }
+
+    [[nodiscard]] std::size_t key_distribution_max_scan_entries() const noexcept {
+        return key_distribution_max_scan_entries_;
+    }
+
+    void key_distribution_max_scan_entries(std::size_t arg) noexcept {
+        key_distribution_max_scan_entries_ = arg;
+    }
+
+    [[nodiscard]] std::size_t key_distribution_refresh_interval_ms() const noexcept {
+        return key_distribution_refresh_interval_ms_;
+    }
+
+    void key_distribution_refresh_interval_ms(std::size_t arg) noexcept {
+        key_distribution_refresh_interval_ms_ = arg;
+    }
+
     [[nodiscard]] bool mock_datastore() const noexcept {
         return mock_datastore_;
     }
@@ -635,6 +659,102 @@ public:
         udf_client_timeout_ = arg;
     }
 
+    [[nodiscard]] std::size_t exchange_spill_threshold() const noexcept {
+        return exchange_spill_threshold_;
+    }
+
+    void exchange_spill_threshold(std::size_t arg) noexcept {
+        exchange_spill_threshold_ = arg;
+    }
+
+    [[nodiscard]] std::size_t exchange_spill_memory_percentage() const noexcept {
+        return exchange_spill_memory_percentage_;
+    }
+
+    void exchange_spill_memory_percentage(std::size_t arg) noexcept {
+        exchange_spill_memory_percentage_ = arg;
+    }
+
+    [[nodiscard]] std::string_view spill_directory() const noexcept {
+        return spill_directory_;
+    }
+
+    void spill_directory(std::string_view arg) noexcept {
+        spill_directory_ = arg;
+    }
+
+    [[nodiscard]] std::size_t memory_limit() const noexcept {
+        return memory_limit_;
+    }
+
+    void memory_limit(std::size_t arg) noexcept {
+        memory_limit_ = arg;
+    }
+
+    [[nodiscard]] std::size_t request_memory_limit() const noexcept {
+        return request_memory_limit_;
+    }
+
+    void request_memory_limit(std::size_t arg) noexcept {
+        request_memory_limit_ = arg;
+    }
+
+    [[nodiscard]] std::size_t memory_admission_percentage() const noexcept {
+        return memory_admission_percentage_;
+    }
+
+    void memory_admission_percentage(std::size_t arg) noexcept {
+        memory_admission_percentage_ = arg;
+    }
+
+    [[nodiscard]] bool direct_load() const noexcept {
+        return direct_load_;
+    }
+
+    void direct_load(bool arg) noexcept {
+        direct_load_ = arg;
+    }
+
+    [[nodiscard]] std::size_t join_find_probe_cache_size() const noexcept {
+        return join_find_probe_cache_size_;
+    }
+
+    void join_find_probe_cache_size(std::size_t arg) noexcept {
+        join_find_probe_cache_size_ = arg;
+    }
+
+    [[nodiscard]] bool enable_broadcast_join() const noexcept {
+        return enable_broadcast_join_;
+    }
+
+    void enable_broadcast_join(bool arg) noexcept {
+        enable_broadcast_join_ = arg;
+    }
+
+    [[nodiscard]] bool enable_scan_range_split() const noexcept {
+        return enable_scan_range_split_;
+    }
+
+    void enable_scan_range_split(bool arg) noexcept {
+        enable_scan_range_split_ = arg;
+    }
+
+    [[nodiscard]] std::size_t sequence_cache_size() const noexcept {
+        return sequence_cache_size_;
+    }
+
+    void sequence_cache_size(std::size_t arg) noexcept {
+        sequence_cache_size_ = arg;
+    }
+
+    [[nodiscard]] std::size_t prepared_statement_cache_size() const noexcept {
+        return prepared_statement_cache_size_;
+    }
+
+    void prepared_statement_cache_size(std::size_t arg) noexcept {
+        prepared_statement_cache_size_ = arg;
+    }
+
     friend inline std::ostream& operator<<(std::ostream& out, configuration const& cfg) {
 
         //NOLINTBEGIN
@@ -692,6 +812,9 @@ public:
         print_non_default(inplace_dag_schedule);
         print_non_default(enable_join_scan);
         print_non_default(key_distribution);
+        print_non_default(key_distribution_sample_count);
+        print_non_default(key_distribution_max_scan_entries);
+        print_non_default(key_distribution_refresh_interval_ms);
         print_non_default(mock_datastore);
         print_non_default(enable_blob_cast);
         print_non_default(max_result_set_writers);
@@ -709,6 +832,18 @@ public:
         print_non_default(udf_pass_mock_tag);
         print_non_default(apply_max_polls);
         print_non_default(udf_client_timeout);
+        print_non_default(exchange_spill_threshold);
+        print_non_default(exchange_spill_memory_percentage);
+        print_non_default(spill_directory);
+        print_non_default(memory_limit);
+        print_non_default(request_memory_limit);
+        print_non_default(memory_admission_percentage);
+        print_non_default(direct_load);
+        print_non_default(join_find_probe_cache_size);
+        print_non_default(enable_broadcast_join);
+        print_non_default(enable_scan_range_split);
+        print_non_default(sequence_cache_size);
+        print_non_default(prepared_statement_cache_size);
 
         if(cfg.req_cancel_config()) {
             out << "req_cancel_config:" << *cfg.req_cancel_config() << " "; \
@@ -770,6 +905,9 @@ private:
     bool inplace_dag_schedule_ = true;
     bool enable_join_scan_ = true;
     key_distribution_kind key_distribution_{key_distribution_kind::uniform};
+    std::size_t key_distribution_sample_count_ = 1024;
+    std::size_t key_distribution_max_scan_entries_ = 1000000;
+    std::size_t key_distribution_refresh_interval_ms_ = 600000;
     bool mock_datastore_ = false;
     bool enable_blob_cast_ = true;
     std::size_t max_result_set_writers_ = 64;
@@ -787,6 +925,18 @@ private:
     bool udf_pass_mock_tag_ = false;
     std::size_t apply_max_polls_ = 0;
     std::size_t udf_client_timeout_ = 0;
+    std::size_t exchange_spill_threshold_ = 0;
+    std::size_t exchange_spill_memory_percentage_ = 80;
+    std::string spill_directory_{};
+    std::size_t memory_limit_ = 0;
+    std::size_t request_memory_limit_ = 0;
+    std::size_t memory_admission_percentage_ = 90;
+    bool direct_load_ = false;
+    std::size_t join_find_probe_cache_size_ = 1024;
+    bool enable_broadcast_join_ = false;
+    bool enable_scan_range_split_ = false;
+    std::size_t sequence_cache_size_ = 1;
+    std::size_t prepared_statement_cache_size_ = 0;
 };
 
 }  // namespace jogasaki
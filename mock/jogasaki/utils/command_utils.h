@@ -323,6 +323,23 @@ inline std::tuple<bool, error, std::shared_ptr<request_statistics>> decode_execu
     return {true, {}, make_stats(er.success())};
 }
 
+inline std::tuple<bool, error, std::shared_ptr<request_statistics>, std::vector<std::shared_ptr<request_statistics>>>
+decode_batch_result(std::string_view res) {
+    auto [success, err, stats] = decode_execute_result(res);
+    if(! success) {
+        return {false, err, {}, {}};
+    }
+    sql::response::Response resp{};
+    deserialize(res, resp);
+    std::vector<std::shared_ptr<request_statistics>> entries{};
+    for(auto&& e : resp.execute_result().success().batch_entries()) {
+        ::jogasaki::proto::sql::response::ExecuteResult::Success s{};
+        *s.mutable_counters() = e.counters();
+        entries.emplace_back(make_stats(s));
+    }
+    return {true, {}, std::move(stats), std::move(entries)};
+}
+
 inline std::string encode_dispose_prepare(std::uint64_t handle) {
     sql::request::Request r{};
     r.mutable_dispose_prepared_statement()->mutable_prepared_statement_handle()->set_handle(handle);
@@ -562,6 +579,23 @@ std::string encode_execute_load(api::transaction_handle tx_handle, std::uint64_t
     return encode_execute_prepared_statement_or_query<sql::request::ExecuteLoad>(tx_handle, stmt_handle, parameters, args...);
 }
 
+inline std::string encode_batch(
+    api::transaction_handle tx_handle,
+    std::uint64_t stmt_handle,
+    std::vector<std::vector<parameter>> const& parameter_sets
+) {
+    sql::request::Request r{};
+    auto* bt = r.mutable_batch();
+    bt->mutable_transaction_handle()->set_handle(tx_handle.surrogate_id());
+    bt->mutable_prepared_statement_handle()->set_handle(stmt_handle);
+    for(auto&& parameters : parameter_sets) {
+        fill_parameters(parameters, bt->add_parameter_sets()->mutable_elements());
+    }
+    auto s = serialize(r);
+    r.clear_batch();
+    return s;
+}
+
 inline std::string encode_explain(std::uint64_t stmt_handle, std::vector<parameter> const& parameters) {
     sql::request::Request r{};
     auto* explain = r.mutable_explain();
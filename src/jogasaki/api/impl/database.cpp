@@ -37,6 +37,8 @@
 
 #include <takatori/serializer/json_printer.h>
 #include <takatori/serializer/object_scanner.h>
+#include <takatori/statement/statement.h>
+#include <takatori/statement/statement_kind.h>
 #include <takatori/type/blob.h>
 #include <takatori/type/character.h>
 #include <takatori/type/clob.h>
@@ -78,6 +80,7 @@
 #include <jogasaki/commit_response.h>
 #include <jogasaki/configuration.h>
 #include <jogasaki/constants.h>
+#include <jogasaki/dist/key_histogram_store.h>
 #include <jogasaki/durability_callback.h>
 #include <jogasaki/durability_manager.h>
 #include <jogasaki/error/error_info_factory.h>
@@ -104,6 +107,7 @@
 #include <jogasaki/logging.h>
 #include <jogasaki/logging_helper.h>
 #include <jogasaki/memory/lifo_paged_memory_resource.h>
+#include <jogasaki/memory/memory_tracker.h>
 #include <jogasaki/memory/page_pool.h>
 #include <jogasaki/model/task.h>
 #include <jogasaki/plan/compiler.h>
@@ -165,6 +169,7 @@ std::shared_ptr<kvs::database> const& database::kvs_db() const noexcept {
 
 void database::reset_tables() {
     tables_ = std::make_shared<yugawara::storage::configurable_provider>();
+    statement_cache_ = std::make_unique<plan::prepared_statement_cache>(cfg_->prepared_statement_cache_size());
 }
 
 std::shared_ptr<yugawara::storage::configurable_provider> const& database::tables() const noexcept {
@@ -209,6 +214,9 @@ static void dump_public_configurations(configuration const& cfg) {
     LOGCFG << "(dev_inplace_teardown) " << cfg.inplace_teardown() << " : whether to process teardown (job completion) directly on the current thread instead of scheduling a task for it";
     LOGCFG << "(enable_join_scan) " << cfg.enable_join_scan() << " : whether to enable index join using join_scan operator";
     LOGCFG << "(dev_rtx_key_distribution) " << cfg.key_distribution() << " : key distribution policy used for RTX parallel scan";
+    LOGCFG << "(dev_rtx_key_distribution_sample_count) " << cfg.key_distribution_sample_count() << " : number of keys sampled to build the histogram for sampling key distribution";
+    LOGCFG << "(dev_rtx_key_distribution_max_scan_entries) " << cfg.key_distribution_max_scan_entries() << " : max number of entries visited to build the histogram for sampling key distribution, over which uniform key distribution is used instead (0 means unlimited)";
+    LOGCFG << "(dev_rtx_key_distribution_refresh_interval_ms) " << cfg.key_distribution_refresh_interval_ms() << " : interval in milliseconds to rebuild the histogram for sampling key distribution";
     LOGCFG << "(dev_enable_blob_cast) " << cfg.enable_blob_cast() << " : whether to enable cast expression to/from blob/clob data";
     LOGCFG << "(max_result_set_writers) " << cfg.max_result_set_writers() << " : max number of result set writers";
     LOGCFG << "(dev_core_affinity) " << cfg.core_affinity() << " : whether to assign cores to worker threads";
@@ -225,6 +233,18 @@ static void dump_public_configurations(configuration const& cfg) {
     LOGCFG << "(dev_enable_maintenance_thread) " << cfg.enable_maintenance_thread() << " : whether to start the maintenance background thread";
     LOGCFG << "(dev_maintenance_interval_ms) " << cfg.maintenance_interval_ms() << " : interval (ms) between maintenance thread activations";
     LOGCFG << "(dev_enable_truncate) " << cfg.enable_truncate() << " : whether to enable TRUNCATE TABLE statement";
+    LOGCFG << "(dev_exchange_spill_threshold) " << cfg.exchange_spill_threshold() << " : max bytes of records held in memory by a group/aggregate exchange input partition before spilling sorted runs to files (0 disables spilling)";
+    LOGCFG << "(dev_exchange_spill_memory_percentage) " << cfg.exchange_spill_memory_percentage() << " : percentage of the request or engine memory limit over which group/aggregate exchange input partitions spill their records on flush even below dev_exchange_spill_threshold";
+    LOGCFG << "(dev_spill_directory) " << cfg.spill_directory() << " : directory to create spill files (system temporary directory if empty)";
+    LOGCFG << "(dev_memory_limit) " << cfg.memory_limit() << " : max bytes of pages held by the SQL engine memory resources (0 means unlimited)";
+    LOGCFG << "(dev_request_memory_limit) " << cfg.request_memory_limit() << " : max bytes of pages held by the memory resources of a request (0 means unlimited)";
+    LOGCFG << "(dev_memory_admission_percentage) " << cfg.memory_admission_percentage() << " : percentage of dev_memory_limit over which new statements are rejected";
+    LOGCFG << "(dev_direct_load) " << cfg.direct_load() << " : whether load writes the records of INSERT statement directly without executing statement for each record";
+    LOGCFG << "(dev_join_find_probe_cache_size) " << cfg.join_find_probe_cache_size() << " : max number of primary index entries cached by join_find operator to answer repeated probes (0 disables the cache)";
+    LOGCFG << "(dev_enable_broadcast_join) " << cfg.enable_broadcast_join() << " : whether to enable join with broadcast exchange, whose records are probed by hash table";
+    LOGCFG << "(dev_enable_scan_range_split) " << cfg.enable_scan_range_split() << " : whether parallel scan tasks split their unscanned ranges at yield points and hand them to the tasks finished early";
+    LOGCFG << "(dev_prepared_statement_cache_size) " << cfg.prepared_statement_cache_size() << " : max number of compiled statements shared across sessions preparing the same SQL (0 disables sharing)";
+    LOGCFG << "(dev_sequence_cache_size) " << cfg.sequence_cache_size() << " : number of sequence values each worker thread reserves at once (1 disables caching)";
 }
 
 static bool validate_core_assignment_parameters(configuration const& cfg) {
@@ -424,7 +444,9 @@ database::database() : database(std::make_shared<class configuration>()) {}
 
 bool database::init() {
     global::storage_manager()->clear(); // clean up global objects first
+    global::key_histogram_store().clear();
     global::config_pool(cfg_);
+    global::memory_tracker()->limit(cfg_->memory_limit());
     if(initialized_) {
         return true;
     }
@@ -518,12 +540,25 @@ status database::prepare_common(
     std::shared_ptr<yugawara::variable::configurable_provider> provider,
     std::unique_ptr<impl::prepared_statement>& statement,
     std::shared_ptr<error::error_info>& out,
-    plan::compile_option const& option
+    plan::compile_option const& option,
+    plan::prepared_statement_cache::key_type const* cache_key
 ) {
     auto req = std::make_shared<scheduler::request_detail>(scheduler::request_detail_kind::prepare);
     req->statement_text(std::make_shared<std::string>(sql)); //TODO want to use shared_ptr created in plan::prepare
     req->status(scheduler::request_detail_status::accepted);
     log_request(*req);
+    auto& cache = *statement_cache_;
+    bool use_cache = cache_key != nullptr && cache.enabled();
+    if(use_cache) {
+        if(auto cached = cache.find(*cache_key)) {
+            statement = std::make_unique<impl::prepared_statement>(std::move(cached));
+            req->status(scheduler::request_detail_status::finishing);
+            log_request(*req);
+            return status::ok;
+        }
+    }
+    // capture the version before compilation so that the statement compiled with stale schema is not cached
+    auto version = cache.version();
     auto resource = std::make_shared<memory::lifo_paged_memory_resource>(&global::page_pool());
     auto ctx = std::make_shared<plan::compiler_context>();
     ctx->resource(resource);
@@ -538,6 +573,13 @@ status database::prepare_common(
         out = ctx->error_info();
         return rc;
     }
+    if(use_cache) {
+        // DDL statements are not shared since their execution modifies the schema
+        auto k = ctx->prepared_statement()->statement()->kind();
+        if(k == takatori::statement::statement_kind::execute || k == takatori::statement::statement_kind::write) {
+            cache.put(*cache_key, ctx->prepared_statement(), version);
+        }
+    }
     statement = std::make_unique<impl::prepared_statement>(ctx->prepared_statement());
     req->status(scheduler::request_detail_status::finishing);
     log_request(*req);
@@ -549,10 +591,11 @@ status database::prepare_common(
     std::shared_ptr<yugawara::variable::configurable_provider> provider,
     statement_handle& statement,
     std::shared_ptr<error::error_info>& out,
-    plan::compile_option const& option
+    plan::compile_option const& option,
+    plan::prepared_statement_cache::key_type const* cache_key
 ) {
     std::unique_ptr<impl::prepared_statement> ptr{};
-    auto st = prepare_common(sql, std::move(provider), ptr, out, option);
+    auto st = prepare_common(sql, std::move(provider), ptr, out, option, cache_key);
     if (st == status::ok) {
         api::statement_handle handle{ptr.get(), option.session_id()};
         if (! handle.session_id().has_value()) {
@@ -590,7 +633,8 @@ status database::prepare(
     std::shared_ptr<error::error_info>& out,
     plan::compile_option const& option
 ) {
-    return prepare_common(sql, {}, statement, out, option);
+    auto key = plan::prepared_statement_cache::create_key(sql, {}, option);
+    return prepare_common(sql, {}, statement, out, option, std::addressof(key));
 }
 
 status database::prepare(
@@ -613,7 +657,8 @@ status database::prepare(
     for(auto&& [n, t] : variables) {
         add_variable(*host_variables, n, t);
     }
-    return prepare_common(sql, std::move(host_variables), statement, out, option);
+    auto key = plan::prepared_statement_cache::create_key(sql, variables, option);
+    return prepare_common(sql, std::move(host_variables), statement, out, option, std::addressof(key));
 }
 
 status database::create_executable(std::string_view sql, std::unique_ptr<api::executable_statement>& statement) {
@@ -628,7 +673,7 @@ status database::create_executable(
     plan::compile_option const& option
 ) {
     std::unique_ptr<impl::prepared_statement> prepared{};
-    if(auto rc = prepare_common(sql, {}, prepared, out, option); rc != status::ok) {
+    if(auto rc = prepare_common(sql, {}, prepared, out, option, nullptr); rc != status::ok) {
         return rc;
     }
     std::unique_ptr<api::executable_statement> exec{};
@@ -866,6 +911,10 @@ status database::resolve_common(
     return status::ok;
 }
 
+plan::prepared_statement_cache& database::statement_cache() noexcept {
+    return *statement_cache_;
+}
+
 status database::destroy_statement_internal(
     api::statement_handle prepared
 ) {
@@ -1037,6 +1086,7 @@ status database::do_create_table(std::shared_ptr<yugawara::storage::table> table
         VLOG_LP(log_error) << "table " << name << " already exists";
         return status::err_already_exists;
     }
+    statement_cache_->invalidate();
     // this api is deprecated, and left only for testing. no storage_key assigned
     auto id = storage::index_id_src++;
     if(! global::storage_manager()->add_entry(id, name, std::nullopt, true)) {
@@ -1060,6 +1110,7 @@ std::shared_ptr<yugawara::storage::table const> database::do_find_table(
 status database::do_drop_table(std::string_view name, std::string_view schema) {
     (void)schema;
     if(tables_->remove_relation(name)) {
+        statement_cache_->invalidate();
         return status::ok;
     }
     return status::not_found;
@@ -1146,6 +1197,7 @@ status database::do_create_index(std::shared_ptr<yugawara::storage::index> index
         }
         return err->status();
     }
+    statement_cache_->invalidate();
 
     // this api is deprecated, and left only for testing. no storage_key assigned
     auto id = storage::index_id_src++;
@@ -1183,7 +1235,11 @@ status database::do_drop_index(std::string_view name, std::string_view schema) {
         // kvs storage is already removed somehow, let's proceed and remove from metadata.
         VLOG_LP(log_info) << "kvs storage '" << name << "' not found.";
     }
+    // histograms are keyed by the storage key as maintenance_storage does
+    auto storage_key = global::storage_manager()->get_storage_key(name);
+    global::key_histogram_store().remove(storage_key.value_or(std::string{name}));
     tables_->remove_index(name);
+    statement_cache_->invalidate();
     return status::ok;
 }
 
@@ -1207,6 +1263,7 @@ status database::do_create_sequence(std::shared_ptr<yugawara::storage::sequence>
         VLOG_LP(log_error) << "sequence " << name << " already exists";
         return status::err_already_exists;
     }
+    statement_cache_->invalidate();
     return status::ok;
 }
 
@@ -1222,6 +1279,7 @@ database::do_find_sequence(std::string_view name, std::string_view schema) {
 status database::do_drop_sequence(std::string_view name, std::string_view schema) {
     (void)schema;
     if(tables_->remove_sequence(name)) {
+        statement_cache_->invalidate();
         return status::ok;
     }
     return status::not_found;
@@ -1232,7 +1290,11 @@ executor::sequence::manager* database::sequence_manager() const noexcept {
 }
 
 status database::initialize_from_providers() {
-    sequence_manager_ = std::make_unique<executor::sequence::manager>(*kvs_db_);
+    sequence_manager_ = std::make_unique<executor::sequence::manager>(
+        *kvs_db_,
+        executor::sequence::manager::id_map_type{},
+        cfg_->sequence_cache_size()
+    );
     {
         std::unique_ptr<kvs::transaction> tx{};
         if(auto res = kvs::transaction::create_transaction(*kvs_db_, tx); res != status::ok) {
@@ -1547,6 +1609,11 @@ scheduler::job_context::job_id_type database::do_create_transaction_async(  //NO
 
 void database::print_diagnostic(std::ostream &os) {
     os << "/:jogasaki print diagnostics start" << std::endl;
+    if(auto& tracker = global::memory_tracker()) {
+        os << "memory_usage: " << tracker->consumed() << std::endl;
+        os << "memory_peak: " << tracker->peak() << std::endl;
+        os << "memory_limit: " << tracker->limit() << std::endl;
+    }
     if(task_scheduler_) {
         task_scheduler_->print_diagnostic(os);
     }
@@ -63,6 +63,7 @@
 #include <jogasaki/executor/sequence/sequence.h>
 #include <jogasaki/kvs/database.h>
 #include <jogasaki/plan/compile_option.h>
+#include <jogasaki/plan/prepared_statement_cache.h>
 #include <jogasaki/proto/metadata/storage.pb.h>
 #include <jogasaki/request_info.h>
 #include <jogasaki/scheduler/job_context.h>
@@ -291,6 +292,12 @@ public:
     );
 
     status destroy_statement_internal(api::statement_handle prepared);
+
+    /**
+     * @brief accessor to the prepared statement cache shared across sessions
+     */
+    [[nodiscard]] plan::prepared_statement_cache& statement_cache() noexcept;
+
     void add_udf_functions(
         ::yugawara::function::configurable_provider& functions,
         executor::function::scalar_function_repository& repo
@@ -364,6 +371,9 @@ private:
     std::shared_ptr<commit_stats> commit_stats_{std::make_shared<commit_stats>()};
     tbb::concurrent_hash_map<std::size_t, std::shared_ptr<impl::transaction_store>> transaction_stores_{};
     tbb::concurrent_hash_map<std::size_t, std::shared_ptr<impl::statement_store>> statement_stores_{};
+    std::unique_ptr<plan::prepared_statement_cache> statement_cache_{
+        std::make_unique<plan::prepared_statement_cache>()
+    };
 
     std::thread maintenance_thread_{};
     std::mutex maintenance_mutex_{};
@@ -377,7 +387,8 @@ private:
         std::shared_ptr<yugawara::variable::configurable_provider> provider,
         std::unique_ptr<impl::prepared_statement>& statement,
         std::shared_ptr<error::error_info>& out,
-        plan::compile_option const& option
+        plan::compile_option const& option,
+        plan::prepared_statement_cache::key_type const* cache_key
     );
 
     [[nodiscard]] status prepare_common(
@@ -385,7 +396,8 @@ private:
         std::shared_ptr<yugawara::variable::configurable_provider> provider,
         api::statement_handle& statement,
         std::shared_ptr<error::error_info>& out,
-        plan::compile_option const& option
+        plan::compile_option const& option,
+        plan::prepared_statement_cache::key_type const* cache_key
     );
     [[nodiscard]] bool validate_configuration() const noexcept;
     [[nodiscard]] status init_kvs_db() noexcept;
@@ -19,8 +19,10 @@
 
 #include <jogasaki/api/database.h>
 #include <jogasaki/api/impl/database.h>
+#include <jogasaki/executor/global.h>
 #include <jogasaki/executor/io/writer_pool.h>
 #include <jogasaki/memory/lifo_paged_memory_resource.h>
+#include <jogasaki/memory/memory_tracker.h>
 #include <jogasaki/request_context.h>
 #include <jogasaki/scheduler/job_context.h>
 #include <jogasaki/scheduler/statement_scheduler.h>
@@ -39,6 +41,11 @@ std::shared_ptr<request_context> create_request_context(
     std::shared_ptr<scheduler::request_detail> request_detail
 ) {
     auto& c = db.configuration();
+    auto tracker = std::make_shared<memory::memory_tracker>(global::memory_tracker(), c->request_memory_limit());
+    if(resource) {
+        // request resource can be created before the request, so move its pages to the request
+        resource->tracker(tracker);
+    }
     auto rctx = std::make_shared<request_context>(
         c,
         std::move(resource),
@@ -77,6 +84,7 @@ std::shared_ptr<request_context> create_request_context(
 
     auto job = std::make_shared<scheduler::job_context>();
     job->request(std::move(request_detail));
+    job->memory_tracker(std::move(tracker));
 
     rctx->job(maybe_shared_ptr{job.get()});
 
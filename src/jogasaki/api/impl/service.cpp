@@ -15,14 +15,17 @@
  */
 #include "service.h"
 
+#include <array>
 #include <chrono>
 #include <cstdint>
 #include <cstdlib>
 #include <exception>
+#include <memory>
 #include <optional>
 #include <ostream>
 #include <ratio>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <unordered_map>
 #include <variant>
@@ -43,6 +46,8 @@
 #include <tateyama/proto/diagnostics.pb.h>
 #include <tateyama/status.h>
 
+#include <jogasaki/accessor/binary.h>
+#include <jogasaki/accessor/text.h>
 #include <jogasaki/api/commit_option.h>
 #include <jogasaki/api/database.h>
 #include <jogasaki/api/field_type.h>
@@ -63,6 +68,7 @@
 #include <jogasaki/common.h>
 #include <jogasaki/configuration.h>
 #include <jogasaki/constants.h>
+#include <jogasaki/data/any.h>
 #include <jogasaki/datastore/get_lob_data.h>
 #include <jogasaki/error/error_info.h>
 #include <jogasaki/error/error_info_factory.h>
@@ -565,6 +571,32 @@ void service::command_execute_prepared_query(
     execute_query(res, details::query_info{handle, std::shared_ptr{std::move(params)}}, tx, req_info);
 }
 
+void service::command_batch(
+    sql::request::Request const& proto_req,
+    std::shared_ptr<tateyama::api::server::response> const& res,
+    request_info const& req_info
+) {
+    // beware asynchronous call : stack will be released soon after submitting request
+    auto& bt = proto_req.batch();
+    auto tx = validate_transaction_handle<sql::response::ExecuteResult>(bt, db_, *res, req_info);
+    if(! tx) {
+        return;
+    }
+    auto handle = validate_statement_handle<sql::response::ExecuteResult>(bt, *res, req_info);
+    if(! handle) {
+        abort_transaction(tx, req_info);
+        return;
+    }
+    std::vector<std::shared_ptr<jogasaki::api::parameter_set>> parameter_sets{};
+    parameter_sets.reserve(static_cast<std::size_t>(bt.parameter_sets_size()));
+    for(auto&& e : bt.parameter_sets()) {
+        auto params = jogasaki::api::create_parameter_set();
+        set_params(e.elements(), params, req_info);
+        parameter_sets.emplace_back(std::move(params));
+    }
+    execute_batch(res, handle, std::move(parameter_sets), tx, req_info);
+}
+
 static commit_response_kind from(::jogasaki::proto::sql::request::CommitStatus st) {
     using cs = ::jogasaki::proto::sql::request::CommitStatus;
     switch(st) {
@@ -1002,8 +1034,11 @@ void service::command_execute_dump(
                 ::jogasaki::proto::sql::request::ArrowCharacterFieldType::FIXED_SIZE_BINARY;
         } else {
             opts.file_format_ = executor::io::dump_file_format_kind::parquet;
+            if(opt.has_parquet()) {
+                opts.record_batch_size_ = opt.parquet().record_batch_size();
+            }
             if(opts.max_records_per_file_ == 0) {
-                // TODO for parquet, spliting to row groups is not implemented yet,
+                // row groups are not split unless record_batch_size is specified,
                 // so keep the legacy logic of separating files.
                 opts.max_records_per_file_ = max_records_per_file;
             }
@@ -1019,6 +1054,41 @@ void service::command_execute_dump(
     );
 }
 
+static data::any range_bound(sql::request::Parameter const& p, std::string& buf) {
+    using vc = sql::request::Parameter::ValueCase;
+    switch(p.value_case()) {
+        case vc::kInt4Value: return data::any{std::in_place_type<std::int32_t>, p.int4_value()};
+        case vc::kInt8Value: return data::any{std::in_place_type<std::int64_t>, p.int8_value()};
+        case vc::kFloat4Value: return data::any{std::in_place_type<float>, p.float4_value()};
+        case vc::kFloat8Value: return data::any{std::in_place_type<double>, p.float8_value()};
+        case vc::kCharacterValue:
+            buf = p.character_value();
+            return data::any{std::in_place_type<accessor::text>, accessor::text{std::string_view{buf}}};
+        case vc::kOctetValue:
+            buf = p.octet_value();
+            return data::any{std::in_place_type<accessor::binary>, accessor::binary{std::string_view{buf}}};
+        case vc::kDateValue:
+            return data::any{
+                std::in_place_type<field_type_traits<kind::date>::parameter_type>,
+                field_type_traits<kind::date>::parameter_type{p.date_value()}
+            };
+        default: break;  // other types are not used for row group pruning - treat as unbounded
+    }
+    return {};
+}
+
+static executor::file::column_value_range from(sql::request::LoadColumnRange const& r) {
+    // text/binary bounds refer to strings owned by the range since the request is released soon after submission
+    auto buf = std::make_shared<std::array<std::string, 2>>();
+    executor::file::column_value_range ret{
+        r.column(),
+        range_bound(r.lower(), (*buf)[0]),
+        range_bound(r.upper(), (*buf)[1])
+    };
+    ret.owner_ = std::move(buf);
+    return ret;
+}
+
 void service::command_execute_load(
     sql::request::Request const& proto_req,
     std::shared_ptr<tateyama::api::server::response> const& res,
@@ -1047,7 +1117,19 @@ void service::command_execute_load(
     for(auto&& f : list) {
         files.emplace_back(f);
     }
-    execute_load(res, details::query_info{handle, std::shared_ptr{std::move(params)}}, tx, files, req_info);
+    std::optional<executor::file::column_value_range> range{};
+    if(ed.has_column_range()) {
+        // only transactional load reads files with the loader, so the range is not used otherwise
+        range = from(ed.column_range());
+    }
+    execute_load(
+        res,
+        details::query_info{handle, std::shared_ptr{std::move(params)}},
+        tx,
+        files,
+        req_info,
+        std::move(range)
+    );
 }
 
 void service::command_describe_table(
@@ -1226,9 +1308,8 @@ bool service::process(
             break;
         }
         case sql::request::Request::RequestCase::kBatch: {
-            auto msg = string_builder{} << "batch request is unsupported (rid=" << reqid
-                                        << ") body:" << utils::to_debug_string(proto_req) << string_builder::to_string;
-            details::report_error(*res, tateyama::proto::diagnostics::Code::UNSUPPORTED_OPERATION, msg, reqid);
+            trace_scope_name("cmd-batch");  //NOLINT
+            command_batch(proto_req, res, req_info);
             break;
         }
         case sql::request::Request::RequestCase::kListTables: {
@@ -1320,6 +1401,61 @@ void service::execute_statement(
     }
 }
 
+void service::execute_batch(
+    std::shared_ptr<tateyama::api::server::response> const& res,
+    jogasaki::api::statement_handle statement,
+    std::vector<std::shared_ptr<jogasaki::api::parameter_set>> parameter_sets,
+    jogasaki::api::transaction_handle tx,
+    request_info const& req_info
+) {
+    // beware asynchronous call : stack will be released soon after submitting request
+    auto c = std::make_shared<callback_control>(res);
+    auto* cbp = c.get();
+    auto cid = c->id_;
+    if(! callbacks_.emplace(cid, std::move(c))) {
+        throw_exception(std::logic_error{"callback already exists"});
+    }
+    auto t = get_impl(*db_).find_transaction(tx);
+    if (auto rc = executor::execute_batch(  //NOLINT
+            get_impl(*db_),
+            t,
+            statement,
+            std::move(parameter_sets),
+            [cbp, this, req_info](
+                status s,
+                std::shared_ptr<error::error_info> info,  //NOLINT(performance-unnecessary-value-param)
+                std::vector<std::shared_ptr<request_statistics>> const& stats
+            ) {
+                if (s == jogasaki::status::ok) {
+                    // sum up the counters of each execution
+                    auto total = std::make_shared<request_statistics>();
+                    for(auto&& e : stats) {
+                        if(! e) continue;
+                        e->each_counter([&](auto&& kind, auto&& counter) {
+                            if(counter.count().has_value()) {
+                                total->counter(kind).count(*counter.count());
+                            }
+                        });
+                    }
+                    details::success<sql::response::ExecuteResult>(
+                        *cbp->response_,
+                        req_info,
+                        std::move(total),
+                        std::addressof(stats)
+                    );
+                } else {
+                    details::error<sql::response::ExecuteResult>(*cbp->response_, info.get(), req_info);
+                }
+                if (!callbacks_.erase(cbp->id_)) {
+                    throw_exception(std::logic_error{"missing callback"});
+                }
+            },
+            req_info
+        ); !rc) {
+        // for now, any errors from execute_batch are reported via callback, so there is nothing to do here
+    }
+}
+
 static takatori::decimal::triple to_triple(::jogasaki::proto::sql::common::Decimal const& arg) {
     std::string_view buf{arg.unscaled_value()};
     auto exp = arg.exponent();
@@ -1712,7 +1848,8 @@ void service::execute_load( //NOLINT
     details::query_info const& q,
     jogasaki::api::transaction_handle tx,
     std::vector<std::string> const& files,
-    request_info const& req_info
+    request_info const& req_info,
+    std::optional<executor::file::column_value_range> range
 ) {
     for(auto&& f : files) {
         VLOG(log_info) << log_location_prefix << "load processing file: " << f;
@@ -1748,7 +1885,8 @@ void service::execute_load( //NOLINT
                         throw_exception(std::logic_error{"missing callback"});
                     }
                 },
-                req_info
+                req_info,
+                std::move(range)
             ); !rc) {
             // for now, any errors from execute_load are reported via callback, so there is nothing to do here
         }
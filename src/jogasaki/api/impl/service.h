@@ -66,6 +66,7 @@
 #include <jogasaki/executor/dto/common_column.h>
 #include <jogasaki/executor/dto/common_column_utils.h>
 #include <jogasaki/executor/dto/describe_table.h>
+#include <jogasaki/executor/file/file_reader.h>
 #include <jogasaki/executor/io/dump_config.h>
 #include <jogasaki/logging_helper.h>
 #include <jogasaki/proto/sql/common.pb.h>
@@ -418,6 +419,22 @@ inline sql::response::ExecuteResult::CounterType from(counter_kind kind) {
     }
 }
 
+inline void set_counters(
+    request_statistics const& stats,
+    ::google::protobuf::RepeatedPtrField<sql::response::ExecuteResult::CounterEntry>& out
+) {
+    stats.each_counter([&](auto&& kind, auto&& counter){
+        auto knd = from(kind);
+        if(knd != sql::response::ExecuteResult::COUNTER_TYPE_UNSPECIFIED) {
+            if(counter.count().has_value()) {
+                auto* c = out.Add();
+                c->set_type(knd);
+                c->set_value(*counter.count());
+            }
+        }
+    });
+}
+
 template<>
 inline void success<sql::response::ExecuteResult>(
     tateyama::api::server::response& res,
@@ -427,17 +444,27 @@ inline void success<sql::response::ExecuteResult>(
     sql::response::Response r{};
     auto* er = r.mutable_execute_result();
     auto* s = er->mutable_success();
+    set_counters(*stats, *s->mutable_counters());
+    reply(res, r, req_info);
+}
 
-    stats->each_counter([&](auto&& kind, auto&& counter){
-        auto knd = from(kind);
-        if(knd != sql::response::ExecuteResult::COUNTER_TYPE_UNSPECIFIED) {
-            if(counter.count().has_value()) {
-                auto* c = s->add_counters();
-                c->set_type(knd);
-                c->set_value(*counter.count());
-            }
+template<>
+inline void success<sql::response::ExecuteResult>(
+    tateyama::api::server::response& res,
+    request_info req_info,  //NOLINT(performance-unnecessary-value-param)
+    std::shared_ptr<request_statistics> stats,  //NOLINT(performance-unnecessary-value-param)
+    std::vector<std::shared_ptr<request_statistics>> const* batch_stats
+) {
+    sql::response::Response r{};
+    auto* er = r.mutable_execute_result();
+    auto* s = er->mutable_success();
+    set_counters(*stats, *s->mutable_counters());
+    for(auto&& e : *batch_stats) {
+        auto* entry = s->add_batch_entries();
+        if(e) {
+            set_counters(*e, *entry->mutable_counters());
         }
-    });
+    }
     reply(res, r, req_info);
 }
 
@@ -623,6 +650,11 @@ private:
         std::shared_ptr<tateyama::api::server::response> const& res,
         request_info const& req_info
     );
+    void command_batch(
+        sql::request::Request const& proto_req,
+        std::shared_ptr<tateyama::api::server::response> const& res,
+        request_info const& req_info
+    );
 
     void command_commit(
         sql::request::Request const& proto_req,
@@ -718,6 +750,14 @@ private:
         details::query_info const& q,
         jogasaki::api::transaction_handle tx,
         std::vector<std::string> const& files,
+        request_info const& req_info,
+        std::optional<executor::file::column_value_range> range
+    );
+    void execute_batch(
+        std::shared_ptr<tateyama::api::server::response> const& res,
+        jogasaki::api::statement_handle statement,
+        std::vector<std::shared_ptr<jogasaki::api::parameter_set>> parameter_sets,
+        jogasaki::api::transaction_handle tx,
         request_info const& req_info
     );
     void set_params(
@@ -18,6 +18,8 @@
 #include <sharksfin/api.h>
 #include <takatori/util/exception.h>
 
+#include <jogasaki/status.h>
+
 namespace jogasaki::api::kvsservice {
 
 /**
@@ -76,6 +78,58 @@ inline status convert(sharksfin::StatusCode code) {
     }
 }
 
+/**
+ * @brief convert jogasaki::status returned from the kvs layer to jogasaki::api::kvsservice::status
+ * @param st the status returned from jogasaki::kvs objects (e.g. jogasaki::kvs::iterator)
+ * @return the value of kvsservice::status corresponding to the sharksfin code the status was resolved from
+ */
+inline status convert(jogasaki::status st) {
+    switch (st) {
+        case jogasaki::status::ok:
+            return status::ok;
+        case jogasaki::status::not_found:
+            return status::not_found;
+        case jogasaki::status::already_exists:
+            return status::already_exists;
+        case jogasaki::status::user_rollback:
+            return status::user_rollback;
+        case jogasaki::status::waiting_for_other_transaction:
+            return status::waiting_for_other_transaction;
+        case jogasaki::status::err_io_error:
+            return status::err_io_error;
+        case jogasaki::status::err_invalid_argument:
+            return status::err_invalid_argument;
+        case jogasaki::status::err_invalid_state:
+            return status::err_invalid_state;
+        case jogasaki::status::err_unsupported:
+            return status::err_unsupported;
+        case jogasaki::status::err_user_error:
+            return status::err_user_error;
+        case jogasaki::status::err_aborted:
+            return status::err_aborted;
+        case jogasaki::status::err_serialization_failure:
+            return status::err_aborted_retryable;
+        case jogasaki::status::err_time_out:
+            return status::err_time_out;
+        case jogasaki::status::err_not_implemented:
+            return status::err_not_implemented;
+        case jogasaki::status::err_illegal_operation:
+            return status::err_illegal_operation;
+        case jogasaki::status::err_conflict_on_write_preserve:
+            return status::err_conflict_on_write_preserve;
+        case jogasaki::status::err_write_without_write_preserve:
+            return status::err_write_without_write_preserve;
+        case jogasaki::status::err_inactive_transaction:
+            return status::err_inactive_transaction;
+        case jogasaki::status::err_resource_limit_reached:
+            return status::err_resource_limit_reached;
+        case jogasaki::status::err_invalid_key_length:
+            return status::err_invalid_key_length;
+        default:
+            return status::err_unknown;
+    }
+}
+
 /**
  * @brief convert two sharksfin::StatusCode to a jogasaki::api::kvsservice::status
  * @param code1 the code of sharksfin::StatusCode
@@ -15,6 +15,8 @@
  */
 #include "service.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <mutex>
 #include <ostream>
 #include <stdexcept>
@@ -22,16 +24,22 @@
 #include <string_view>
 #include <utility>
 #include <glog/logging.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/stubs/port.h>
 
 #include <takatori/util/exception.h>
+#include <tateyama/api/server/data_channel.h>
+#include <tateyama/api/server/writer.h>
 #include <tateyama/proto/kvs/data.pb.h>
 #include <tateyama/proto/kvs/response.pb.h>
 #include <tateyama/proto/kvs/transaction.pb.h>
+#include <tateyama/status.h>
 
 #include <jogasaki/api/kvsservice/put_option.h>
 #include <jogasaki/api/kvsservice/remove_option.h>
+#include <jogasaki/api/kvsservice/scan_bound.h>
 #include <jogasaki/api/kvsservice/status.h>
 #include <jogasaki/api/kvsservice/status_message.h>
 #include <jogasaki/api/kvsservice/store.h>
@@ -370,8 +378,8 @@ static void error_put(status status, std::shared_ptr<tateyama::api::server::resp
 void service::command_put(tateyama::proto::kvs::request::Request const &proto_req,
                                std::shared_ptr<tateyama::api::server::response> &res) {
     auto &put = proto_req.put();
-    if (put.records_size() != 1) {
-        error_put(status::err_unsupported, res);
+    if (put.records_size() < 1) {
+        error_put(status::err_invalid_argument, res);
         return;
     }
     auto &proto_handle = put.transaction_handle();
@@ -382,26 +390,18 @@ void service::command_put(tateyama::proto::kvs::request::Request const &proto_re
     }
     auto &table = put.index().table_name();
     put_option opt = convert(put.type());
-    auto &record = put.records(0);
+    std::size_t written = 0;
     status status{};
     {
+        // the records are put under single lock so that the table and buffers cached by tx are reused
         std::unique_lock<std::mutex> lock{tx->transaction_mutex()};
-        status = tx->put(table, record, opt);
+        // tx is aborted if the batch fails in the middle
+        status = tx->put(table, put.records(), opt, written);
     }
     switch (status) {
         case status::ok:
-            success_put(1, res);
-            break;
-        case status::already_exists: // opt==create && didn't create
-        case status::not_found: // opt==update && didn't update
-            success_put(0, res);
+            success_put(static_cast<int>(written), res);
             break;
-        case status::err_not_implemented: {
-            // TODO better message handling
-            std::string msg{"table with secondary index not fully supported yet"};
-            error_put(status, res, &msg);
-            break;
-        }
         default:
             error_put(status, res);
             break;
@@ -413,13 +413,8 @@ void service::command_put(tateyama::proto::kvs::request::Request const &proto_re
  */
 static void success_get(tateyama::proto::kvs::response::Get_Success &success, std::shared_ptr<tateyama::api::server::response> &res) {
     tateyama::proto::kvs::response::Response proto_res { };
-    auto* get = proto_res.mutable_get();
-    get->set_allocated_success(&success);
+    proto_res.mutable_get()->mutable_success()->Swap(&success);
     reply(proto_res, res);
-    while (success.records_size() > 0) {
-        (void)success.mutable_records()->ReleaseLast();
-    }
-    (void)get->release_success();
 }
 
 static void error_get(status status, std::shared_ptr<tateyama::api::server::response> &res) {
@@ -433,8 +428,8 @@ static void error_get(status status, std::shared_ptr<tateyama::api::server::resp
 void service::command_get(tateyama::proto::kvs::request::Request const &proto_req,
                                std::shared_ptr<tateyama::api::server::response> &res) {
     auto &get = proto_req.get();
-    if (get.keys_size() != 1) {
-        error_get(status::err_unsupported, res);
+    if (get.keys_size() < 1) {
+        error_get(status::err_invalid_argument, res);
         return;
     }
     auto &proto_handle = get.transaction_handle();
@@ -444,25 +439,18 @@ void service::command_get(tateyama::proto::kvs::request::Request const &proto_re
         return;
     }
     auto &table = get.index().table_name();
-    auto &key = get.keys(0);
-    tateyama::proto::kvs::data::Record record{};
+    tateyama::proto::kvs::response::Get_Success success{};
     status status{};
     {
         std::unique_lock<std::mutex> lock{tx->transaction_mutex()};
-        status = tx->get(table, key, record);
+        // missing records are simply omitted from the result
+        status = tx->get(table, get.keys(), *success.mutable_records());
     }
-    if (status != status::ok && status != status::not_found) {
+    if (status != status::ok) {
         error_get(status, res);
         return;
     }
-    tateyama::proto::kvs::response::Get_Success success{};
-    if (status == status::ok) {
-        success.mutable_records()->AddAllocated(&record);
-    }
     success_get(success, res);
-    while (success.records_size() > 0) {
-        (void)success.mutable_records()->ReleaseLast();
-    }
 }
 
 /*
@@ -504,8 +492,8 @@ static void error_remove(status status, std::shared_ptr<tateyama::api::server::r
 void service::command_remove(tateyama::proto::kvs::request::Request const &proto_req,
                                   std::shared_ptr<tateyama::api::server::response> &res) {
     auto &remove = proto_req.remove();
-    if (remove.keys_size() != 1) {
-        error_remove(status::err_unsupported, res);
+    if (remove.keys_size() < 1) {
+        error_remove(status::err_invalid_argument, res);
         return;
     }
     auto &proto_handle = remove.transaction_handle();
@@ -516,31 +504,124 @@ void service::command_remove(tateyama::proto::kvs::request::Request const &proto
     }
     auto &table = remove.index().table_name();
     auto opt = convert(remove.type());
-    auto &key = remove.keys(0);
+    std::size_t removed = 0;
     status status{};
     {
         std::unique_lock<std::mutex> lock{tx->transaction_mutex()};
-        status = tx->remove(table, key, opt);
+        // tx is aborted if the batch fails in the middle
+        status = tx->remove(table, remove.keys(), opt, removed);
     }
     switch (status) {
         case status::ok:
-            success_remove(1, res);
+            success_remove(static_cast<int>(removed), res);
             break;
-        case status::not_found:
-            success_remove(0, res);
-            break;
-        case status::err_not_implemented: {
-            // TODO better message handling
-            std::string msg{"table with secondary index not fully supported yet"};
-            error_remove(status, res, &msg);
-            break;
-        }
         default:
             error_remove(status, res);
             break;
     }
 }
 
+/*
+ * scan
+ */
+static scan_bound convert(tateyama::proto::kvs::request::Scan_Bound bound) {
+    switch (bound) {
+        case tateyama::proto::kvs::request::Scan_Bound::Scan_Bound_SCAN_BOUND_UNSPECIFIED:
+            return scan_bound::unbound;
+        case tateyama::proto::kvs::request::Scan_Bound::Scan_Bound_INCLUSIVE:
+            return scan_bound::inclusive;
+        case tateyama::proto::kvs::request::Scan_Bound::Scan_Bound_EXCLUSIVE:
+            return scan_bound::exclusive;
+        default:
+            throw_exception(std::logic_error{"unknown Scan_Bound"});
+    }
+}
+
+static void success_scan(std::int64_t records, std::shared_ptr<tateyama::api::server::response> &res) {
+    tateyama::proto::kvs::response::Response proto_res { };
+    auto* scan = proto_res.mutable_scan();
+    auto* success = scan->mutable_success();
+    success->set_records(records);
+    reply(proto_res, res);
+}
+
+static void error_scan(status status, std::shared_ptr<tateyama::api::server::response> &res) {
+    tateyama::proto::kvs::response::Response proto_res { };
+    auto* scan = proto_res.mutable_scan();
+    auto* error = scan->mutable_error();
+    set_error(status, *error);
+    reply(proto_res, res);
+}
+
+static bool serialize_delimited(google::protobuf::Message const &message, std::string &out) {
+    out.clear();
+    google::protobuf::io::StringOutputStream os{&out};
+    google::protobuf::io::CodedOutputStream cos{&os};
+    cos.WriteVarint32(static_cast<std::uint32_t>(message.ByteSizeLong()));
+    return message.SerializeToCodedStream(&cos);
+}
+
+// the number of records written to the channel before making them visible to the client
+constexpr static std::size_t scan_commit_interval = 256;
+
+void service::command_scan(tateyama::proto::kvs::request::Request const &proto_req,
+                                std::shared_ptr<tateyama::api::server::response> &res) {
+    auto &scan = proto_req.scan();
+    if (scan.channel_name().empty()) {
+        error_scan(status::err_invalid_argument, res);
+        return;
+    }
+    auto &proto_handle = scan.transaction_handle();
+    auto tx = store_->find_transaction(proto_handle.system_id());
+    if (tx == nullptr) {
+        error_scan(status::err_invalid_argument, res);
+        return;
+    }
+    std::shared_ptr<tateyama::api::server::data_channel> ch{};
+    if (auto rc = res->acquire_channel(scan.channel_name(), ch, 1); rc != tateyama::status::ok) {
+        error_scan(status::err_resource_limit_reached, res);
+        return;
+    }
+    std::shared_ptr<tateyama::api::server::writer> writer{};
+    if (auto rc = ch->acquire(writer); rc != tateyama::status::ok) {
+        (void) res->release_channel(*ch);
+        error_scan(status::err_io_error, res);
+        return;
+    }
+    auto &table = scan.index().table_name();
+    bool reverse = scan.type() == tateyama::proto::kvs::request::Scan_Type::Scan_Type_BACKWARD;
+    std::int64_t records = 0;
+    std::string buf{};
+    // tx locks the transaction mutex by itself only while reading, so that writing to the channel doesn't block
+    // other requests on the transaction
+    auto status = tx->scan(table,
+        scan.lower_key(), convert(scan.lower_bound()),
+        scan.upper_key(), convert(scan.upper_bound()),
+        [&](tateyama::proto::kvs::data::Record &record) {
+            if (! serialize_delimited(record, buf)) {
+                return status::err_unknown;
+            }
+            if (writer->write(buf.data(), buf.size()) != tateyama::status::ok) {
+                return status::err_io_error;
+            }
+            if (++records % scan_commit_interval == 0 && writer->commit() != tateyama::status::ok) {
+                return status::err_io_error;
+            }
+            return status::ok;
+        },
+        reverse);
+    if (writer->commit() != tateyama::status::ok && status == status::ok) {
+        status = status::err_io_error;
+    }
+    (void) ch->release(*writer);
+    (void) res->release_channel(*ch);
+    if (status == status::ok) {
+        success_scan(records, res);
+    } else {
+        error_scan(status, res);
+    }
+}
+
 /*
  * get_error_info
  */
@@ -660,7 +741,7 @@ bool service::operator()(std::shared_ptr<tateyama::api::server::request> req, //
             break;
         }
         case tateyama::proto::kvs::request::Request::kScan: {
-            reply("not supported yet", res);
+            command_scan(proto_req, res);
             break;
         }
         case tateyama::proto::kvs::request::Request::kBatch: {
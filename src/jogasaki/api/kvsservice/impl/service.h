@@ -60,6 +60,8 @@ private:
                      std::shared_ptr<tateyama::api::server::response> &res);
     void command_remove(tateyama::proto::kvs::request::Request const &proto_req,
                         std::shared_ptr<tateyama::api::server::response> &res);
+    void command_scan(tateyama::proto::kvs::request::Request const &proto_req,
+                      std::shared_ptr<tateyama::api::server::response> &res);
     void command_get_error_info(tateyama::proto::kvs::request::Request const &proto_req,
                                      std::shared_ptr<tateyama::api::server::response> &res);
     void command_dispose_transaction(tateyama::proto::kvs::request::Request const &proto_req,
@@ -0,0 +1,143 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "secondary_index_writer.h"
+
+#include <cstddef>
+#include <string_view>
+#include <utility>
+
+#include <yugawara/storage/index.h>
+#include <sharksfin/Slice.h>
+#include <sharksfin/StatusCode.h>
+#include <sharksfin/api.h>
+
+#include <jogasaki/executor/global.h>
+#include <jogasaki/executor/wrt/fill_record_fields.h>
+#include <jogasaki/index/field_factory.h>
+#include <jogasaki/index/utils.h>
+#include <jogasaki/kvs/readable_stream.h>
+#include <jogasaki/kvs/storage.h>
+#include <jogasaki/utils/get_storage_by_index_name.h>
+
+#include "convert.h"
+
+namespace jogasaki::api::kvsservice {
+
+secondary_index_writer::secondary_index_writer(
+    yugawara::storage::index const& primary,
+    std::shared_ptr<jogasaki::configuration> config
+) :
+    key_meta_(index::create_meta(primary, true)),
+    value_meta_(index::create_meta(primary, false)),
+    key_codec_(index::index_fields(primary, true)),
+    value_codec_(index::index_fields(primary, false)),
+    targets_(executor::wrt::create_secondary_targets(primary, key_meta_, value_meta_)),
+    request_context_(std::make_unique<request_context>(std::move(config))),
+    resource_(std::make_unique<memory::lifo_paged_memory_resource>(&global::page_pool())),
+    key_store_(key_meta_),
+    value_store_(value_meta_)
+{
+    contexts_.reserve(targets_.size());
+    storages_.reserve(targets_.size());
+    for(auto&& t : targets_) {
+        auto stg = utils::get_storage_by_index_name(t.storage_name());
+        storages_.emplace_back(stg ? stg->handle() : nullptr);
+        // the context owns the storage, and the handle above is valid as long as this object lives
+        contexts_.emplace_back(std::move(stg), request_context_.get());
+    }
+}
+
+bool secondary_index_writer::valid() const noexcept {
+    for(auto* s : storages_) {
+        if(s == nullptr) {
+            return false;
+        }
+    }
+    return true;
+}
+
+status secondary_index_writer::decode(std::string_view key, std::string_view value) {
+    // varlen data of the previous records are no longer referenced
+    resource_->deallocate_after(memory::lifo_paged_memory_resource::initial_checkpoint);
+    kvs::readable_stream key_stream{key.data(), key.size()};
+    if(auto rc = key_codec_.decode(key_stream, key_store_.ref(), resource_.get()); rc != jogasaki::status::ok) {
+        return convert(rc);
+    }
+    kvs::readable_stream value_stream{value.data(), value.size()};
+    if(auto rc = value_codec_.decode(value_stream, value_store_.ref(), resource_.get()); rc != jogasaki::status::ok) {
+        return convert(rc);
+    }
+    return status::ok;
+}
+
+status secondary_index_writer::encode(std::size_t index, std::string_view key, std::string_view& out) {
+    if(auto rc = targets_[index].create_secondary_key(
+            contexts_[index], buffer_, key_store_.ref(), value_store_.ref(), key, out);
+        rc != jogasaki::status::ok) {
+        return convert(rc);
+    }
+    return status::ok;
+}
+
+status secondary_index_writer::encode_value(std::size_t index, std::string_view& out) {
+    if(auto rc = targets_[index].create_secondary_value(
+            contexts_[index], value_buffer_, key_store_.ref(), value_store_.ref(), out);
+        rc != jogasaki::status::ok) {
+        return convert(rc);
+    }
+    return status::ok;
+}
+
+status secondary_index_writer::put(sharksfin::TransactionHandle tx, std::string_view key, std::string_view value) {
+    if(auto s = decode(key, value); s != status::ok) {
+        return s;
+    }
+    for(std::size_t i = 0, n = targets_.size(); i < n; ++i) {
+        std::string_view k{};
+        if(auto s = encode(i, key, k); s != status::ok) {
+            return s;
+        }
+        std::string_view v{};
+        if(auto s = encode_value(i, v); s != status::ok) {
+            return s;
+        }
+        auto code = sharksfin::content_put(
+            tx, storages_[i], sharksfin::Slice{k}, sharksfin::Slice{v}, sharksfin::PutOperation::CREATE_OR_UPDATE);
+        if(code != sharksfin::StatusCode::OK) {
+            return convert(code);
+        }
+    }
+    return status::ok;
+}
+
+status secondary_index_writer::remove(sharksfin::TransactionHandle tx, std::string_view key, std::string_view value) {
+    if(auto s = decode(key, value); s != status::ok) {
+        return s;
+    }
+    for(std::size_t i = 0, n = targets_.size(); i < n; ++i) {
+        std::string_view k{};
+        if(auto s = encode(i, key, k); s != status::ok) {
+            return s;
+        }
+        auto code = sharksfin::content_delete(tx, storages_[i], sharksfin::Slice{k});
+        if(code != sharksfin::StatusCode::OK && code != sharksfin::StatusCode::NOT_FOUND) {
+            return convert(code);
+        }
+    }
+    return status::ok;
+}
+
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include <takatori/util/maybe_shared_ptr.h>
+#include <yugawara/storage/index.h>
+#include <sharksfin/api.h>
+
+#include <jogasaki/api/kvsservice/status.h>
+#include <jogasaki/configuration.h>
+#include <jogasaki/data/aligned_buffer.h>
+#include <jogasaki/data/small_record_store.h>
+#include <jogasaki/index/record_codec.h>
+#include <jogasaki/index/secondary_context.h>
+#include <jogasaki/index/secondary_target.h>
+#include <jogasaki/memory/lifo_paged_memory_resource.h>
+#include <jogasaki/meta/record_meta.h>
+#include <jogasaki/request_context.h>
+
+namespace jogasaki::api::kvsservice {
+
+using takatori::util::maybe_shared_ptr;
+
+/**
+ * @brief writer to maintain the secondary indices of a table on the KVS write path
+ * @details the encoded primary key/value are decoded once into the records, and the secondary keys of all the
+ * secondary indices are generated from them with index::secondary_target, in the same way as the SQL write operators.
+ * The entries are encoded per record rather than per request, since each record has its own primary key/value and
+ * the decoded records and encoding buffers are reused across the records.
+ * @note this object is not thread-safe. Use one writer per transaction.
+ */
+class secondary_index_writer {
+public:
+    /**
+     * @brief create empty object
+     */
+    secondary_index_writer() = default;
+
+    /**
+     * @brief create new object
+     * @param primary the primary index of the table
+     * @param config the configuration used for the request context receiving the encoding errors
+     */
+    secondary_index_writer(
+        yugawara::storage::index const& primary,
+        std::shared_ptr<jogasaki::configuration> config
+    );
+
+    /**
+     * @brief returns whether the storages of all secondary indices are found
+     */
+    [[nodiscard]] bool valid() const noexcept;
+
+    /**
+     * @brief put the secondary index entries for the primary entry
+     * @param tx the transaction to write
+     * @param key the encoded primary key
+     * @param value the encoded primary value
+     * @return status::ok if successful
+     * @return otherwise if error was occurred
+     */
+    [[nodiscard]] status put(sharksfin::TransactionHandle tx, std::string_view key, std::string_view value);
+
+    /**
+     * @brief remove the secondary index entries for the primary entry
+     * @param tx the transaction to write
+     * @param key the encoded primary key
+     * @param value the encoded primary value currently stored
+     * @return status::ok if successful
+     * @return otherwise if error was occurred
+     */
+    [[nodiscard]] status remove(sharksfin::TransactionHandle tx, std::string_view key, std::string_view value);
+
+private:
+    maybe_shared_ptr<meta::record_meta> key_meta_{};
+    maybe_shared_ptr<meta::record_meta> value_meta_{};
+    index::record_codec key_codec_{};
+    index::record_codec value_codec_{};
+    std::vector<index::secondary_target> targets_{};
+    std::vector<index::secondary_context> contexts_{};
+    std::vector<sharksfin::StorageHandle> storages_{};
+    std::unique_ptr<request_context> request_context_{};
+    std::unique_ptr<memory::lifo_paged_memory_resource> resource_{};
+    data::small_record_store key_store_{};
+    data::small_record_store value_store_{};
+    data::aligned_buffer buffer_{};
+    data::aligned_buffer value_buffer_{};
+
+    status decode(std::string_view key, std::string_view value);
+    status encode(std::size_t index, std::string_view key, std::string_view& out);
+    status encode_value(std::size_t index, std::string_view& out);
+};
+
+}
@@ -19,7 +19,12 @@
 #include <atomic>
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 #include <google/protobuf/stubs/port.h>
 
 #include <takatori/util/exception.h>
@@ -36,14 +41,18 @@
 #include <jogasaki/api/impl/database.h>
 #include <jogasaki/api/kvsservice/put_option.h>
 #include <jogasaki/api/kvsservice/remove_option.h>
+#include <jogasaki/api/kvsservice/scan_bound.h>
 #include <jogasaki/api/kvsservice/status.h>
 #include <jogasaki/api/kvsservice/transaction_state.h>
-#include <jogasaki/data/aligned_buffer.h>
+#include <jogasaki/kvs/iterator.h>
 #include <jogasaki/kvs/writable_stream.h>
+#include <jogasaki/status.h>
 #include <jogasaki/storage/storage_manager.h>
 
+#include "column_data.h"
 #include "convert.h"
 #include "record_columns.h"
+#include "secondary_index_writer.h"
 #include "serializer.h"
 #include "transaction_utils.h"
 
@@ -132,15 +141,70 @@ status transaction::abort() {
     return convert(code);
 }
 
-status transaction::get_storage(std::string_view name, sharksfin::StorageHandle &storage) {
+transaction::~transaction() {
+    for (auto &&[name, entry] : tables_) {
+        if (entry.storage_ != nullptr) {
+            (void) sharksfin::storage_dispose(entry.storage_);
+        }
+    }
+}
+
+status transaction::find_table(std::string_view name, table_entry *&entry) {
+    if (auto it = tables_.find(name); it != tables_.end()) {
+        entry = std::addressof(it->second);
+        return status::ok;
+    }
+    table_entry e{};
+    if (auto s = get_table(db_, name, e.table_); s != status::ok) {
+        return s;
+    }
     // resolve storage key from table name
     auto sk = global::storage_manager()->get_storage_key(name);
     if (! sk.has_value()) {
         return status::err_table_not_found;
     }
     sharksfin::Slice key {sk.value()};
-    auto code = sharksfin::storage_get(db_handle_, key, &storage);
-    return convert(code);
+    if (auto code = sharksfin::storage_get(db_handle_, key, &e.storage_); code != sharksfin::StatusCode::OK) {
+        return convert(code);
+    }
+    e.has_secondary_index_ = has_secondary_index(e.table_);
+    if (e.has_secondary_index_) {
+        auto primary = db_->tables()->find_index(name);
+        if (primary == nullptr) {
+            (void) sharksfin::storage_dispose(e.storage_);
+            return status::err_table_not_found;
+        }
+        e.secondaries_ = std::make_shared<secondary_index_writer>(*primary, db_->configuration());
+        if (! e.secondaries_->valid()) {
+            (void) sharksfin::storage_dispose(e.storage_);
+            return status::err_table_not_found;
+        }
+    }
+    auto [it, inserted] = tables_.emplace(std::string{name}, std::move(e));
+    (void) inserted;
+    entry = std::addressof(it->second);
+    return status::ok;
+}
+
+/**
+ * @brief encode the columns into the buffer
+ * @details the buffer is extended if it's too small, and reused by the subsequent calls
+ */
+static status encode(jogasaki::kvs::coding_spec const &spec, std::vector<column_data> const &list,
+                     std::string &buffer, std::string_view &out) {
+    std::size_t size{};
+    if (auto s = get_bufsize(spec, list, size); s != status::ok) {
+        return s;
+    }
+    if (buffer.size() < size) {
+        buffer.resize(size);
+    }
+    jogasaki::kvs::writable_stream stream{buffer.data(), buffer.size()};
+    if (auto s = serialize(spec, list, stream); s != status::ok) {
+        return s;
+    }
+    out = {buffer.data(), stream.size()};
+    return status::ok;
 }
 
 status transaction::put(std::string_view table_name, tateyama::proto::kvs::data::Record const &record,
@@ -151,47 +215,78 @@ status transaction::put(std::string_view table_name, tateyama::proto::kvs::data:
     if (!is_valid_record(record)) {
         return status::err_invalid_argument;
     }
-    std::shared_ptr<yugawara::storage::table const> table{};
-    if (auto s = get_table(db_, table_name, table); s != status::ok) {
+    table_entry *entry{};
+    if (auto s = find_table(table_name, entry); s != status::ok) {
         return s;
     }
-    if (has_secondary_index(table)) {
-        return status::err_not_implemented;
-    }
-    record_columns rec_cols{table, record, false};
+    record_columns rec_cols{entry->table_, record, false};
     if (auto s = check_put_record(rec_cols); s != status::ok) {
         return s;
     }
-    std::size_t key_size{};
-    if (auto s = get_bufsize(spec_primary_key, rec_cols.primary_keys(), key_size);
-            s != status::ok) {
+    std::string_view key{};
+    if (auto s = encode(spec_primary_key, rec_cols.primary_keys(), key_buffer_, key); s != status::ok) {
         return s;
     }
-    jogasaki::data::aligned_buffer key_buffer{key_size};
-    jogasaki::kvs::writable_stream key_stream{key_buffer.data(), key_buffer.capacity()};
-    if (auto s = serialize(spec_primary_key, rec_cols.primary_keys(), key_stream); s != status::ok) {
+    std::string_view value{};
+    if (auto s = encode(spec_value, rec_cols.values(), value_buffer_, value); s != status::ok) {
         return s;
     }
-    std::size_t value_size{};
-    if (auto s = get_bufsize(spec_value, rec_cols.values(), value_size);
-            s != status::ok) {
-        return s;
+    if (entry->has_secondary_index_) {
+        return put_with_secondaries(*entry, key, value, opt);
     }
-    jogasaki::data::aligned_buffer value_buffer{value_size};
-    jogasaki::kvs::writable_stream value_stream{value_buffer.data(), value_buffer.capacity()};
-    if (auto s = serialize(spec_value, rec_cols.values(), value_stream); s != status::ok) {
+    sharksfin::Slice key_slice {key};
+    sharksfin::Slice value_slice {value};
+    auto option = convert(opt);
+    auto code = sharksfin::content_put(tx_handle_, entry->storage_, key_slice, value_slice, option);
+    return convert(code);
+}
+
+status transaction::put(std::string_view table_name,
+                        google::protobuf::RepeatedPtrField<tateyama::proto::kvs::data::Record> const &records,
+                        put_option opt, std::size_t &written) {
+    written = 0;
+    for (auto &record : records) {
+        auto s = put(table_name, record, opt);
+        if (s == status::ok) {
+            ++written;
+            continue;
+        }
+        if (s == status::already_exists || s == status::not_found) {
+            // opt==create && didn't create, or opt==update && didn't update
+            continue;
+        }
+        // the preceding records are already written, so abort not to commit the batch partially
+        (void) abort();
         return s;
     }
-    sharksfin::Slice key_slice {key_stream.data(), key_stream.size()};
-    sharksfin::Slice value_slice {value_stream.data(), value_stream.size()};
-    sharksfin::StorageHandle storage{};
-    if (auto s = get_storage(table_name, storage); s != status::ok) {
-        return s;
+    return status::ok;
+}
+
+status transaction::put_with_secondaries(table_entry &entry, std::string_view key, std::string_view value,
+                                         put_option opt) {
+    sharksfin::Slice key_slice {key};
+    if (opt != put_option::create) {
+        // the secondary entries of the old record must be removed before the primary is overwritten
+        sharksfin::Slice old_slice{};
+        auto code = sharksfin::content_get(tx_handle_, entry.storage_, key_slice, &old_slice);
+        if (code == sharksfin::StatusCode::OK) {
+            // the slice is valid only until the next call to the storage, so copy it
+            old_value_buffer_.assign(old_slice.data(), old_slice.size());
+            if (auto s = entry.secondaries_->remove(tx_handle_, key, old_value_buffer_); s != status::ok) {
+                return s;
+            }
+        } else if (code != sharksfin::StatusCode::NOT_FOUND) {
+            return convert(code);
+        } else if (opt == put_option::update) {
+            return status::not_found;
+        }
     }
-    auto option = convert(opt);
-    auto code = sharksfin::content_put(tx_handle_, storage, key_slice, value_slice, option);
-    auto code2 = sharksfin::storage_dispose(storage);
-    return convert(code, code2);
+    auto code = sharksfin::content_put(tx_handle_, entry.storage_, key_slice, sharksfin::Slice{value}, convert(opt));
+    if (code != sharksfin::StatusCode::OK) {
+        // ALREADY_EXISTS for put_option::create, or error
+        return convert(code);
+    }
+    return entry.secondaries_->put(tx_handle_, key, value);
 }
 
 status transaction::get(std::string_view table_name, tateyama::proto::kvs::data::Record const &primary_key,
@@ -202,37 +297,44 @@ status transaction::get(std::string_view table_name, tateyama::proto::kvs::data:
     if (!is_valid_record(primary_key)) {
         return status::err_invalid_argument;
     }
-    std::shared_ptr<yugawara::storage::table const> table{};
-    if (auto s = get_table(db_, table_name, table); s != status::ok) {
+    table_entry *entry{};
+    if (auto s = find_table(table_name, entry); s != status::ok) {
         return s;
     }
-    record_columns rec_cols{table, primary_key, true};
+    record_columns rec_cols{entry->table_, primary_key, true};
     if (auto s = check_valid_primary_key(rec_cols); s != status::ok) {
         return s;
     }
-    std::size_t key_size{};
-    if (auto s = get_bufsize(spec_primary_key, rec_cols.primary_keys(), key_size);
-        s != status::ok) {
+    std::string_view key{};
+    if (auto s = encode(spec_primary_key, rec_cols.primary_keys(), key_buffer_, key); s != status::ok) {
         return s;
     }
-    jogasaki::data::aligned_buffer key_buffer{key_size};
-    jogasaki::kvs::writable_stream key_stream{key_buffer.data(), key_buffer.capacity()};
-    if (auto s = serialize(spec_primary_key, rec_cols.primary_keys(), key_stream);
-        s != status::ok) {
-        return s;
+    sharksfin::Slice key_slice {key};
+    sharksfin::Slice value_slice{};
+    auto code = sharksfin::content_get(tx_handle_, entry->storage_, key_slice, &value_slice);
+    if (code != sharksfin::StatusCode::OK) {
+        return convert(code);
     }
-    sharksfin::StorageHandle storage{};
-    if (auto s = get_storage(table_name, storage); s != status::ok) {
+    return make_record(entry->table_, primary_key, value_slice, record);
+}
+
+status transaction::get(std::string_view table_name,
+                        google::protobuf::RepeatedPtrField<tateyama::proto::kvs::data::Record> const &primary_keys,
+                        google::protobuf::RepeatedPtrField<tateyama::proto::kvs::data::Record> &records) {
+    records.Clear();
+    for (auto &key : primary_keys) {
+        tateyama::proto::kvs::data::Record record{};
+        auto s = get(table_name, key, record);
+        if (s == status::ok) {
+            records.Add()->Swap(&record);
+            continue;
+        }
+        if (s == status::not_found) {
+            continue;
+        }
         return s;
     }
-    sharksfin::Slice key_slice {key_stream.data(), key_stream.size()};
-    sharksfin::Slice value_slice{};
-    auto code = sharksfin::content_get(tx_handle_, storage, key_slice, &value_slice);
-    auto code2 = sharksfin::storage_dispose(storage);
-    if (code != sharksfin::StatusCode::OK || code2 != sharksfin::StatusCode::OK) {
-        return convert(code, code2);
-    }
-    return make_record(table, primary_key, value_slice, record);
+    return status::ok;
 }
 
 status transaction::remove(std::string_view table_name, tateyama::proto::kvs::data::Record const &primary_key,
@@ -243,47 +345,185 @@ status transaction::remove(std::string_view table_name, tateyama::proto::kvs::da
     if (!is_valid_record(primary_key)) {
         return status::err_invalid_argument;
     }
-    std::shared_ptr<yugawara::storage::table const> table{};
-    if (auto s = get_table(db_, table_name, table); s != status::ok) {
+    table_entry *entry{};
+    if (auto s = find_table(table_name, entry); s != status::ok) {
         return s;
     }
-    if (has_secondary_index(table)) {
-        return status::err_not_implemented;
-    }
-    record_columns rec_cols{table, primary_key, true};
+    record_columns rec_cols{entry->table_, primary_key, true};
     if (auto s = check_valid_primary_key(rec_cols); s != status::ok) {
         return s;
     }
-    std::size_t key_size{};
-    if (auto s = get_bufsize(spec_primary_key, rec_cols.primary_keys(), key_size);
-            s != status::ok) {
-        return s;
-    }
-    jogasaki::data::aligned_buffer key_buffer{key_size};
-    jogasaki::kvs::writable_stream key_stream{key_buffer.data(), key_buffer.capacity()};
-    if (auto s = serialize(spec_primary_key, rec_cols.primary_keys(), key_stream);
-        s != status::ok) {
+    std::string_view key{};
+    if (auto s = encode(spec_primary_key, rec_cols.primary_keys(), key_buffer_, key); s != status::ok) {
         return s;
     }
-    sharksfin::StorageHandle storage{};
-    if (auto s = get_storage(table_name, storage); s != status::ok) {
-        return s;
+    if (entry->has_secondary_index_) {
+        return remove_with_secondaries(*entry, key, opt);
     }
-    sharksfin::Slice key_slice {key_stream.data(), key_stream.size()};
+    sharksfin::Slice key_slice {key};
     if (opt == remove_option::counting) {
-        auto code = sharksfin::content_check_exist(tx_handle_, storage, key_slice);
+        auto code = sharksfin::content_check_exist(tx_handle_, entry->storage_, key_slice);
         if (code != sharksfin::StatusCode::OK) {
             // NOT_FOUND, or error
-            auto code2 = sharksfin::storage_dispose(storage);
-            return convert(code, code2);
+            return convert(code);
         }
     }
-    auto code = sharksfin::content_delete(tx_handle_, storage, key_slice);
+    auto code = sharksfin::content_delete(tx_handle_, entry->storage_, key_slice);
     if (opt == remove_option::instant && code == sharksfin::StatusCode::NOT_FOUND) {
         code = sharksfin::StatusCode::OK;
     }
-    auto code2 = sharksfin::storage_dispose(storage);
-    return convert(code, code2);
+    return convert(code);
+}
+
+status transaction::remove_with_secondaries(table_entry &entry, std::string_view key, remove_option opt) {
+    sharksfin::Slice key_slice {key};
+    sharksfin::Slice old_slice{};
+    auto code = sharksfin::content_get(tx_handle_, entry.storage_, key_slice, &old_slice);
+    if (code == sharksfin::StatusCode::NOT_FOUND) {
+        return opt == remove_option::instant ? status::ok : status::not_found;
+    }
+    if (code != sharksfin::StatusCode::OK) {
+        return convert(code);
+    }
+    // the slice is valid only until the next call to the storage, so copy it
+    old_value_buffer_.assign(old_slice.data(), old_slice.size());
+    if (auto s = entry.secondaries_->remove(tx_handle_, key, old_value_buffer_); s != status::ok) {
+        return s;
+    }
+    code = sharksfin::content_delete(tx_handle_, entry.storage_, key_slice);
+    return convert(code);
+}
+
+status transaction::remove(std::string_view table_name,
+                           google::protobuf::RepeatedPtrField<tateyama::proto::kvs::data::Record> const &primary_keys,
+                           remove_option opt, std::size_t &removed) {
+    removed = 0;
+    for (auto &key : primary_keys) {
+        auto s = remove(table_name, key, opt);
+        if (s == status::ok) {
+            ++removed;
+            continue;
+        }
+        if (s == status::not_found) {
+            continue;
+        }
+        // the preceding records are already removed, so abort not to commit the batch partially
+        (void) abort();
+        return s;
+    }
+    return status::ok;
+}
+
+static status encode_end_point(std::shared_ptr<yugawara::storage::table const> &table,
+                               tateyama::proto::kvs::data::Record const &key,
+                               scan_bound bound,
+                               std::string &buffer,
+                               std::string_view &out,
+                               sharksfin::EndPointKind &kind) {
+    if (bound == scan_bound::unbound) {
+        out = {};
+        kind = sharksfin::EndPointKind::UNBOUND;
+        return status::ok;
+    }
+    if (!is_valid_record(key)) {
+        return status::err_invalid_argument;
+    }
+    record_columns rec_cols{table, key, true};
+    if (auto s = check_valid_key_prefix(rec_cols); s != status::ok) {
+        return s;
+    }
+    if (auto s = encode(spec_primary_key, rec_cols.primary_keys(), buffer, out); s != status::ok) {
+        return s;
+    }
+    bool prefixed = rec_cols.primary_keys().size() < rec_cols.table_keys_size();
+    if (bound == scan_bound::inclusive) {
+        kind = prefixed ? sharksfin::EndPointKind::PREFIXED_INCLUSIVE : sharksfin::EndPointKind::INCLUSIVE;
+    } else {
+        kind = prefixed ? sharksfin::EndPointKind::PREFIXED_EXCLUSIVE : sharksfin::EndPointKind::EXCLUSIVE;
+    }
+    return status::ok;
+}
+
+status transaction::scan(std::string_view table_name,
+                         tateyama::proto::kvs::data::Record const &lower_key,
+                         scan_bound lower_bound,
+                         tateyama::proto::kvs::data::Record const &upper_key,
+                         scan_bound upper_bound,
+                         scan_consumer const &consumer,
+                         bool reverse) {
+    // declared before the iterator so that the iterator is disposed under the lock
+    std::unique_lock<std::mutex> lock{mtx_tx_};
+    if (auto s = is_active(); s != status::ok) {
+        return s;
+    }
+    table_entry *entry{};
+    if (auto s = find_table(table_name, entry); s != status::ok) {
+        return s;
+    }
+    // the end point keys are encoded into local buffers, since the member buffers can be reused by other
+    // operations while the lock is released
+    std::string lower_buffer{};
+    std::string_view lower{};
+    sharksfin::EndPointKind lower_kind{};
+    if (auto s = encode_end_point(entry->table_, lower_key, lower_bound, lower_buffer, lower, lower_kind);
+            s != status::ok) {
+        return s;
+    }
+    std::string upper_buffer{};
+    std::string_view upper{};
+    sharksfin::EndPointKind upper_kind{};
+    if (auto s = encode_end_point(entry->table_, upper_key, upper_bound, upper_buffer, upper, upper_kind);
+            s != status::ok) {
+        return s;
+    }
+    sharksfin::IteratorHandle handle{};
+    if (auto code = sharksfin::content_scan(tx_handle_, entry->storage_,
+                sharksfin::Slice{lower}, lower_kind,
+                sharksfin::Slice{upper}, upper_kind,
+                &handle, 0, reverse);
+            code != sharksfin::StatusCode::OK) {
+        return convert(code);
+    }
+    jogasaki::kvs::iterator it{handle};
+    auto table = entry->table_;
+    while (true) {
+        if (auto s = is_active(); s != status::ok) {
+            // committed or aborted while the lock was released
+            return s;
+        }
+        if (auto rc = it.next(); rc != jogasaki::status::ok) {
+            if (rc == jogasaki::status::not_found) {
+                break;
+            }
+            return convert(rc);
+        }
+        std::string_view key{};
+        std::string_view value{};
+        if (auto rc = it.read_key(key); rc != jogasaki::status::ok) {
+            if (rc == jogasaki::status::not_found) {
+                // the entry was removed concurrently
+                continue;
+            }
+            return convert(rc);
+        }
+        if (auto rc = it.read_value(value); rc != jogasaki::status::ok) {
+            if (rc == jogasaki::status::not_found) {
+                continue;
+            }
+            return convert(rc);
+        }
+        tateyama::proto::kvs::data::Record record{};
+        if (auto s = make_record(table, key, value, record); s != status::ok) {
+            return s;
+        }
+        lock.unlock();
+        auto s = consumer(record);
+        lock.lock();
+        if (s != status::ok) {
+            return s;
+        }
+    }
+    return status::ok;
 }
 
 void transaction::set_error_info(tateyama::proto::kvs::response::Error const &error) noexcept {
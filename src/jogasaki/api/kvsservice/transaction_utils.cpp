@@ -17,7 +17,9 @@
 #include "transaction_utils.h"
 
 #include <cstddef>
+#include <memory>
 #include <stdexcept>
+#include <string_view>
 #include <vector>
 
 #include <takatori/type/data.h>
@@ -28,6 +30,7 @@
 #include <takatori/util/reference_list_view.h>
 #include <yugawara/storage/basic_configurable_provider.h>
 #include <yugawara/storage/column.h>
+#include <yugawara/storage/index.h>
 #include <yugawara/variable/criteria.h>
 #include <yugawara/variable/nullity.h>
 
@@ -189,6 +192,24 @@ status check_put_record(record_columns &rec_cols) {
     return check_valid_values(rec_cols);
 }
 
+status check_valid_key_prefix(record_columns &rec_cols) {
+    if (auto s = check_valid_reccols(rec_cols); s != status::ok) {
+        return s;
+    }
+    auto const& keys = rec_cols.primary_keys();
+    if (keys.size() != static_cast<std::size_t>(rec_cols.record().names_size())) {
+        return status::err_invalid_argument;
+    }
+    auto const& table = *rec_cols.table();
+    auto primary = table.owner()->find_primary_index(table);
+    for (std::size_t i = 0, n = keys.size(); i < n; ++i) {
+        if (keys[i].column() != std::addressof(primary->keys()[i].column())) {
+            return status::err_invalid_argument;
+        }
+    }
+    return check_valid_columns(keys);
+}
+
 static void add_key_column(std::string_view col_name,
                        tateyama::proto::kvs::data::Value const*value,
                        tateyama::proto::kvs::data::Record &record) {
@@ -197,18 +218,25 @@ static void add_key_column(std::string_view col_name,
     new_value->CopyFrom(*value);
 }
 
-static status add_value_column(yugawara::storage::column const &column,
+static status add_column(jogasaki::kvs::coding_spec const &spec,
+                         yugawara::storage::column const &column,
                          jogasaki::kvs::readable_stream &stream,
                          tateyama::proto::kvs::data::Record &record) {
     record.add_names(column.simple_name().data(), column.simple_name().size());
     auto new_value = record.add_values();
-    if (auto s = deserialize(spec_value, column, stream, new_value);
+    if (auto s = deserialize(spec, column, stream, new_value);
             s != status::ok) {
         return s;
     }
     return status::ok;
 }
 
+static status add_value_column(yugawara::storage::column const &column,
+                         jogasaki::kvs::readable_stream &stream,
+                         tateyama::proto::kvs::data::Record &record) {
+    return add_column(spec_value, column, stream, record);
+}
+
 status make_record(std::shared_ptr<yugawara::storage::table const> &table,
                           tateyama::proto::kvs::data::Record const &primary_key,
                           sharksfin::Slice const &value_slice,
@@ -230,4 +258,24 @@ status make_record(std::shared_ptr<yugawara::storage::table const> &table,
     return status::ok;
 }
 
+status make_record(std::shared_ptr<yugawara::storage::table const> &table,
+                  std::string_view key,
+                  std::string_view value,
+                  tateyama::proto::kvs::data::Record &record) {
+    auto primary = table->owner()->find_primary_index(*table);
+    jogasaki::kvs::readable_stream key_stream{key.data(), key.size()};
+    for (auto &key_col : primary->keys()) {
+        if (auto s = add_column(spec_primary_key, key_col.column(), key_stream, record); s != status::ok) {
+            return s;
+        }
+    }
+    jogasaki::kvs::readable_stream value_stream{value.data(), value.size()};
+    for (auto &value_col : primary->values()) {
+        if (auto s = add_value_column(value_col.get(), value_stream, record); s != status::ok) {
+            return s;
+        }
+    }
+    return status::ok;
+}
+
 }
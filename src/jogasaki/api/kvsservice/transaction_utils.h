@@ -81,6 +81,18 @@ status check_put_record(record_columns &rec_cols);
  */
 status check_valid_primary_key(record_columns &rec_cols);
 
+/**
+ * @brief check whether the key is valid as the leading part of the primary key of the table
+ * @details this is used for the end point keys of range scan, which may omit the trailing primary key columns.
+ * @param rec_cols list of columns as a primary key prefix
+ * @return status::ok if succeeded
+ * @return status::err_invalid_argument if the record has non-key columns or lacks the leading key columns
+ * @return status::err_column_not_found if the record has invalid name of the column
+ * @return status::err_column_type_mismatch if the column data type is different from the table schema
+ * @return otherwise if error was occurred
+ */
+status check_valid_key_prefix(record_columns &rec_cols);
+
 /**
  * @brief make a record with the primary key and values
  * @param table the schema of the table
@@ -96,6 +108,21 @@ status make_record(std::shared_ptr<yugawara::storage::table const> &table,
                   sharksfin::Slice const &value_slice,
                   tateyama::proto::kvs::data::Record &record);
 
+/**
+ * @brief make a record from the key/value entry read from the primary index
+ * @param table the schema of the table
+ * @param key the encoded primary key
+ * @param value the encoded values
+ * @param record [out]the record with the primary key and values
+ * @return status::ok if succeeded
+ * @return status::err_invalid_argument if deserialize the key or value failed
+ * @return otherwise if error was occurred
+ */
+status make_record(std::shared_ptr<yugawara::storage::table const> &table,
+                  std::string_view key,
+                  std::string_view value,
+                  tateyama::proto::kvs::data::Record &record);
+
 constexpr jogasaki::kvs::coding_spec spec_primary_key = jogasaki::kvs::spec_key_ascending;
 constexpr jogasaki::kvs::coding_spec spec_value = jogasaki::kvs::spec_value;
 
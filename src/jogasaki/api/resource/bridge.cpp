@@ -319,6 +319,15 @@ static bool process_sql_config(std::shared_ptr<jogasaki::configuration>& ret, ta
         }
         ret->key_distribution(static_cast<key_distribution_kind>(idx));
     }
+    if (auto v = jogasaki_config->get<std::size_t>("dev_rtx_key_distribution_sample_count")) {
+        ret->key_distribution_sample_count(v.value());
+    }
+    if (auto v = jogasaki_config->get<std::size_t>("dev_rtx_key_distribution_max_scan_entries")) {
+        ret->key_distribution_max_scan_entries(v.value());
+    }
+    if (auto v = jogasaki_config->get<std::size_t>("dev_rtx_key_distribution_refresh_interval_ms")) {
+        ret->key_distribution_refresh_interval_ms(v.value());
+    }
     if (auto v = jogasaki_config->get<std::size_t>("dev_initial_core")) {
         ret->initial_core(v.value());
     }
@@ -352,6 +361,42 @@ static bool process_sql_config(std::shared_ptr<jogasaki::configuration>& ret, ta
     if (auto v = jogasaki_config->get<bool>("dev_enable_truncate")) {
         ret->enable_truncate(v.value());
     }
+    if (auto v = jogasaki_config->get<std::size_t>("dev_exchange_spill_threshold")) {
+        ret->exchange_spill_threshold(v.value());
+    }
+    if (auto v = jogasaki_config->get<std::size_t>("dev_exchange_spill_memory_percentage")) {
+        ret->exchange_spill_memory_percentage(v.value());
+    }
+    if (auto v = jogasaki_config->get<std::string>("dev_spill_directory")) {
+        ret->spill_directory(v.value());
+    }
+    if (auto v = jogasaki_config->get<std::size_t>("dev_memory_limit")) {
+        ret->memory_limit(v.value());
+    }
+    if (auto v = jogasaki_config->get<std::size_t>("dev_request_memory_limit")) {
+        ret->request_memory_limit(v.value());
+    }
+    if (auto v = jogasaki_config->get<std::size_t>("dev_memory_admission_percentage")) {
+        ret->memory_admission_percentage(v.value());
+    }
+    if (auto v = jogasaki_config->get<bool>("dev_direct_load")) {
+        ret->direct_load(v.value());
+    }
+    if (auto v = jogasaki_config->get<std::size_t>("dev_join_find_probe_cache_size")) {
+        ret->join_find_probe_cache_size(v.value());
+    }
+    if (auto v = jogasaki_config->get<bool>("dev_enable_broadcast_join")) {
+        ret->enable_broadcast_join(v.value());
+    }
+    if (auto v = jogasaki_config->get<bool>("dev_enable_scan_range_split")) {
+        ret->enable_scan_range_split(v.value());
+    }
+    if (auto v = jogasaki_config->get<std::size_t>("dev_sequence_cache_size")) {
+        ret->sequence_cache_size(v.value());
+    }
+    if (auto v = jogasaki_config->get<std::size_t>("dev_prepared_statement_cache_size")) {
+        ret->prepared_statement_cache_size(v.value());
+    }
     return true;
 }
 
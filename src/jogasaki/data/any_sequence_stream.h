@@ -68,6 +68,18 @@ public:
         any_sequence& sequence,
         std::optional<std::chrono::milliseconds> timeout) = 0;
 
+    /**
+     * @brief returns whether the next try_next() is expected to return other than status_type::not_ready
+     * @details this is used by the consumer to wait for the data without polling try_next().
+     * This function can be called from a thread other than the one calling try_next().
+     * The default implementation returns true, which makes the consumer fall back to polling.
+     * @return true if the next sequence, end of stream or error is available, or the stream cannot tell it
+     * @return false if the next sequence is not yet available
+     */
+    [[nodiscard]] virtual bool ready() {
+        return true;
+    }
+
     /**
      * @brief closes the stream and releases associated resources.
      */
@@ -0,0 +1,147 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "key_histogram.h"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace jogasaki::dist {
+
+static bool starts_with(std::string_view key, std::string_view prefix) noexcept {
+    return key.substr(0, prefix.size()) == prefix;
+}
+
+static bool after_begin(key_range const& range, std::string_view key) noexcept {
+    auto b = range.begin_key();
+    switch(range.begin_endpoint()) {
+        case kvs::end_point_kind::unbound: return true;
+        case kvs::end_point_kind::inclusive: return key >= b;
+        case kvs::end_point_kind::exclusive: return key > b;
+        case kvs::end_point_kind::prefixed_inclusive: return key >= b;
+        case kvs::end_point_kind::prefixed_exclusive: return key > b && ! starts_with(key, b);
+    }
+    return true;
+}
+
+static bool before_end(key_range const& range, std::string_view key) noexcept {
+    auto e = range.end_key();
+    switch(range.end_endpoint()) {
+        case kvs::end_point_kind::unbound: return true;
+        case kvs::end_point_kind::inclusive: return key <= e;
+        case kvs::end_point_kind::exclusive: return key < e;
+        case kvs::end_point_kind::prefixed_inclusive: return key <= e || starts_with(key, e);
+        case kvs::end_point_kind::prefixed_exclusive: return key < e;
+    }
+    return true;
+}
+
+bool contains(key_range const& range, std::string_view key) noexcept {
+    return after_begin(range, key) && before_end(range, key);
+}
+
+key_histogram::key_histogram(
+    std::vector<std::string> samples,
+    std::size_t entry_count,
+    std::size_t key_bytes,
+    std::size_t value_bytes,
+    clock::time_point built_at,
+    bool complete
+) :
+    samples_(std::move(samples)),
+    entry_count_(entry_count),
+    key_bytes_(key_bytes),
+    value_bytes_(value_bytes),
+    built_at_(built_at),
+    complete_(complete)
+{
+    std::sort(samples_.begin(), samples_.end());
+}
+
+std::size_t key_histogram::entry_count() const noexcept {
+    return entry_count_;
+}
+
+std::vector<std::string> const& key_histogram::samples() const noexcept {
+    return samples_;
+}
+
+key_histogram::clock::time_point key_histogram::built_at() const noexcept {
+    return built_at_;
+}
+
+bool key_histogram::complete() const noexcept {
+    return complete_;
+}
+
+std::pair<std::size_t, std::size_t> key_histogram::samples_in(key_range const& range) const noexcept {
+    // the range is an interval in the key order, so the samples within it are contiguous
+    auto first = std::partition_point(samples_.begin(), samples_.end(), [&](auto const& s) {
+        return ! after_begin(range, s);
+    });
+    auto last = std::partition_point(first, samples_.end(), [&](auto const& s) {
+        return before_end(range, s);
+    });
+    return {
+        static_cast<std::size_t>(std::distance(samples_.begin(), first)),
+        static_cast<std::size_t>(std::distance(samples_.begin(), last))
+    };
+}
+
+double key_histogram::estimate_count(key_range const& range) const noexcept {
+    if(samples_.empty()) {
+        return 0.0;
+    }
+    auto [first, last] = samples_in(range);
+    return static_cast<double>(entry_count_) * static_cast<double>(last - first) / static_cast<double>(samples_.size());
+}
+
+double key_histogram::average_key_size() const noexcept {
+    if(entry_count_ == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(key_bytes_) / static_cast<double>(entry_count_);
+}
+
+double key_histogram::average_value_size() const noexcept {
+    if(entry_count_ == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(value_bytes_) / static_cast<double>(entry_count_);
+}
+
+std::vector<std::string> key_histogram::compute_pivots(std::size_t max_count, key_range const& range) const {
+    auto [first, last] = samples_in(range);
+    auto n = last - first;
+    auto count = std::min(max_count, n);
+    std::vector<std::string> ret{};
+    ret.reserve(count);
+    for(std::size_t i = 0; i < count; ++i) {
+        // pick the samples at equal intervals so that each part holds the same number of samples
+        auto const& s = samples_[first + (i + 1) * n / (count + 1)];
+        if(range.begin_endpoint() != kvs::end_point_kind::unbound && s == range.begin_key()) {
+            // pivot at the begin key produces an empty part
+            continue;
+        }
+        if(! ret.empty() && ret.back() == s) {
+            continue;
+        }
+        ret.emplace_back(s);
+    }
+    return ret;
+}
+
+}  // namespace jogasaki::dist
@@ -0,0 +1,124 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <jogasaki/dist/key_range.h>
+
+namespace jogasaki::dist {
+
+/**
+ * @brief equi-depth histogram of the keys on an index
+ * @details the histogram holds the keys sampled uniformly from the index in sorted order, together with the
+ * total number of entries and their average key/value sizes. Because each sample represents the same number of
+ * entries, the number of samples within a range is proportional to the number of entries in the range, and the
+ * samples are used as pivots to split the range into the parts of similar sizes regardless of the key skew.
+ * If the scan building the histogram stopped before reaching the end of the index, the histogram is incomplete.
+ * It keeps no samples and only tells that the index has at least `entry_count` entries.
+ */
+class key_histogram {
+public:
+    using clock = std::chrono::steady_clock;
+
+    /**
+     * @brief create empty object
+     */
+    key_histogram() = default;
+
+    /**
+     * @brief create new object
+     * @param samples the sampled keys, which need not be sorted
+     * @param entry_count the number of entries on the index
+     * @param key_bytes the total bytes of the keys on the index
+     * @param value_bytes the total bytes of the values on the index
+     * @param built_at the time when the samples are taken
+     * @param complete whether the samples are taken from all entries on the index
+     */
+    key_histogram(
+        std::vector<std::string> samples,
+        std::size_t entry_count,
+        std::size_t key_bytes,
+        std::size_t value_bytes,
+        clock::time_point built_at = clock::now(),
+        bool complete = true
+    );
+
+    /**
+     * @brief returns the number of entries on the index when the histogram is built
+     */
+    [[nodiscard]] std::size_t entry_count() const noexcept;
+
+    /**
+     * @brief returns the sorted samples
+     */
+    [[nodiscard]] std::vector<std::string> const& samples() const noexcept;
+
+    /**
+     * @brief returns the time when the histogram is built
+     */
+    [[nodiscard]] clock::time_point built_at() const noexcept;
+
+    /**
+     * @brief returns whether the samples are taken from all entries on the index
+     */
+    [[nodiscard]] bool complete() const noexcept;
+
+    /**
+     * @brief estimate the number of entries in the range
+     */
+    [[nodiscard]] double estimate_count(key_range const& range) const noexcept;
+
+    /**
+     * @brief returns the average key size on the index
+     */
+    [[nodiscard]] double average_key_size() const noexcept;
+
+    /**
+     * @brief returns the average value size on the index
+     */
+    [[nodiscard]] double average_value_size() const noexcept;
+
+    /**
+     * @brief compute the pivots that split the range into the parts holding similar number of entries
+     * @param max_count maximum count of the pivots
+     * @param range the range on index
+     * @return the sorted pivots within the range, excluding the begin key of the range
+     */
+    [[nodiscard]] std::vector<std::string> compute_pivots(std::size_t max_count, key_range const& range) const;
+
+private:
+    std::vector<std::string> samples_{};
+    std::size_t entry_count_{};
+    std::size_t key_bytes_{};
+    std::size_t value_bytes_{};
+    clock::time_point built_at_{};
+    bool complete_{true};
+
+    [[nodiscard]] std::pair<std::size_t, std::size_t> samples_in(key_range const& range) const noexcept;
+};
+
+/**
+ * @brief returns whether the key is within the range
+ */
+[[nodiscard]] bool contains(key_range const& range, std::string_view key) noexcept;
+
+}  // namespace jogasaki::dist
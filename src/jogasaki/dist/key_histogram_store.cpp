@@ -0,0 +1,118 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "key_histogram_store.h"
+
+#include <string>
+#include <utility>
+
+namespace jogasaki::dist {
+
+std::shared_ptr<key_histogram const> key_histogram_store::find(std::string_view storage_key) const {
+    std::lock_guard lk{mutex_};
+    if(auto it = entity_.find(std::string{storage_key}); it != entity_.end()) {
+        return it->second;
+    }
+    return {};
+}
+
+status key_histogram_store::find_or_build(
+    std::string_view storage_key,
+    std::chrono::milliseconds refresh_interval,
+    builder_type const& build,
+    std::shared_ptr<key_histogram const>& out
+) {
+    std::string key{storage_key};
+    {
+        std::unique_lock lk{mutex_};
+        while(true) {
+            std::shared_ptr<key_histogram const> current{};
+            if(auto it = entity_.find(key); it != entity_.end()) {
+                current = it->second;
+            }
+            if(current && key_histogram::clock::now() - current->built_at() <= refresh_interval) {
+                out = std::move(current);
+                return status::ok;
+            }
+            if(building_.count(key) == 0) {
+                break;
+            }
+            if(current) {
+                // other thread is refreshing the histogram - use the stale one meanwhile
+                out = std::move(current);
+                return status::ok;
+            }
+            built_.wait(lk);
+        }
+        building_.emplace(key, true);
+    }
+    std::shared_ptr<key_histogram const> h{};
+    status res{};
+    try {
+        res = build(h);
+    } catch (...) {
+        finish_build(key, nullptr);
+        throw;
+    }
+    finish_build(key, res == status::ok ? h : nullptr);
+    if(res == status::ok) {
+        out = std::move(h);
+    }
+    return res;
+}
+
+void key_histogram_store::finish_build(std::string const& key, std::shared_ptr<key_histogram const> histogram) {
+    {
+        std::lock_guard lk{mutex_};
+        if(auto it = building_.find(key); it != building_.end()) {
+            if(histogram && it->second) {
+                entity_[key] = std::move(histogram);
+            }
+            building_.erase(it);
+        }
+    }
+    built_.notify_all();
+}
+
+void key_histogram_store::put(std::string_view storage_key, std::shared_ptr<key_histogram const> histogram) {
+    std::lock_guard lk{mutex_};
+    entity_[std::string{storage_key}] = std::move(histogram);
+}
+
+void key_histogram_store::remove(std::string_view storage_key) {
+    std::lock_guard lk{mutex_};
+    std::string key{storage_key};
+    entity_.erase(key);
+    if(auto it = building_.find(key); it != building_.end()) {
+        // the storage is gone - discard the histogram being built
+        it->second = false;
+    }
+}
+
+void key_histogram_store::clear() {
+    std::lock_guard lk{mutex_};
+    entity_.clear();
+    for(auto&& [key, wanted] : building_) {
+        (void) key;
+        wanted = false;
+    }
+}
+
+std::size_t key_histogram_store::size() const {
+    std::lock_guard lk{mutex_};
+    return entity_.size();
+}
+
+}  // namespace jogasaki::dist
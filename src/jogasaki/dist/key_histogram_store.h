@@ -0,0 +1,108 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <jogasaki/dist/key_histogram.h>
+#include <jogasaki/status.h>
+
+namespace jogasaki::dist {
+
+/**
+ * @brief store of the key histograms shared across the transactions
+ * @details the histograms are kept per storage key so that the sampling cost is paid once and reused by
+ * subsequent scans until they are refreshed. This object is thread-safe.
+ */
+class key_histogram_store {
+public:
+    /**
+     * @brief create empty object
+     */
+    key_histogram_store() = default;
+
+    /**
+     * @brief find the histogram for the storage
+     * @param storage_key the storage key of the index
+     * @return the histogram, or nullptr if it's not found
+     */
+    [[nodiscard]] std::shared_ptr<key_histogram const> find(std::string_view storage_key) const;
+
+    /**
+     * @brief the function to build the histogram
+     */
+    using builder_type = std::function<status(std::shared_ptr<key_histogram const>&)>;
+
+    /**
+     * @brief find the histogram for the storage, building it if it's missing or older than the refresh interval
+     * @details only one caller builds the histogram for the same storage at a time. While it's being built, other
+     * callers use the stale histogram if any, or wait for the build to complete otherwise.
+     * @param storage_key the storage key of the index
+     * @param refresh_interval the histogram older than this is rebuilt
+     * @param build the function to build the histogram, called without holding the lock of this object
+     * @param out [out] the histogram
+     * @return status::ok if the operation is successful
+     * @return otherwise, the status returned by `build`
+     */
+    status find_or_build(
+        std::string_view storage_key,
+        std::chrono::milliseconds refresh_interval,
+        builder_type const& build,
+        std::shared_ptr<key_histogram const>& out
+    );
+
+    /**
+     * @brief add or replace the histogram for the storage
+     * @param storage_key the storage key of the index
+     * @param histogram the histogram to store
+     */
+    void put(std::string_view storage_key, std::shared_ptr<key_histogram const> histogram);
+
+    /**
+     * @brief remove the histogram for the storage so that it's rebuilt on the next use
+     * @param storage_key the storage key of the index
+     */
+    void remove(std::string_view storage_key);
+
+    /**
+     * @brief remove all histograms
+     */
+    void clear();
+
+    /**
+     * @brief returns the number of histograms stored
+     */
+    [[nodiscard]] std::size_t size() const;
+
+private:
+    mutable std::mutex mutex_{};
+    std::condition_variable built_{};
+    std::unordered_map<std::string, std::shared_ptr<key_histogram const>> entity_{};
+    // storages whose histograms are being built, mapped to whether the result is still wanted
+    std::unordered_map<std::string, bool> building_{};
+
+    void finish_build(std::string const& key, std::shared_ptr<key_histogram const> histogram);
+};
+
+}  // namespace jogasaki::dist
@@ -0,0 +1,222 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sampling_key_distribution.h"
+
+#include <random>
+#include <sstream>
+#include <utility>
+#include <glog/logging.h>
+
+#include <jogasaki/kvs/iterator.h>
+#include <jogasaki/logging.h>
+#include <jogasaki/logging_helper.h>
+#include <jogasaki/utils/binary_printer.h>
+
+namespace jogasaki::dist {
+
+sampling_key_distribution::sampling_key_distribution(
+    kvs::storage& stg,
+    kvs::transaction& tx,
+    std::string_view storage_key,
+    key_histogram_store& store,
+    std::size_t sample_count,
+    std::size_t max_scan_entries,
+    std::chrono::milliseconds refresh_interval,
+    request_context* req_ctx
+) :
+    stg_(std::addressof(stg)),
+    tx_(std::addressof(tx)),
+    storage_key_(storage_key),
+    store_(std::addressof(store)),
+    sample_count_(sample_count),
+    max_scan_entries_(max_scan_entries),
+    refresh_interval_(refresh_interval),
+    fallback_(std::make_unique<uniform_key_distribution>(stg, tx, req_ctx))
+{}
+
+std::optional<double> sampling_key_distribution::estimate_count(range_type const& range) {
+    auto h = complete_histogram();
+    if(! h) {
+        return fallback_->estimate_count(range);
+    }
+    return h->estimate_count(range);
+}
+
+std::optional<double> sampling_key_distribution::estimate_key_size(range_type const& range) {
+    auto h = complete_histogram();
+    if(! h) {
+        return fallback_->estimate_key_size(range);
+    }
+    if(h->entry_count() == 0) {
+        return std::nullopt;
+    }
+    return h->average_key_size();
+}
+
+std::optional<double> sampling_key_distribution::estimate_value_size(range_type const& range) {
+    auto h = complete_histogram();
+    if(! h) {
+        return fallback_->estimate_value_size(range);
+    }
+    if(h->entry_count() == 0) {
+        return std::nullopt;
+    }
+    return h->average_value_size();
+}
+
+std::shared_ptr<key_histogram const> sampling_key_distribution::complete_histogram() {
+    std::shared_ptr<key_histogram const> h{};
+    if(auto res = histogram(h); res != status::ok || ! h->complete()) {
+        return {};
+    }
+    return h;
+}
+
+status sampling_key_distribution::sample(std::shared_ptr<key_histogram const>& out) {
+    std::unique_ptr<kvs::iterator> it{};
+    if(auto res = stg_->content_scan(
+            *tx_,
+            "",
+            kvs::end_point_kind::unbound,
+            "",
+            kvs::end_point_kind::unbound,
+            it
+        ); res != status::ok) {
+        return res;
+    }
+    // reservoir sampling - each entry is sampled with the same probability in a single pass
+    std::vector<std::string> samples{};
+    samples.reserve(sample_count_);
+    std::mt19937_64 rng{}; // fixed seed to make the pivots reproducible for the same data
+    std::size_t count = 0;
+    std::size_t key_bytes = 0;
+    std::size_t sampled_values = 0;
+    std::size_t sampled_value_bytes = 0;
+    while(true) {
+        if(max_scan_entries_ != 0 && count >= max_scan_entries_) {
+            // the index is too large to sample - keep the incomplete result so that the scan is not repeated
+            // until the refresh interval passes
+            out = std::make_shared<key_histogram const>(
+                std::vector<std::string>{},
+                count,
+                key_bytes,
+                0,
+                key_histogram::clock::now(),
+                false
+            );
+            VLOG_LP(log_debug) << "key histogram is incomplete storage_key:" << utils::binary_printer{storage_key_}
+                               << " visited entries:" << count;
+            return status::ok;
+        }
+        if(auto res = it->next(); res != status::ok) {
+            if(res == status::not_found) {
+                break;
+            }
+            return res;
+        }
+        std::string_view k{};
+        if(auto res = it->read_key(k); res != status::ok) {
+            if(res == status::not_found) {
+                // the entry is deleted concurrently
+                continue;
+            }
+            return res;
+        }
+        ++count;
+        key_bytes += k.size();
+        std::size_t pos = samples.size();
+        if(samples.size() >= sample_count_) {
+            pos = rng() % count;
+            if(pos >= sample_count_) {
+                continue;
+            }
+        }
+        // values are read only for the sampled entries
+        std::string_view v{};
+        if(auto res = it->read_value(v); res == status::ok) {
+            ++sampled_values;
+            sampled_value_bytes += v.size();
+        } else if(res != status::not_found) {
+            return res;
+        }
+        if(pos == samples.size()) {
+            samples.emplace_back(k);
+        } else {
+            samples[pos] = k;
+        }
+    }
+    auto value_bytes = sampled_values == 0 ? 0 :
+        static_cast<std::size_t>(static_cast<double>(sampled_value_bytes) / sampled_values * count);
+    out = std::make_shared<key_histogram const>(std::move(samples), count, key_bytes, value_bytes);
+    VLOG_LP(log_debug) << "key histogram built storage_key:" << utils::binary_printer{storage_key_}
+                       << " entries:" << count << " samples:" << out->samples().size();
+    return status::ok;
+}
+
+status sampling_key_distribution::histogram(std::shared_ptr<key_histogram const>& out) {
+    if(histogram_) {
+        out = histogram_;
+        return status::ok;
+    }
+    std::shared_ptr<key_histogram const> h{};
+    if(auto res = store_->find_or_build(
+            storage_key_,
+            refresh_interval_,
+            [this](std::shared_ptr<key_histogram const>& built) {
+                return sample(built);
+            },
+            h
+        ); res != status::ok) {
+        VLOG_LP(log_warning) << "building key histogram failed storage_key:" << utils::binary_printer{storage_key_}
+                             << " status:" << res;
+        return res;
+    }
+    histogram_ = h;
+    out = std::move(h);
+    return status::ok;
+}
+
+std::vector<sampling_key_distribution::pivot_type> sampling_key_distribution::compute_pivots(
+    size_type max_count,
+    range_type const& range
+) {
+    auto h = complete_histogram();
+    if(! h) {
+        return fallback_->compute_pivots(max_count, range);
+    }
+    auto pivots = h->compute_pivots(max_count, range);
+
+    if(VLOG_IS_ON(log_debug)) {
+        std::stringstream ss{};
+        ss << "pivot_count:" << pivots.size();
+        ss << " pivots:[";
+        bool first = true;
+        for(auto&& p : pivots) {
+            if(! first) {
+                ss << ",";
+            }
+            ss << "\"";
+            ss << utils::binary_printer{p.data(), p.size()};
+            ss << "\"";
+            first = false;
+        }
+        ss << "]";
+        VLOG_LP(log_debug) << ss.str();
+    }
+    return pivots;
+}
+
+}  // namespace jogasaki::dist
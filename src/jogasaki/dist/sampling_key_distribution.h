@@ -0,0 +1,124 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <jogasaki/dist/key_distribution.h>
+#include <jogasaki/dist/key_histogram.h>
+#include <jogasaki/dist/key_histogram_store.h>
+#include <jogasaki/dist/uniform_key_distribution.h>
+#include <jogasaki/kvs/storage.h>
+#include <jogasaki/kvs/transaction.h>
+#include <jogasaki/request_context.h>
+#include <jogasaki/status.h>
+
+namespace jogasaki::dist {
+
+/**
+ * @brief key_distribution subclass based on the histogram of sampled keys
+ * @details This class samples keys from the index and computes the estimates and pivots from the equi-depth
+ * histogram, so that the pivots follow the actual key distribution even if the keys are skewed.
+ * The histogram is shared via key_histogram_store, and rebuilt by scanning the index if it's not found
+ * or older than the refresh interval. Only one scan runs for the same index at a time.
+ * The scan runs in the caller's transaction, which must be read-only, so the sampled reads are neither recorded
+ * nor able to fail the transaction. The scan reads keys only, and values are read just for the sampled entries
+ * to estimate the value size.
+ * The scan stops after visiting `max_scan_entries` entries so that the cost is bounded for large indices.
+ * If the histogram is not available or the scan stopped early, the estimates and pivots are computed by
+ * uniform_key_distribution instead.
+ */
+class sampling_key_distribution : public key_distribution {
+public:
+
+    using size_type  = key_distribution::size_type;
+    using range_type = key_distribution::range_type;
+    using pivot_type = key_distribution::pivot_type;
+
+    sampling_key_distribution() = default;
+
+    ~sampling_key_distribution() override = default;
+
+    sampling_key_distribution(sampling_key_distribution const&) = delete;
+    sampling_key_distribution& operator=(sampling_key_distribution const&) = delete;
+    sampling_key_distribution(sampling_key_distribution&&) = delete;
+    sampling_key_distribution& operator=(sampling_key_distribution&&) = delete;
+
+    /**
+     * @brief create new object
+     * @param stg the storage of the index
+     * @param tx the read-only transaction to sample the keys
+     * @param storage_key the storage key of the index, used to identify the histogram in the store
+     * @param store the store to share the histogram
+     * @param sample_count the number of keys sampled to build the histogram
+     * @param max_scan_entries the max number of entries visited to build the histogram (0 means unlimited)
+     * @param refresh_interval the histogram older than this is rebuilt
+     * @param req_ctx the request context passed to the fallback uniform_key_distribution
+     */
+    sampling_key_distribution(
+        kvs::storage& stg,
+        kvs::transaction& tx,
+        std::string_view storage_key,
+        key_histogram_store& store,
+        std::size_t sample_count,
+        std::size_t max_scan_entries,
+        std::chrono::milliseconds refresh_interval,
+        request_context* req_ctx = nullptr
+    );
+
+    [[nodiscard]] std::optional<double> estimate_count(range_type const& range) override;
+
+    [[nodiscard]] std::optional<double> estimate_key_size(range_type const& range) override;
+
+    [[nodiscard]] std::optional<double> estimate_value_size(range_type const& range) override;
+
+    [[nodiscard]] std::vector<pivot_type> compute_pivots(size_type max_count, range_type const& range) override;
+
+    /**
+     * @brief returns the histogram, building it if necessary
+     * @param out[out] the histogram
+     * @return status::ok if the operation is successful
+     * @return otherwise, status code from the kvs scan
+     * @note the function is public for testing
+     */
+    status histogram(std::shared_ptr<key_histogram const>& out);
+
+private:
+    kvs::storage* stg_{};
+    kvs::transaction* tx_{};
+    std::string storage_key_{};
+    key_histogram_store* store_{};
+    std::size_t sample_count_{};
+    std::size_t max_scan_entries_{};
+    std::chrono::milliseconds refresh_interval_{};
+    std::shared_ptr<key_histogram const> histogram_{};
+    std::unique_ptr<uniform_key_distribution> fallback_{};
+
+    status sample(std::shared_ptr<key_histogram const>& out);
+
+    /**
+     * @brief returns the complete histogram, or nullptr if the fallback should be used
+     */
+    std::shared_ptr<key_histogram const> complete_histogram();
+};
+
+}  // namespace jogasaki::dist
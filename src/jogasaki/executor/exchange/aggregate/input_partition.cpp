@@ -15,8 +15,11 @@
  */
 #include "input_partition.h"
 
+#include <algorithm>
 #include <functional>
+#include <queue>
 #include <type_traits>
+#include <glog/logging.h>
 
 #include <takatori/util/maybe_shared_ptr.h>
 #include <takatori/util/sequence_view.h>
@@ -28,12 +31,54 @@
 #include <jogasaki/executor/comparator.h>
 #include <jogasaki/executor/exchange/aggregate/aggregate_info.h>
 #include <jogasaki/executor/exchange/shuffle/pointer_table.h>
+#include <jogasaki/executor/exchange/shuffle/spilled_run.h>
 #include <jogasaki/executor/function/incremental/aggregator_info.h>
 #include <jogasaki/executor/hash.h>
+#include <jogasaki/logging.h>
+#include <jogasaki/logging_helper.h>
+#include <jogasaki/memory/memory_tracker.h>
 #include <jogasaki/utils/copy_field_data.h>
+#include <jogasaki/utils/iterator_pair.h>
 
 namespace jogasaki::executor::exchange::aggregate {
 
+spilled_run_pair::spilled_run_pair(
+    std::unique_ptr<shuffle::spilled_run> keys,
+    std::unique_ptr<shuffle::spilled_run> values,
+    std::size_t pointer_field_offset
+) noexcept :
+    keys_(std::move(keys)),
+    values_(std::move(values)),
+    pointer_field_offset_(pointer_field_offset)
+{}
+
+bool spilled_run_pair::next() {
+    if(! keys_->next() || ! values_->next()) {
+        return false;
+    }
+    // the pointer read from the file is stale - re-link the key to the value read together
+    accessor::record_ref key{keys_->current(), pointer_field_offset_ + sizeof(void*)};
+    key.set_value<void*>(pointer_field_offset_, values_->current());
+    return true;
+}
+
+void* spilled_run_pair::key() const noexcept {
+    return keys_->current();
+}
+
+void* spilled_run_pair::value() const noexcept {
+    return values_->current();
+}
+
+void spilled_run_pair::rewind() {
+    keys_->rewind();
+    values_->rewind();
+}
+
+std::size_t spilled_run_pair::count() const noexcept {
+    return keys_->count();
+}
+
 input_partition::input_partition(
     std::unique_ptr<memory::paged_memory_resource> resource_for_keys,
     std::unique_ptr<memory::paged_memory_resource> resource_for_values,
@@ -92,6 +137,10 @@ bool input_partition::write(accessor::record_ref record) {
         }
         auto& table = pointer_tables_.back();
         table.emplace_back(key.data());
+        if(spill_threshold_ != 0) {
+            bytes_in_memory_ += shuffle::spilled_run::record_bytes(*key_meta, key) +
+                value_meta->record_size() + sizeof(bucket_type) + sizeof(key_pointer);
+        }
     }
     auto& info = info_->pre();
     for(std::size_t i=0, n = info.aggregator_specs().size(); i < n; ++i) {
@@ -106,7 +155,7 @@ bool input_partition::write(accessor::record_ref record) {
             values_->varlen_resource()
         );
     }
-    if (hash_table_->load_factor() > load_factor_bound) {
+    if (hash_table_->load_factor() > load_factor_bound || spill_required()) {
         flush();
         return true;
     }
@@ -147,6 +196,141 @@ void input_partition::flush() {
             accessor::record_ref(y, sz)) < 0;
     });
     hash_table_->clear();
+    if(spill_required() || memory_pressured()) {
+        spill();
+    }
+}
+
+bool input_partition::spill_required() const noexcept {
+    return spill_threshold_ != 0 && ! spill_disabled_ && spill_threshold_ <= bytes_in_memory_;
+}
+
+bool input_partition::memory_pressured() const noexcept {
+    return spill_threshold_ != 0 && ! spill_disabled_ && bytes_in_memory_ != 0 && tracker_ &&
+        tracker_->reaches_with_ancestors(spill_memory_percentage_);
+}
+
+void input_partition::spill() {
+    using iterator_pair = utils::iterator_pair<table_iterator>;
+    auto& key_meta = info_->pre().group_meta()->key_shared();
+    auto& value_meta = info_->pre().group_meta()->value_shared();
+    auto key_size = key_meta->record_size();
+    auto value_size = value_meta->record_size();
+    auto pointer_field_offset = key_meta->value_offset(key_meta->field_count()-1);
+    auto greater = [&](iterator_pair const& x, iterator_pair const& y) {
+        return comparator_(accessor::record_ref(*x.first, key_size), accessor::record_ref(*y.first, key_size)) > 0;
+    };
+    std::priority_queue<iterator_pair, std::vector<iterator_pair>, decltype(greater)> queue{greater};
+    for(auto& t : pointer_tables_) {
+        if(t.begin() != t.end()) {
+            queue.emplace(t.begin(), t.end());
+        }
+    }
+    auto keys = std::make_unique<shuffle::spilled_run>(key_meta, shuffle::spilled_run::create_path(spill_directory_));
+    auto values = std::make_unique<shuffle::spilled_run>(value_meta, shuffle::spilled_run::create_path(spill_directory_));
+    bool success = true;
+    while(! queue.empty()) {
+        auto [it, end] = queue.top();
+        queue.pop();
+        accessor::record_ref key{*it, key_size};
+        accessor::record_ref value{key.get_value<void*>(pointer_field_offset), value_size};
+        if(! keys->write(key) || ! values->write(value)) {
+            success = false;
+            break;
+        }
+        if (++it != end) {
+            queue.emplace(it, end);
+        }
+    }
+    if(! success || ! keys->finish_write() || ! values->finish_write()) {
+        // spill is best effort - keep the records in memory and stop spilling for this partition
+        VLOG_LP(log_warning) << "spilling aggregate exchange records failed and records are kept in memory";
+        spill_disabled_ = true;
+        return;
+    }
+    VLOG_LP(log_debug) << "spilled " << keys->count() << " pre-aggregated records (" << bytes_in_memory_
+                       << " bytes in memory) to " << keys->path().string();
+    runs_.emplace_back(std::make_unique<spilled_run_pair>(std::move(keys), std::move(values), pointer_field_offset));
+    run_levels_.emplace_back(0);
+    release_memory();
+    merge_runs();
+}
+
+void input_partition::merge_runs() {
+    // merge the runs like a counter in base `merge_fan_in` so that each record is re-written only logarithmic times
+    while(run_levels_.size() >= merge_fan_in) {
+        auto level = run_levels_.back();
+        if(! std::all_of(run_levels_.end() - merge_fan_in, run_levels_.end(), [&](auto l) { return l == level; })) {
+            return;
+        }
+        if(! merge_last_runs(merge_fan_in)) {
+            // the source runs are kept as they are - stop spilling as further merge is likely to fail as well
+            VLOG_LP(log_warning) << "merging spilled aggregate exchange runs failed and the runs are kept as they are";
+            spill_disabled_ = true;
+            return;
+        }
+        run_levels_.resize(run_levels_.size() - merge_fan_in);
+        run_levels_.emplace_back(level + 1);
+    }
+}
+
+bool input_partition::merge_last_runs(std::size_t count) {
+    // the same key can appear in multiple runs - they are written side by side and re-aggregated by the readers
+    auto& key_meta = info_->pre().group_meta()->key_shared();
+    auto& value_meta = info_->pre().group_meta()->value_shared();
+    auto key_size = key_meta->record_size();
+    auto value_size = value_meta->record_size();
+    auto pointer_field_offset = key_meta->value_offset(key_meta->field_count()-1);
+    auto greater = [&](spilled_run_pair* x, spilled_run_pair* y) {
+        return comparator_(accessor::record_ref(x->key(), key_size), accessor::record_ref(y->key(), key_size)) > 0;
+    };
+    std::priority_queue<spilled_run_pair*, std::vector<spilled_run_pair*>, decltype(greater)> queue{greater};
+    auto first = runs_.end() - static_cast<runs_type::difference_type>(count);
+    for(auto it = first; it != runs_.end(); ++it) {
+        if((*it)->next()) {
+            queue.emplace(it->get());
+        }
+    }
+    auto keys = std::make_unique<shuffle::spilled_run>(key_meta, shuffle::spilled_run::create_path(spill_directory_));
+    auto values = std::make_unique<shuffle::spilled_run>(value_meta, shuffle::spilled_run::create_path(spill_directory_));
+    bool success = true;
+    while(! queue.empty()) {
+        auto* r = queue.top();
+        queue.pop();
+        if(! keys->write(accessor::record_ref(r->key(), key_size)) ||
+            ! values->write(accessor::record_ref(r->value(), value_size))) {
+            success = false;
+            break;
+        }
+        if(r->next()) {
+            queue.emplace(r);
+        }
+    }
+    if(! success || ! keys->finish_write() || ! values->finish_write()) {
+        for(auto it = first; it != runs_.end(); ++it) {
+            (*it)->rewind();
+        }
+        return false;
+    }
+    VLOG_LP(log_debug) << "merged " << count << " spilled runs (" << keys->count() << " pre-aggregated records) to "
+                       << keys->path().string();
+    runs_.erase(first, runs_.end());
+    runs_.emplace_back(std::make_unique<spilled_run_pair>(std::move(keys), std::move(values), pointer_field_offset));
+    return true;
+}
+
+void input_partition::release_memory() {
+    pointer_tables_.clear();
+    hash_table_.reset();
+    keys_.reset();
+    values_.reset();
+    // monotonic resources cannot release the pages partially, so replace them with new ones
+    resource_for_keys_ = std::make_unique<memory::monotonic_paged_memory_resource>(&global::page_pool());
+    resource_for_values_ = std::make_unique<memory::monotonic_paged_memory_resource>(&global::page_pool());
+    resource_for_varlen_data_ = std::make_unique<memory::monotonic_paged_memory_resource>(&global::page_pool());
+    resource_for_hash_tables_ = std::make_unique<memory::monotonic_paged_memory_resource>(&global::page_pool());
+    resource_for_ptr_tables_ = std::make_unique<memory::monotonic_paged_memory_resource>(&global::page_pool());
+    bytes_in_memory_ = 0;
 }
 
 void input_partition::initialize_lazy() {
@@ -194,4 +378,21 @@ void input_partition::release_hashtable() noexcept {
     resource_for_hash_tables_.reset();
 }
 
+void input_partition::enable_spill(std::size_t threshold, std::string_view directory, std::size_t memory_percentage) {
+    spill_threshold_ = threshold;
+    spill_directory_ = directory;
+    if(memory_percentage != 0) {
+        spill_memory_percentage_ = memory_percentage;
+        tracker_ = memory::current_memory_tracker();
+    }
+}
+
+input_partition::runs_type& input_partition::runs() noexcept {
+    return runs_;
+}
+
+std::size_t input_partition::runs_count() const noexcept {
+    return runs_.size();
+}
+
 }
@@ -18,6 +18,8 @@
 #include <algorithm>
 #include <cstddef>
 #include <memory>
+#include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 #include <boost/container/pmr/polymorphic_allocator.hpp>
@@ -30,9 +32,11 @@
 #include <jogasaki/executor/comparator.h>
 #include <jogasaki/executor/exchange/aggregate/aggregate_info.h>
 #include <jogasaki/executor/exchange/shuffle/pointer_table.h>
+#include <jogasaki/executor/exchange/shuffle/spilled_run.h>
 #include <jogasaki/executor/global.h>
 #include <jogasaki/executor/hash.h>
 #include <jogasaki/executor/io/record_writer.h>
+#include <jogasaki/memory/memory_tracker.h>
 #include <jogasaki/memory/monotonic_paged_memory_resource.h>
 #include <jogasaki/memory/page_pool.h>
 #include <jogasaki/memory/paged_memory_resource.h>
@@ -58,6 +62,60 @@ namespace impl {
     };
 }
 
+/**
+ * @brief pre-aggregated keys and values spilled to files
+ * @details i-th key record corresponds to i-th value record. Keys are sorted, but the same key can appear
+ * multiple times because each hash table generation is written separately. Readers re-aggregate them.
+ */
+class spilled_run_pair {
+public:
+    /**
+     * @brief create new object
+     * @param keys the run storing key records
+     * @param values the run storing value records
+     * @param pointer_field_offset the offset of the key field pointing to the value record
+     */
+    spilled_run_pair(
+        std::unique_ptr<shuffle::spilled_run> keys,
+        std::unique_ptr<shuffle::spilled_run> values,
+        std::size_t pointer_field_offset
+    ) noexcept;
+
+    /**
+     * @brief read next key and value
+     * @details the key read by this call points to the value read together. The records read by the previous
+     * call keep valid until this function is called again.
+     * @return true if the next key is available
+     * @return false if the run reached its end
+     */
+    [[nodiscard]] bool next();
+
+    /**
+     * @brief accessor to the current key record
+     */
+    [[nodiscard]] void* key() const noexcept;
+
+    /**
+     * @brief accessor to the current value record
+     */
+    [[nodiscard]] void* value() const noexcept;
+
+    /**
+     * @brief rewind the runs so that next() reads the records from the beginning again
+     */
+    void rewind();
+
+    /**
+     * @brief returns the number of keys in this run
+     */
+    [[nodiscard]] std::size_t count() const noexcept;
+
+private:
+    std::unique_ptr<shuffle::spilled_run> keys_{};
+    std::unique_ptr<shuffle::spilled_run> values_{};
+    std::size_t pointer_field_offset_{};
+};
+
 /**
  * @brief partitioned input data handled in upper phase in shuffle
  * @details This object represents aggregate exchange input data after partition.
@@ -78,6 +136,13 @@ public:
 
     using key_pointer = void*;
     using value_pointer = void*;
+    using runs_type = std::vector<std::unique_ptr<spilled_run_pair>>;
+
+    /**
+     * @brief the number of spilled runs of the same level merged into one run of the next level
+     * @details this bounds the number of runs, and the files opened by the readers, to logarithmic in the input
+     */
+    constexpr static std::size_t merge_fan_in = 16;
     using bucket_type = tsl::detail_hopscotch_hash::hopscotch_bucket<std::pair<key_pointer, value_pointer>, 62, false>;
     using hash_table_allocator = boost::container::pmr::polymorphic_allocator<std::pair<key_pointer, value_pointer>>;
     using hash_table = tsl::hopscotch_map<key_pointer, value_pointer, hash, impl::key_eq, hash_table_allocator>;
@@ -181,6 +246,29 @@ public:
 
     void release_hashtable() noexcept;
 
+    /**
+     * @brief enable spilling pre-aggregated records to files
+     * @details when the memory consumed by keys and values exceeds the threshold, the current hash table is
+     * flushed, the sorted pointer tables are written to a spilled run pair and the memory is released.
+     * This keeps the memory for high cardinality grouping bounded. Spilled runs are re-aggregated by the reader.
+     * Spilling also happens on flush when the current memory tracker of the calling thread (or its ancestor)
+     * reaches `memory_percentage` of its limit, even if the threshold is not exceeded.
+     * @param threshold the bytes of memory to trigger spilling. Pass 0 to disable spilling.
+     * @param directory the directory to create spill files. If empty, system temporary directory is used.
+     * @param memory_percentage the percentage of the tracker limit to trigger spilling. Pass 0 to disable it.
+     */
+    void enable_spill(std::size_t threshold, std::string_view directory, std::size_t memory_percentage = 0);
+
+    /**
+     * @brief accessor to the runs spilled to files
+     */
+    [[nodiscard]] runs_type& runs() noexcept;
+
+    /**
+     * @brief returns the number of spilled runs
+     */
+    [[nodiscard]] std::size_t runs_count() const noexcept;
+
 private:
     std::unique_ptr<memory::paged_memory_resource> resource_for_keys_{};
     std::unique_ptr<memory::paged_memory_resource> resource_for_values_{};
@@ -197,8 +285,22 @@ private:
     std::size_t initial_hash_table_size_{};
     std::size_t max_pointers_{};
     data::small_record_store key_buf_;
+    runs_type runs_{};
+    std::vector<std::size_t> run_levels_{};
+    std::size_t spill_threshold_{};
+    std::string spill_directory_{};
+    std::size_t spill_memory_percentage_{};
+    std::shared_ptr<memory::memory_tracker> tracker_{};
+    std::size_t bytes_in_memory_{};
+    bool spill_disabled_{false};
 
     void initialize_lazy();
+    [[nodiscard]] bool spill_required() const noexcept;
+    [[nodiscard]] bool memory_pressured() const noexcept;
+    void spill();
+    void merge_runs();
+    [[nodiscard]] bool merge_last_runs(std::size_t count);
+    void release_memory();
 };
 
 }
@@ -40,7 +40,7 @@ reader::reader(
 ) :
     partitions_(partitions),
     info_(std::move(info)),
-    queue_(impl::iterator_pair_comparator(info_.get())),
+    queue_(impl::merge_cursor_comparator(info_.get())),
     key_size_(info_->mid().group_meta()->key().record_size()),
     mid_value_size_(info_->mid().group_meta()->value().record_size()),
     key_buf_(info_->mid().group_meta()->key_shared()), //NOLINT
@@ -56,18 +56,25 @@ reader::reader(
         if (!p) continue;
         for(auto& t : *p) {
             if (t.begin() != t.end()) {
-                queue_.emplace(t.begin(), t.end());
+                queue_.emplace(impl::iterator_pair{t.begin(), t.end()});
+            }
+        }
+        for(auto& r : p->runs()) {
+            if (r->next()) {
+                queue_.emplace(r.get());
             }
         }
     }
-    VLOG_LP(log_debug) << "reader initialized to merge " << queue_.size() << " pointer tables";
+    VLOG_LP(log_debug) << "reader initialized to merge " << queue_.size() << " pointer tables and spilled runs";
 }
 
-void reader::read_and_pop(impl::iterator it, impl::iterator end) { //NOLINT
+void reader::read_and_pop() { //NOLINT
+    auto cursor = queue_.top();
     queue_.pop();
-    key_buf_.set(accessor::record_ref(*it, key_size_));
-    if (++it != end) {
-        queue_.emplace(it, end);
+    // shallow copy - spilled run keeps the previous key and value valid until it proceeds again
+    key_buf_.set(accessor::record_ref(cursor.key(), key_size_));
+    if (cursor.next()) {
+        queue_.emplace(cursor);
     }
 }
 
@@ -77,9 +84,7 @@ bool reader::next_group() {
             state_ = reader_state::eof;
             return false;
         }
-        auto it = queue_.top().first;
-        auto end = queue_.top().second;
-        read_and_pop(it, end);
+        read_and_pop();
         bool initial = true;
         internal_on_member_ = false;
         auto& info = info_->mid();
@@ -121,12 +126,10 @@ bool reader::internal_next_member() {
     if (queue_.empty()) {
         return false;
     }
-    auto it = queue_.top().first;
-    auto end = queue_.top().second;
     if (key_comparator_(
         key_buf_.ref(),
-        accessor::record_ref(*it, key_size_)) == 0) {
-        read_and_pop(it, end);
+        accessor::record_ref(queue_.top().key(), key_size_)) == 0) {
+        read_and_pop();
         return true;
     }
     return false;
@@ -50,28 +50,75 @@ enum class reader_state {
 };
 
 /**
- * @brief iterator pair comparator
+ * @brief cursor over the sorted keys to merge
+ * @details this points either to the range in the in-memory pointer table or to the spilled run pair.
+ */
+class merge_cursor {
+public:
+    /**
+     * @brief create cursor over the pointer table range
+     * @param range the range in the pointer table, must not be empty
+     */
+    explicit merge_cursor(iterator_pair range) noexcept :
+        range_(range)
+    {}
+
+    /**
+     * @brief create cursor over the spilled run pair
+     * @param run the run that has been positioned on its first key
+     */
+    explicit merge_cursor(spilled_run_pair* run) noexcept :
+        run_(run)
+    {}
+
+    /**
+     * @brief returns the pointer to the current key record
+     */
+    [[nodiscard]] void* key() const noexcept {
+        if (run_ != nullptr) {
+            return run_->key();
+        }
+        return *range_.first;
+    }
+
+    /**
+     * @brief proceed the cursor
+     * @return true if the cursor points to the next key
+     * @return false if the cursor reached end
+     */
+    [[nodiscard]] bool next() {
+        if (run_ != nullptr) {
+            return run_->next();
+        }
+        return ++range_.first != range_.second;
+    }
+
+private:
+    iterator_pair range_{};
+    spilled_run_pair* run_{};
+};
+
+/**
+ * @brief merge cursor comparator
  * @details like std::greater, this comparator returns true when x > y, where x and y are 1st and 2nd args.
  * This is intended to be used with std::priority_queue, which positions the greatest at the top.
  */
-class iterator_pair_comparator {
+class merge_cursor_comparator {
 public:
     /**
      * @brief construct new object
      * @param info shuffle information
      * @attention info is kept and used by the comparator. The caller must ensure it outlives this object.
      */
-    explicit iterator_pair_comparator(aggregate_info const* info) :
+    explicit merge_cursor_comparator(aggregate_info const* info) :
         info_(info),
         record_size_(info_->pre().group_meta()->key().record_size()),
         key_comparator_(info_->mid().key_compare_info())
     {}
 
-    [[nodiscard]] bool operator()(iterator_pair const& x, iterator_pair const& y) {
-        auto& it_x = x.first;
-        auto& it_y = y.first;
-        auto key_x = accessor::record_ref(*it_x, record_size_);
-        auto key_y = accessor::record_ref(*it_y, record_size_);
+    [[nodiscard]] bool operator()(merge_cursor const& x, merge_cursor const& y) {
+        auto key_x = accessor::record_ref(x.key(), record_size_);
+        auto key_y = accessor::record_ref(y.key(), record_size_);
         return key_comparator_(key_x, key_y) > 0;
     }
 
@@ -113,7 +160,7 @@ public:
 private:
     std::vector<std::unique_ptr<input_partition>>& partitions_;
     std::shared_ptr<aggregate_info> info_{};
-    std::priority_queue<impl::iterator_pair, std::vector<impl::iterator_pair>, impl::iterator_pair_comparator> queue_;
+    std::priority_queue<impl::merge_cursor, std::vector<impl::merge_cursor>, impl::merge_cursor_comparator> queue_;
     std::size_t key_size_{};
     std::size_t mid_value_size_{};
     data::small_record_store key_buf_;
@@ -128,7 +175,7 @@ private:
 
     bool internal_next_member();
     [[nodiscard]] accessor::record_ref internal_get_member() const;
-    inline void read_and_pop(impl::iterator it, impl::iterator end);
+    inline void read_and_pop();
     [[nodiscard]] inline void* value_pointer(accessor::record_ref ref) const;
 };
 
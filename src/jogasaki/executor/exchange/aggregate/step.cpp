@@ -61,6 +61,10 @@ const maybe_shared_ptr<meta::group_meta> &step::output_meta() const noexcept {
     return info_->post().group_meta();
 }
 
+std::shared_ptr<aggregate_info> const& step::info() const noexcept {
+    return info_;
+}
+
 process::step *step::downstream(std::size_t index) const noexcept {
     if (output_ports().empty()) return nullptr;
     if (output_ports()[0]->opposites().size() <= index) return nullptr;
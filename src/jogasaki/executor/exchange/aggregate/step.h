@@ -73,6 +73,11 @@ public:
 
     [[nodiscard]] maybe_shared_ptr<meta::group_meta> const& output_meta() const noexcept override;
 
+    /**
+     * @brief accessor to the aggregate information
+     */
+    [[nodiscard]] std::shared_ptr<aggregate_info> const& info() const noexcept;
+
 protected:
     [[nodiscard]] process::step* downstream(std::size_t index) const noexcept;
     [[nodiscard]] process::step* upstream(std::size_t index) const noexcept;
@@ -17,6 +17,9 @@
 
 #include <utility>
 
+#include <jogasaki/configuration.h>
+#include <jogasaki/request_context.h>
+
 #include "aggregate_info.h"
 #include "input_partition.h"
 #include "sink.h"
@@ -61,6 +64,12 @@ void writer::initialize_lazy(std::size_t partition) {
     }
     if (partitions_[partition]) return;
     partitions_[partition] = std::make_unique<input_partition>(info_);
+    auto& cfg = owner_->context()->configuration();
+    partitions_[partition]->enable_spill(
+        cfg->exchange_spill_threshold(),
+        cfg->spill_directory(),
+        cfg->exchange_spill_memory_percentage()
+    );
 }
 
 }
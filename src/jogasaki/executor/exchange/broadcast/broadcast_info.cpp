@@ -0,0 +1,43 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "broadcast_info.h"
+
+#include <utility>
+#include <vector>
+
+#include <takatori/util/maybe_shared_ptr.h>
+
+#include <jogasaki/meta/record_meta.h>
+
+namespace jogasaki::executor::exchange::broadcast {
+
+broadcast_info::broadcast_info(
+    maybe_shared_ptr<meta::record_meta> meta,
+    std::vector<field_index_type> key_indices
+) :
+    meta_(std::move(meta)),
+    key_indices_(std::move(key_indices))
+{}
+
+maybe_shared_ptr<meta::record_meta> const& broadcast_info::record_meta() const noexcept {
+    return meta_;
+}
+
+std::vector<broadcast_info::field_index_type> const& broadcast_info::key_indices() const noexcept {
+    return key_indices_;
+}
+
+}  // namespace jogasaki::executor::exchange::broadcast
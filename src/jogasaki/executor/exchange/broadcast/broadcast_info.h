@@ -0,0 +1,66 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <takatori/util/maybe_shared_ptr.h>
+
+#include <jogasaki/meta/record_meta.h>
+
+namespace jogasaki::executor::exchange::broadcast {
+
+using takatori::util::maybe_shared_ptr;
+
+/**
+ * @brief information to execute broadcast, used to extract schema and the key fields of the hash table
+ */
+class broadcast_info {
+public:
+    using field_index_type = meta::record_meta::field_index_type;
+
+    /**
+     * @brief construct empty object
+     */
+    broadcast_info() = default;
+
+    /**
+     * @brief construct new object
+     * @param meta the metadata of the input record for broadcast operation
+     * @param key_indices the indices of the input record fields used as the hash table key
+     */
+    broadcast_info(
+        maybe_shared_ptr<meta::record_meta> meta,
+        std::vector<field_index_type> key_indices
+    );
+
+    /**
+     * @brief returns metadata for whole record
+     */
+    [[nodiscard]] maybe_shared_ptr<meta::record_meta> const& record_meta() const noexcept;
+
+    /**
+     * @brief returns the indices of the key fields, in the order the key is encoded
+     */
+    [[nodiscard]] std::vector<field_index_type> const& key_indices() const noexcept;
+
+private:
+    maybe_shared_ptr<meta::record_meta> meta_{};
+    std::vector<field_index_type> key_indices_{};
+};
+
+}  // namespace jogasaki::executor::exchange::broadcast
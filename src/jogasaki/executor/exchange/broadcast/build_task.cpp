@@ -0,0 +1,69 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "build_task.h"
+
+#include <glog/logging.h>
+
+#include <jogasaki/error/error_info_factory.h>
+#include <jogasaki/error_code.h>
+#include <jogasaki/event.h>
+#include <jogasaki/executor/common/utils.h>
+#include <jogasaki/executor/global.h>
+#include <jogasaki/logging.h>
+#include <jogasaki/logging_helper.h>
+#include <jogasaki/scheduler/flat_task.h>
+#include <jogasaki/status.h>
+
+#include "flow.h"
+
+namespace jogasaki::executor::exchange::broadcast {
+
+build_task::build_task(
+    request_context* context,
+    step_type* downstream,
+    broadcast::flow* source
+) :
+    common::task(context, downstream),
+    source_(source)
+{}
+
+model::task_result build_task::operator()() {
+    VLOG_LP(log_debug) << *this << " broadcast build_task executed.";
+    if(auto res = source_->build(); res != status::ok) {
+        set_error_context(
+            *context(),
+            error_code::sql_execution_exception,
+            "failed to build the hash table for broadcast",
+            res
+        );
+    }
+    common::send_event(*context(), event_enum_tag<event_kind::task_completed>, step()->id(), id());
+
+    if(global::config_pool()->inplace_dag_schedule()) {
+        scheduler::dag_schedule(*context());
+        return model::task_result::complete;
+    }
+
+    context()->scheduler()->schedule_task(
+        scheduler::flat_task{
+            scheduler::task_enum_tag<scheduler::flat_task_kind::dag_events>,
+                context()
+        }
+    );
+    return model::task_result::complete;
+}
+
+}  // namespace jogasaki::executor::exchange::broadcast
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <jogasaki/executor/common/task.h>
+#include <jogasaki/model/task.h>
+#include <jogasaki/request_context.h>
+
+namespace jogasaki::executor::exchange::broadcast {
+
+class flow;
+
+/**
+ * @brief task to build the broadcast hash table
+ * @details this task runs as the preparation task of the downstream process step for its sub input,
+ * so the completion is notified to the downstream step rather than the broadcast step.
+ */
+class build_task : public common::task {
+public:
+    build_task() = default;
+
+    /**
+     * @brief create new instance
+     * @param context the request context
+     * @param downstream the downstream process step that requires the hash table
+     * @param source the broadcast flow that builds the hash table
+     */
+    build_task(
+        request_context* context,
+        step_type* downstream,
+        broadcast::flow* source
+    );
+
+    [[nodiscard]] model::task_result operator()() override;
+
+private:
+    broadcast::flow* source_{};
+};
+
+}  // namespace jogasaki::executor::exchange::broadcast
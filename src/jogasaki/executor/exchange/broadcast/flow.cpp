@@ -0,0 +1,111 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "flow.h"
+
+#include <utility>
+#include <vector>
+#include <glog/logging.h>
+
+#include <jogasaki/executor/exchange/task.h>
+#include <jogasaki/logging.h>
+#include <jogasaki/logging_helper.h>
+#include <jogasaki/utils/fail.h>
+
+#include "build_task.h"
+#include "sink.h"
+
+namespace jogasaki::executor::exchange::broadcast {
+
+flow::~flow() = default;
+
+flow::flow(
+    std::shared_ptr<broadcast_info> info,
+    request_context* context,
+    step* owner
+) :
+    info_(std::move(info)),
+    context_(context),
+    owner_(owner),
+    table_(info_)
+{}
+
+takatori::util::sequence_view<std::shared_ptr<model::task>> flow::create_tasks() {
+    tasks_.emplace_back(std::make_shared<exchange::task>(context_, owner_));
+    return tasks_;
+}
+
+void flow::setup_partitions(std::size_t partitions) {
+    for(std::size_t i=0; i < partitions; ++i) {
+        sinks_.emplace_back(std::make_unique<broadcast::sink>(info_, context_));
+    }
+    VLOG_LP(log_trace) << "added new sinks flow:" << this << ") partitions:" << partitions
+                       << " #sinks:" << sinks_.size();
+}
+
+std::size_t flow::sink_count() const noexcept {
+    return sinks_.size();
+}
+
+std::size_t flow::source_count() const noexcept {
+    return 0;
+}
+
+exchange::sink& flow::sink_at(std::size_t index) {
+    return *sinks_[index];
+}
+
+exchange::source& flow::source_at(std::size_t index) {
+    (void) index;
+    fail_with_exception();
+}
+
+model::step_kind flow::kind() const noexcept {
+    return model::step_kind::broadcast;
+}
+
+class request_context* flow::context() const noexcept {
+    return context_;
+}
+
+status flow::build() {
+    std::lock_guard lk{mutex_};
+    if(built_) {
+        return build_status_;
+    }
+    built_ = true;
+    for(auto&& s : sinks_) {
+        auto& records = s->records();
+        for(auto it = records.begin(), end = records.end(); it != end; ++it) {
+            if(auto res = table_.insert(it.ref()); res != status::ok) {
+                build_status_ = res;
+                return res;
+            }
+        }
+    }
+    VLOG_LP(log_debug) << "broadcast hash table built flow:" << this << " #sinks:" << sinks_.size()
+                       << " #records:" << table_.size();
+    return status::ok;
+}
+
+std::shared_ptr<model::task> flow::create_build_task(common::step* downstream) {
+    return std::make_shared<build_task>(context_, downstream, this);
+}
+
+hash_table const& flow::table() const noexcept {
+    return table_;
+}
+
+}  // namespace jogasaki::executor::exchange::broadcast
@@ -0,0 +1,129 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <takatori/util/sequence_view.h>
+
+#include <jogasaki/executor/common/step.h>
+#include <jogasaki/executor/exchange/flow.h>
+#include <jogasaki/executor/exchange/sink.h>
+#include <jogasaki/executor/exchange/source.h>
+#include <jogasaki/executor/exchange/step.h>
+#include <jogasaki/model/step_kind.h>
+#include <jogasaki/model/task.h>
+#include <jogasaki/request_context.h>
+#include <jogasaki/status.h>
+
+#include "broadcast_info.h"
+#include "hash_table.h"
+#include "sink.h"
+
+namespace jogasaki::executor::exchange::broadcast {
+
+/**
+ * @brief broadcast step data flow
+ * @details the records written by the upstream are kept in the sinks, and the hash table is built from them
+ * once all upstreams complete. The table is shared by all the tasks of the downstream processes, which look it up
+ * directly instead of reading the records from the sources, so this flow has no source.
+ */
+class flow : public exchange::flow {
+public:
+    ~flow() override;
+
+    flow(flow const& other) = delete;
+    flow& operator=(flow const& other) = delete;
+    flow(flow&& other) noexcept = delete;
+    flow& operator=(flow&& other) noexcept = delete;
+
+    /**
+     * @brief create new instance with empty schema (for testing)
+     */
+    flow() = default;
+
+    /**
+     * @brief create new instance
+     * @param info the broadcast exchange information
+     * @param context the request context
+     * @param owner the step that owns this flow
+     */
+    flow(
+        std::shared_ptr<broadcast_info> info,
+        request_context* context,
+        step* owner
+    );
+
+    [[nodiscard]] takatori::util::sequence_view<std::shared_ptr<model::task>> create_tasks() override;
+
+    void setup_partitions(std::size_t partitions) override;
+
+    [[nodiscard]] std::size_t sink_count() const noexcept override;
+
+    [[nodiscard]] std::size_t source_count() const noexcept override;
+
+    [[nodiscard]] exchange::sink& sink_at(std::size_t index) override;
+
+    /**
+     * @brief broadcast has no source, so this always fails
+     * @throws std::exception (by fail_with_exception)
+     */
+    [[nodiscard]] exchange::source& source_at(std::size_t index) override;
+
+    [[nodiscard]] model::step_kind kind() const noexcept override;
+
+    [[nodiscard]] class request_context* context() const noexcept;
+
+    /**
+     * @brief build the hash table from the records in the sinks
+     * @details this is called by the build task of each downstream process, and the table is built only once.
+     * Subsequent calls return the result of the first one.
+     * @pre all the upstream tasks completed writing
+     * @return status::ok if successful
+     * @return any error returned from encoding the key
+     */
+    status build();
+
+    /**
+     * @brief create the task to build the hash table for the downstream process
+     * @param downstream the downstream process step, whose sub input is connected to this exchange
+     * @return the task, which notifies the completion to the downstream step
+     */
+    [[nodiscard]] std::shared_ptr<model::task> create_build_task(common::step* downstream);
+
+    /**
+     * @brief accessor to the hash table
+     * @pre build() is called successfully
+     */
+    [[nodiscard]] hash_table const& table() const noexcept;
+
+private:
+    std::vector<std::shared_ptr<model::task>> tasks_{};
+    std::shared_ptr<broadcast_info> info_{};
+    std::deque<std::unique_ptr<broadcast::sink>> sinks_{};  // use deque to avoid relocation
+    request_context* context_{};
+    step* owner_{};
+    hash_table table_{};
+    std::mutex mutex_{};
+    bool built_{};
+    status build_status_{status::ok};
+};
+
+}  // namespace jogasaki::executor::exchange::broadcast
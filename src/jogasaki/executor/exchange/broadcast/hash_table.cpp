@@ -0,0 +1,88 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "hash_table.h"
+
+#include <string_view>
+#include <utility>
+
+#include <jogasaki/kvs/coder.h>
+#include <jogasaki/kvs/writable_stream.h>
+#include <jogasaki/meta/record_meta.h>
+
+namespace jogasaki::executor::exchange::broadcast {
+
+hash_table::hash_table(std::shared_ptr<broadcast_info> info) :
+    info_(std::move(info))
+{}
+
+status hash_table::encode_key(accessor::record_ref record, bool& has_null) {
+    auto& meta = *info_->record_meta();
+    has_null = false;
+    for(int loop = 0; loop < 2; ++loop) { // if first trial overflows `buf_`, extend it and retry
+        kvs::writable_stream s{buf_.data(), buf_.capacity(), loop == 0};
+        for(auto i : info_->key_indices()) {
+            if(record.is_null(meta.nullity_offset(i))) {
+                has_null = true;
+                return status::ok;
+            }
+            kvs::coding_context ctx{};
+            if(auto res = kvs::encode(record, meta.value_offset(i), meta.at(i), kvs::spec_key_ascending, ctx, s);
+                res != status::ok) {
+                return res;
+            }
+        }
+        auto length = s.size();
+        bool const fit = (length <= buf_.capacity());
+        buf_.resize(length);
+        if (loop == 0) {
+            if (fit) {
+                break;
+            }
+            buf_.resize(0); // set data size 0 and start from beginning
+        }
+    }
+    return status::ok;
+}
+
+status hash_table::insert(accessor::record_ref record) {
+    bool has_null{};
+    if(auto res = encode_key(record, has_null); res != status::ok) {
+        return res;
+    }
+    if(has_null) {
+        return status::ok;
+    }
+    entity_.emplace(std::string{static_cast<std::string_view>(buf_)}, record.data());
+    return status::ok;
+}
+
+std::pair<hash_table::const_iterator, hash_table::const_iterator> hash_table::find(std::string const& key) const {
+    return entity_.equal_range(key);
+}
+
+std::size_t hash_table::size() const noexcept {
+    return entity_.size();
+}
+
+bool hash_table::empty() const noexcept {
+    return entity_.empty();
+}
+
+std::shared_ptr<broadcast_info> const& hash_table::info() const noexcept {
+    return info_;
+}
+
+}  // namespace jogasaki::executor::exchange::broadcast
@@ -0,0 +1,99 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <jogasaki/accessor/record_ref.h>
+#include <jogasaki/data/aligned_buffer.h>
+#include <jogasaki/status.h>
+
+#include "broadcast_info.h"
+
+namespace jogasaki::executor::exchange::broadcast {
+
+/**
+ * @brief hash table built from the broadcast records
+ * @details the table maps the key fields of the records (encoded in the same way as the kvs key) to the records.
+ * The records are not copied and must be kept alive by the caller while the table is used.
+ * Records whose key fields contain null are not added because they never match any key.
+ * @note the table is built by single thread and then read concurrently without synchronization
+ */
+class hash_table {
+public:
+    /// @brief type of record pointer
+    using record_pointer = void*;
+
+    /// @brief type of the table entity
+    using entity_type = std::unordered_multimap<std::string, record_pointer>;
+
+    /// @brief iterator for the records
+    using const_iterator = entity_type::const_iterator;
+
+    /**
+     * @brief create empty object
+     */
+    hash_table() = default;
+
+    /**
+     * @brief create new object
+     * @param info the broadcast information, whose key indices define the table key
+     */
+    explicit hash_table(std::shared_ptr<broadcast_info> info);
+
+    /**
+     * @brief add the record to the table
+     * @param record the record to add, which must be kept alive while the table is used
+     * @return status::ok if successful (including the case the record is skipped because of the null key)
+     * @return any error returned from encoding the key
+     */
+    status insert(accessor::record_ref record);
+
+    /**
+     * @brief find the records matching the encoded key
+     * @param key the key encoded by kvs::encode with ascending non-nullable spec for each key field
+     * @return the range of the matching records
+     */
+    [[nodiscard]] std::pair<const_iterator, const_iterator> find(std::string const& key) const;
+
+    /**
+     * @brief returns the number of the records in the table
+     */
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    /**
+     * @brief returns whether the table is empty
+     */
+    [[nodiscard]] bool empty() const noexcept;
+
+    /**
+     * @brief accessor to the broadcast information
+     */
+    [[nodiscard]] std::shared_ptr<broadcast_info> const& info() const noexcept;
+
+private:
+    std::shared_ptr<broadcast_info> info_{};
+    entity_type entity_{};
+    data::aligned_buffer buf_{};
+
+    status encode_key(accessor::record_ref record, bool& has_null);
+};
+
+}  // namespace jogasaki::executor::exchange::broadcast
@@ -0,0 +1,6 @@
+#pragma once
+
+/**
+ * @brief exchange for data broadcasting
+ */
+namespace jogasaki::executor::exchange::broadcast {}
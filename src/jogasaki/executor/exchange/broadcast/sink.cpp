@@ -0,0 +1,77 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sink.h"
+
+#include <utility>
+#include <glog/logging.h>
+
+#include <jogasaki/executor/global.h>
+#include <jogasaki/executor/io/record_writer.h>
+#include <jogasaki/logging.h>
+#include <jogasaki/logging_helper.h>
+#include <jogasaki/request_context.h>
+#include <jogasaki/utils/fail.h>
+
+#include "broadcast_info.h"
+#include "writer.h"
+
+namespace jogasaki::executor::exchange::broadcast {
+
+sink::~sink() = default;
+
+sink::sink(
+    std::shared_ptr<broadcast_info> info,
+    request_context* context
+) :
+    info_(std::move(info)),
+    context_(context),
+    resource_(std::make_unique<memory::monotonic_paged_memory_resource>(&global::page_pool())),
+    varlen_resource_(std::make_unique<memory::monotonic_paged_memory_resource>(&global::page_pool())),
+    records_(std::make_unique<data::iterable_record_store>(
+        resource_.get(),
+        varlen_resource_.get(),
+        info_->record_meta()
+    ))
+{}
+
+io::record_writer& sink::acquire_writer() {
+    if (! writer_) {
+        writer_ = std::make_unique<broadcast::writer>(*this);
+        VLOG_LP(log_trace) << "acquire writer from sink:" << this << " writer:" << writer_.get();
+    }
+    return *writer_;
+}
+
+void sink::release_writer(io::record_writer& writer) {
+    if (*writer_ != writer) {
+        fail_with_exception();
+    }
+    writer_.reset();
+}
+
+void sink::deactivate() {
+    // no-op - records are kept until the hash table is built and released together with the flow
+}
+
+data::iterable_record_store& sink::records() noexcept {
+    return *records_;
+}
+
+request_context* sink::context() const noexcept {
+    return context_;
+}
+
+}  // namespace jogasaki::executor::exchange::broadcast
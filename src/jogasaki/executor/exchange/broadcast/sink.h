@@ -0,0 +1,77 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <memory>
+
+#include <jogasaki/data/iterable_record_store.h>
+#include <jogasaki/executor/exchange/sink.h>
+#include <jogasaki/executor/io/record_writer.h>
+#include <jogasaki/memory/monotonic_paged_memory_resource.h>
+#include <jogasaki/request_context.h>
+
+#include "broadcast_info.h"
+
+namespace jogasaki::executor::exchange::broadcast {
+
+class writer;
+
+/**
+ * @brief broadcast exchange sink
+ * @details the sink keeps the records written by the upstream task until the hash table is built from them.
+ */
+class sink : public exchange::sink {
+public:
+    sink() = default;
+    ~sink() override;
+    sink(sink const& other) = delete;
+    sink& operator=(sink const& other) = delete;
+    sink(sink&& other) noexcept = delete;
+    sink& operator=(sink&& other) noexcept = delete;
+
+    /**
+     * @brief create new instance
+     * @param info the broadcast information
+     * @param context the request context
+     */
+    sink(
+        std::shared_ptr<broadcast_info> info,
+        request_context* context
+    );
+
+    [[nodiscard]] io::record_writer& acquire_writer() override;
+
+    void release_writer(io::record_writer& writer);
+
+    void deactivate() override;
+
+    /**
+     * @brief accessor to the records written to this sink
+     */
+    [[nodiscard]] data::iterable_record_store& records() noexcept;
+
+    [[nodiscard]] request_context* context() const noexcept;
+
+private:
+    std::shared_ptr<broadcast_info> info_{};
+    request_context* context_{};
+    std::unique_ptr<memory::monotonic_paged_memory_resource> resource_{};
+    std::unique_ptr<memory::monotonic_paged_memory_resource> varlen_resource_{};
+    std::unique_ptr<data::iterable_record_store> records_{};
+    std::unique_ptr<broadcast::writer> writer_{};
+};
+
+}  // namespace jogasaki::executor::exchange::broadcast
@@ -0,0 +1,57 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "step.h"
+
+#include <memory>
+#include <utility>
+
+#include <jogasaki/meta/record_meta.h>
+#include <jogasaki/meta/variable_order.h>
+#include <jogasaki/model/flow.h>
+
+#include "broadcast_info.h"
+#include "flow.h"
+
+namespace jogasaki::executor::exchange::broadcast {
+
+step::step(
+    std::shared_ptr<broadcast_info> info,
+    meta::variable_order input_column_order
+) :
+    exchange::step(info->record_meta(), std::move(input_column_order)),
+    info_(std::move(info))
+{}
+
+void step::activate(request_context& rctx) {
+    data_flow_object(
+        rctx,
+        std::make_unique<broadcast::flow>(info_, std::addressof(rctx), this)
+    );
+}
+
+meta::variable_order const& step::output_order() const noexcept {
+    return exchange::step::input_order();
+}
+
+maybe_shared_ptr<meta::record_meta> const& step::output_meta() const noexcept {
+    return exchange::step::input_meta();
+}
+
+std::shared_ptr<broadcast_info> const& step::info() const noexcept {
+    return info_;
+}
+
+}  // namespace jogasaki::executor::exchange::broadcast
@@ -0,0 +1,70 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <memory>
+
+#include <takatori/util/maybe_shared_ptr.h>
+
+#include <jogasaki/executor/exchange/step.h>
+#include <jogasaki/meta/variable_order.h>
+#include <jogasaki/model/step_kind.h>
+#include <jogasaki/request_context.h>
+
+#include "broadcast_info.h"
+#include "flow.h"
+
+namespace jogasaki::executor::exchange::broadcast {
+
+/**
+ * @brief broadcast exchange step
+ * @details the step is connected to the sub input of the downstream process steps, which probe the hash table
+ * built from the records of this exchange.
+ */
+class step : public exchange::step {
+public:
+    step() = default;
+
+    /**
+     * @brief create new instance
+     * @param info the broadcast information
+     * @param input_column_order column ordering information for exchange input
+     */
+    step(
+        std::shared_ptr<broadcast_info> info,
+        meta::variable_order input_column_order
+    );
+
+    [[nodiscard]] model::step_kind kind() const noexcept override {
+        return model::step_kind::broadcast;
+    }
+
+    void activate(request_context& rctx) override;
+
+    [[nodiscard]] meta::variable_order const& output_order() const noexcept;
+
+    [[nodiscard]] maybe_shared_ptr<meta::record_meta> const& output_meta() const noexcept;
+
+    /**
+     * @brief accessor to the broadcast information
+     */
+    [[nodiscard]] std::shared_ptr<broadcast_info> const& info() const noexcept;
+
+private:
+    std::shared_ptr<broadcast_info> info_{};
+};
+
+}  // namespace jogasaki::executor::exchange::broadcast
@@ -0,0 +1,46 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "writer.h"
+
+#include <memory>
+#include <glog/logging.h>
+
+#include <jogasaki/logging.h>
+#include <jogasaki/logging_helper.h>
+
+#include "sink.h"
+
+namespace jogasaki::executor::exchange::broadcast {
+
+writer::writer(sink& owner) :
+    owner_(std::addressof(owner))
+{}
+
+bool writer::write(accessor::record_ref rec) {
+    owner_->records().append(rec);
+    return true;
+}
+
+void writer::flush() {
+    // no-op - records are not visible to downstream until the upstream completes
+}
+
+void writer::release() {
+    VLOG_LP(log_trace) << "writer released " << this;
+    owner_->release_writer(*this);
+}
+
+}  // namespace jogasaki::executor::exchange::broadcast
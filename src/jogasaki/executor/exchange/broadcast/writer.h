@@ -0,0 +1,55 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <jogasaki/accessor/record_ref.h>
+#include <jogasaki/executor/io/record_writer.h>
+#include <jogasaki/utils/interference_size.h>
+
+namespace jogasaki::executor::exchange::broadcast {
+
+class sink;
+
+/**
+ * @brief broadcast exchange writer
+ * @details the writer copies the records into the store owned by the sink
+ */
+class cache_align writer : public io::record_writer {
+public:
+    writer() = default;
+    writer(writer const& other) = delete;
+    writer& operator=(writer const& other) = delete;
+    writer(writer&& other) noexcept = delete;
+    writer& operator=(writer&& other) noexcept = delete;
+    ~writer() override = default;
+
+    /**
+     * @brief create new instance
+     * @param owner the sink that owns this writer
+     */
+    explicit writer(broadcast::sink& owner);
+
+    bool write(accessor::record_ref rec) override;
+
+    void flush() override;
+
+    void release() override;
+
+private:
+    sink* owner_{};
+};
+
+}  // namespace jogasaki::executor::exchange::broadcast
@@ -70,4 +70,8 @@ maybe_shared_ptr<meta::record_meta> const& step::output_meta() const noexcept {
     return exchange::step::input_meta();
 }
 
+std::shared_ptr<forward_info> const& step::info() const noexcept {
+    return info_;
+}
+
 }  // namespace jogasaki::executor::exchange::forward
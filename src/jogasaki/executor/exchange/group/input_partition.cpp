@@ -16,8 +16,10 @@
 #include "input_partition.h"
 
 #include <algorithm>
+#include <queue>
 #include <type_traits>
 #include <utility>
+#include <glog/logging.h>
 
 #include <takatori/util/maybe_shared_ptr.h>
 
@@ -26,8 +28,15 @@
 #include <jogasaki/data/record_store.h>
 #include <jogasaki/executor/exchange/group/group_info.h>
 #include <jogasaki/executor/exchange/shuffle/pointer_table.h>
+#include <jogasaki/executor/exchange/shuffle/spilled_run.h>
+#include <jogasaki/executor/global.h>
+#include <jogasaki/logging.h>
+#include <jogasaki/logging_helper.h>
+#include <jogasaki/memory/memory_tracker.h>
+#include <jogasaki/memory/monotonic_paged_memory_resource.h>
 #include <jogasaki/memory/paged_memory_resource.h>
 #include <jogasaki/request_context.h>
+#include <jogasaki/utils/iterator_pair.h>
 
 namespace jogasaki::executor::exchange::group {
 
@@ -44,14 +53,27 @@ input_partition::input_partition(
     info_(std::move(info)),
     context_(context),
     comparator_(info_->sort_compare_info()),
+    key_comparator_(info_->compare_info()),
     max_pointers_(pointer_table_size)
-{}
+{
+    if(context_->configuration()->noop_pregroup()) {
+        // records are not sorted, so they cannot be spilled as sorted runs
+        return;
+    }
+    spill_threshold_ = context_->configuration()->exchange_spill_threshold();
+    spill_memory_percentage_ = context_->configuration()->exchange_spill_memory_percentage();
+    // the partition is created by the task of the request, so this is the tracker charged by the request resources
+    tracker_ = memory::current_memory_tracker();
+}
 
 bool input_partition::write(accessor::record_ref record) {
     initialize_lazy();
     auto& table = pointer_tables_.back();
     table.emplace_back(records_->append(record));
-    if (table.capacity() == table.size()) {
+    if(spill_threshold_ != 0) {
+        bytes_in_memory_ += shuffle::spilled_run::record_bytes(*info_->record_meta(), record) + sizeof(void*);
+    }
+    if (table.capacity() == table.size() || spill_required()) {
         flush();
         return true;
     }
@@ -68,6 +90,238 @@ void input_partition::flush() {
         return comparator_(info_->extract_sort_key(accessor::record_ref(x, sz)),
             info_->extract_sort_key(accessor::record_ref(y, sz))) < 0;
     });
+    if(info_->limit().has_value()) {
+        trim_to_limit(table);
+        std::size_t count = 0;
+        for(auto& t : pointer_tables_) {
+            count += t.size();
+        }
+        // compact only when the kept records doubled so that the merge cost is amortized
+        if(count > std::max(compacted_count_ * 2, max_pointers_)) {
+            shrink_to_limit();
+        }
+    }
+    if(spill_required() || memory_pressured()) {
+        spill();
+    }
+}
+
+bool input_partition::spill_required() const noexcept {
+    return spill_threshold_ != 0 && ! spill_disabled_ && spill_threshold_ <= bytes_in_memory_;
+}
+
+bool input_partition::memory_pressured() const noexcept {
+    return spill_threshold_ != 0 && ! spill_disabled_ && bytes_in_memory_ != 0 && tracker_ &&
+        tracker_->reaches_with_ancestors(spill_memory_percentage_);
+}
+
+void input_partition::spill() {
+    // merge the sorted pointer tables into a single run
+    using iterator_pair = utils::iterator_pair<table_iterator>;
+    auto sz = info_->record_meta()->record_size();
+    auto greater = [&](iterator_pair const& x, iterator_pair const& y) {
+        return comparator_(info_->extract_sort_key(accessor::record_ref(*x.first, sz)),
+            info_->extract_sort_key(accessor::record_ref(*y.first, sz))) > 0;
+    };
+    std::priority_queue<iterator_pair, std::vector<iterator_pair>, decltype(greater)> queue{greater};
+    for(auto& t : pointer_tables_) {
+        if(t.begin() != t.end()) {
+            queue.emplace(t.begin(), t.end());
+        }
+    }
+    auto run = std::make_unique<shuffle::spilled_run>(
+        info_->record_meta(),
+        shuffle::spilled_run::create_path(context_->configuration()->spill_directory())
+    );
+    while(! queue.empty()) {
+        auto [it, end] = queue.top();
+        queue.pop();
+        if(! run->write(accessor::record_ref(*it, sz))) {
+            // spill is best effort - keep the records in memory and stop spilling for this partition
+            VLOG_LP(log_warning) << "spilling group exchange records failed and records are kept in memory";
+            spill_disabled_ = true;
+            return;
+        }
+        if (++it != end) {
+            queue.emplace(it, end);
+        }
+    }
+    if(! run->finish_write()) {
+        VLOG_LP(log_warning) << "spilling group exchange records failed and records are kept in memory";
+        spill_disabled_ = true;
+        return;
+    }
+    VLOG_LP(log_debug) << "spilled " << run->count() << " records (" << bytes_in_memory_
+                       << " bytes in memory) to " << run->path().string();
+    runs_.emplace_back(std::move(run));
+    run_levels_.emplace_back(0);
+    release_memory();
+    merge_runs();
+}
+
+void input_partition::merge_runs() {
+    // merge the runs like a counter in base `merge_fan_in` so that each record is re-written only logarithmic times
+    while(run_levels_.size() >= merge_fan_in) {
+        auto level = run_levels_.back();
+        if(! std::all_of(run_levels_.end() - merge_fan_in, run_levels_.end(), [&](auto l) { return l == level; })) {
+            return;
+        }
+        if(! merge_last_runs(merge_fan_in)) {
+            // the source runs are kept as they are - stop spilling as further merge is likely to fail as well
+            VLOG_LP(log_warning) << "merging spilled group exchange runs failed and the runs are kept as they are";
+            spill_disabled_ = true;
+            return;
+        }
+        run_levels_.resize(run_levels_.size() - merge_fan_in);
+        run_levels_.emplace_back(level + 1);
+    }
+}
+
+bool input_partition::merge_last_runs(std::size_t count) {
+    auto sz = info_->record_meta()->record_size();
+    auto greater = [&](shuffle::spilled_run* x, shuffle::spilled_run* y) {
+        return comparator_(info_->extract_sort_key(accessor::record_ref(x->current(), sz)),
+            info_->extract_sort_key(accessor::record_ref(y->current(), sz))) > 0;
+    };
+    std::priority_queue<shuffle::spilled_run*, std::vector<shuffle::spilled_run*>, decltype(greater)> queue{greater};
+    auto first = runs_.end() - static_cast<runs_type::difference_type>(count);
+    for(auto it = first; it != runs_.end(); ++it) {
+        if((*it)->next()) {
+            queue.emplace(it->get());
+        }
+    }
+    auto merged = std::make_unique<shuffle::spilled_run>(
+        info_->record_meta(),
+        shuffle::spilled_run::create_path(context_->configuration()->spill_directory())
+    );
+    bool success = true;
+    while(! queue.empty()) {
+        auto* r = queue.top();
+        queue.pop();
+        if(! merged->write(accessor::record_ref(r->current(), sz))) {
+            success = false;
+            break;
+        }
+        if(r->next()) {
+            queue.emplace(r);
+        }
+    }
+    if(! success || ! merged->finish_write()) {
+        for(auto it = first; it != runs_.end(); ++it) {
+            (*it)->rewind();
+        }
+        return false;
+    }
+    VLOG_LP(log_debug) << "merged " << count << " spilled runs (" << merged->count() << " records) to "
+                       << merged->path().string();
+    runs_.erase(first, runs_.end());
+    runs_.emplace_back(std::move(merged));
+    return true;
+}
+
+void input_partition::release_memory() {
+    pointer_tables_.clear();
+    records_.reset();
+    // monotonic resources cannot release the pages partially, so replace them with new ones
+    resource_for_records_ = std::make_unique<memory::monotonic_paged_memory_resource>(&global::page_pool());
+    resource_for_ptr_tables_ = std::make_unique<memory::monotonic_paged_memory_resource>(&global::page_pool());
+    resource_for_varlen_data_ = std::make_unique<memory::monotonic_paged_memory_resource>(&global::page_pool());
+    bytes_in_memory_ = 0;
+    compacted_count_ = 0;
+}
+
+void input_partition::trim_to_limit(pointer_table_type& table) {
+    // the table is sorted - keep the first `limit` records in each group of the table
+    auto limit = info_->limit().value();
+    auto sz = info_->record_meta()->record_size();
+    std::size_t kept = 0;
+    std::size_t members = 0;
+    void* prev = nullptr;
+    for(auto it = table.begin(); it != table.end(); ++it) {
+        accessor::record_ref rec{*it, sz};
+        if(prev == nullptr ||
+            key_comparator_(info_->extract_key(accessor::record_ref(prev, sz)), info_->extract_key(rec)) != 0) {
+            members = 0;
+        }
+        prev = *it;
+        if(members < limit) {
+            ++members;
+            *(table.begin() + kept) = *it;  //NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            ++kept;
+        }
+    }
+    table.truncate(kept);
+}
+
+void input_partition::shrink_to_limit() {
+    // merge the sorted pointer tables and keep only the first `limit` records in each group
+    using iterator_pair = utils::iterator_pair<table_iterator>;
+    auto limit = info_->limit().value();
+    auto sz = info_->record_meta()->record_size();
+    auto greater = [&](iterator_pair const& x, iterator_pair const& y) {
+        return comparator_(info_->extract_sort_key(accessor::record_ref(*x.first, sz)),
+            info_->extract_sort_key(accessor::record_ref(*y.first, sz))) > 0;
+    };
+    std::priority_queue<iterator_pair, std::vector<iterator_pair>, decltype(greater)> queue{greater};
+    std::size_t count = 0;
+    for(auto& t : pointer_tables_) {
+        count += t.size();
+        if(t.begin() != t.end()) {
+            queue.emplace(t.begin(), t.end());
+        }
+    }
+    if(count <= limit) {
+        // no group can exceed the limit
+        compacted_count_ = count;
+        return;
+    }
+
+    // copy the survivors to new memory so that the discarded records are released
+    auto resource_for_records = std::make_unique<memory::monotonic_paged_memory_resource>(&global::page_pool());
+    auto resource_for_ptr_tables = std::make_unique<memory::monotonic_paged_memory_resource>(&global::page_pool());
+    auto resource_for_varlen_data = std::make_unique<memory::monotonic_paged_memory_resource>(&global::page_pool());
+    auto records = std::make_unique<data::record_store>(
+        resource_for_records.get(),
+        resource_for_varlen_data.get(),
+        info_->record_meta()
+    );
+    pointer_tables_type tables{};
+    std::size_t bytes_in_memory = 0;
+    std::size_t members = 0;
+    void* prev = nullptr;
+    while(! queue.empty()) {
+        auto [it, end] = queue.top();
+        queue.pop();
+        accessor::record_ref rec{*it, sz};
+        if(prev == nullptr ||
+            key_comparator_(info_->extract_key(accessor::record_ref(prev, sz)), info_->extract_key(rec)) != 0) {
+            members = 0;
+        }
+        prev = *it;
+        if(members < limit) {
+            ++members;
+            if(tables.empty() || tables.back().size() == tables.back().capacity()) {
+                tables.emplace_back(resource_for_ptr_tables.get(), max_pointers_);
+            }
+            tables.back().emplace_back(records->append(rec));
+            if(spill_threshold_ != 0) {
+                bytes_in_memory += shuffle::spilled_run::record_bytes(*info_->record_meta(), rec) + sizeof(void*);
+            }
+        }
+        if (++it != end) {
+            queue.emplace(it, end);
+        }
+    }
+    compacted_count_ = 0;
+    for(auto& t : tables) {
+        compacted_count_ += t.size();
+    }
+    pointer_tables_ = std::move(tables);
+    records_ = std::move(records);
+    resource_for_records_ = std::move(resource_for_records);
+    resource_for_ptr_tables_ = std::move(resource_for_ptr_tables);
+    resource_for_varlen_data_ = std::move(resource_for_varlen_data);
+    bytes_in_memory_ = bytes_in_memory;
 }
 
 input_partition::iterator input_partition::begin() {
@@ -82,6 +336,14 @@ std::size_t input_partition::tables_count() const noexcept {
     return pointer_tables_.size();
 }
 
+input_partition::runs_type& input_partition::runs() noexcept {
+    return runs_;
+}
+
+std::size_t input_partition::runs_count() const noexcept {
+    return runs_.size();
+}
+
 void input_partition::initialize_lazy() {
     if (!records_) {
         records_ = std::make_unique<data::record_store>(
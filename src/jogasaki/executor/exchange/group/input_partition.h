@@ -24,6 +24,8 @@
 #include <jogasaki/executor/comparator.h>
 #include <jogasaki/executor/exchange/group/group_info.h>
 #include <jogasaki/executor/exchange/shuffle/pointer_table.h>
+#include <jogasaki/executor/exchange/shuffle/spilled_run.h>
+#include <jogasaki/memory/memory_tracker.h>
 #include <jogasaki/memory/page_pool.h>
 #include <jogasaki/memory/paged_memory_resource.h>
 #include <jogasaki/request_context.h>
@@ -35,10 +37,22 @@ namespace jogasaki::executor::exchange::group {
  * @brief partitioned input data handled in upper phase in shuffle
  * @details This object represents group exchange input data after partition.
  * This object is transferred between sinks and sources when transfer is instructed to the exchange.
- * No limit to the number of records stored in this object.
+ * No limit to the number of records stored in this object unless group_info::limit() is set.
+ * If the limit is set, each pointer table is trimmed on flush so that only the first `limit` records of each group
+ * in the table remain. When the records kept by the tables double since the last compaction, all tables are merged
+ * keeping the first `limit` records of each group, and the survivors are compacted into new memory. This bounds the
+ * memory to a constant factor of the records surviving the limit, while each record is copied only amortized
+ * constant times.
  * After populating input data (by write() and flush()), this object provides iterators to the internal pointer tables
  * (each of which needs to fit page size defined by memory allocator, e.g. 2MB for huge page)
  * which contain sorted pointers.
+ * If configuration::exchange_spill_threshold() is set and the records held in memory exceed the threshold,
+ * the sorted pointer tables are merged and written to a spilled run on local file, and the memory is released.
+ * Spilling also happens on flush when the memory tracker of the request (or its ancestor) reaches
+ * configuration::exchange_spill_memory_percentage() of its limit, even if the threshold is not exceeded.
+ * Spilled runs are available via runs() and must be merged with the pointer tables by the reader.
+ * To bound the number of runs (and the files opened by the reader), every `merge_fan_in` runs of the same size class
+ * are merged into a single run, so the run count grows logarithmically with the input.
  */
 class cache_align input_partition {
 public:
@@ -46,8 +60,14 @@ public:
     using pointer_tables_type = std::vector<pointer_table_type>;
     using iterator = pointer_tables_type::iterator;
     using table_iterator = pointer_table_type::iterator;
+    using runs_type = std::vector<std::unique_ptr<shuffle::spilled_run>>;
     constexpr static std::size_t ptr_table_size = memory::page_size/sizeof(void*);
 
+    /**
+     * @brief the number of spilled runs of the same level merged into one run of the next level
+     */
+    constexpr static std::size_t merge_fan_in = 16;
+
     /**
      * @brief create empty object
      */
@@ -99,6 +119,17 @@ public:
      */
     [[nodiscard]] std::size_t tables_count() const noexcept;
 
+    /**
+     * @brief accessor to the runs spilled to files
+     * @details the runs are sorted and ready to read
+     */
+    [[nodiscard]] runs_type& runs() noexcept;
+
+    /**
+     * @brief returns the number of spilled runs
+     */
+    [[nodiscard]] std::size_t runs_count() const noexcept;
+
 private:
 
     std::unique_ptr<memory::paged_memory_resource> resource_for_records_{};
@@ -109,10 +140,27 @@ private:
     std::unique_ptr<data::record_store> records_{};
     pointer_tables_type pointer_tables_{};
     comparator comparator_{};
+    comparator key_comparator_{};
     bool current_pointer_table_active_{false};
     std::size_t max_pointers_{};
+    runs_type runs_{};
+    std::vector<std::size_t> run_levels_{};
+    std::size_t spill_threshold_{};
+    std::size_t spill_memory_percentage_{};
+    std::shared_ptr<memory::memory_tracker> tracker_{};
+    std::size_t bytes_in_memory_{};
+    bool spill_disabled_{false};
+    std::size_t compacted_count_{};
 
     void initialize_lazy();
+    [[nodiscard]] bool spill_required() const noexcept;
+    [[nodiscard]] bool memory_pressured() const noexcept;
+    void spill();
+    void merge_runs();
+    [[nodiscard]] bool merge_last_runs(std::size_t count);
+    void release_memory();
+    void trim_to_limit(pointer_table_type& table);
+    void shrink_to_limit();
 };
 
 }  // namespace jogasaki::executor::exchange::group
@@ -40,7 +40,7 @@ priority_queue_reader::priority_queue_reader(
 ) :
     partitions_(partitions),
     info_(std::move(info)),
-    queue_(iterator_pair_comparator(info_.get())),
+    queue_(merge_cursor_comparator(info_.get())),
     record_size_(info_->record_meta()->record_size()),
     buf_(info_->record_meta()), //NOLINT
     key_comparator_(info_->compare_info())
@@ -49,22 +49,27 @@ priority_queue_reader::priority_queue_reader(
         if (!p) continue;
         for(auto& t : *p) {
             if (t.begin() != t.end()) {
-                queue_.emplace(t.begin(), t.end());
+                queue_.emplace(iterator_pair{t.begin(), t.end()});
+            }
+        }
+        for(auto& r : p->runs()) {
+            if (r->next()) {
+                queue_.emplace(r.get());
             }
         }
     }
-    VLOG_LP(log_debug) << "reader initialized to merge " << queue_.size() << " pointer tables";
+    VLOG_LP(log_debug) << "reader initialized to merge " << queue_.size() << " pointer tables and spilled runs";
 }
 
 void priority_queue_reader::pop_queue(bool read) { //NOLINT
-    auto it = queue_.top().first;
-    auto end = queue_.top().second;
+    auto cursor = queue_.top();
     queue_.pop();
     if(read) {
-        buf_.set(accessor::record_ref(*it, record_size_));
+        // shallow copy - spilled run keeps the previous record valid until it proceeds again
+        buf_.set(accessor::record_ref(cursor.record(), record_size_));
     }
-    if (++it != end) {
-        queue_.emplace(it, end);
+    if (cursor.next()) {
+        queue_.emplace(cursor);
     }
 }
 
@@ -99,11 +104,12 @@ accessor::record_ref priority_queue_reader::get_group() const {
 void priority_queue_reader::discard_remaining_members_in_group() {
     auto k = info_->extract_key(buf_.ref());
     while(! queue_.empty()) {
-        auto it = queue_.top().first;
-        if (key_comparator_(k, info_->extract_key(accessor::record_ref(*it, record_size_))) != 0) {
+        auto* rec = queue_.top().record();
+        if (key_comparator_(k, info_->extract_key(accessor::record_ref(rec, record_size_))) != 0) {
             break;
         }
-        pop_queue(false);
+        // read into the buffer so that the group key keeps valid after spilled run reuses its record slot
+        pop_queue(true);
     }
 }
 
@@ -124,10 +130,10 @@ bool priority_queue_reader::next_member() {
             state_ = reader_state::after_group;
             return false;
         }
-        auto it = queue_.top().first;
+        auto* rec = queue_.top().record();
         if (key_comparator_(
                 info_->extract_key(buf_.ref()),
-                info_->extract_key(accessor::record_ref(*it, record_size_))) == 0) {
+                info_->extract_key(accessor::record_ref(rec, record_size_))) == 0) {
             pop_queue(true);
             ++record_count_per_group_;
             return true;
@@ -150,16 +156,36 @@ void priority_queue_reader::release() {
     partitions_.clear();
 }
 
-iterator_pair_comparator::iterator_pair_comparator(const group_info *info) :
+merge_cursor::merge_cursor(iterator_pair range) noexcept :
+    range_(range)
+{}
+
+merge_cursor::merge_cursor(shuffle::spilled_run* run) noexcept :
+    run_(run)
+{}
+
+void* merge_cursor::record() const noexcept {
+    if (run_ != nullptr) {
+        return run_->current();
+    }
+    return *range_.first;
+}
+
+bool merge_cursor::next() {
+    if (run_ != nullptr) {
+        return run_->next();
+    }
+    return ++range_.first != range_.second;
+}
+
+merge_cursor_comparator::merge_cursor_comparator(const group_info *info) :
     info_(info),
     record_size_(info_->record_meta()->record_size()),
     key_comparator_(info_->sort_compare_info()) {}
 
-bool iterator_pair_comparator::operator()(const iterator_pair &x, const iterator_pair &y) {
-    auto& it_x = x.first;
-    auto& it_y = y.first;
-    auto key_x = info_->extract_sort_key(accessor::record_ref(*it_x, record_size_));
-    auto key_y = info_->extract_sort_key(accessor::record_ref(*it_y, record_size_));
+bool merge_cursor_comparator::operator()(const merge_cursor &x, const merge_cursor &y) {
+    auto key_x = info_->extract_sort_key(accessor::record_ref(x.record(), record_size_));
+    auto key_y = info_->extract_sort_key(accessor::record_ref(y.record(), record_size_));
     return key_comparator_(key_x, key_y) > 0;
 }
 
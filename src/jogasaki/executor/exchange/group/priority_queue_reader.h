@@ -26,6 +26,7 @@
 #include <jogasaki/executor/comparator.h>
 #include <jogasaki/executor/exchange/group/group_info.h>
 #include <jogasaki/executor/exchange/group/input_partition.h>
+#include <jogasaki/executor/exchange/shuffle/spilled_run.h>
 #include <jogasaki/executor/io/group_reader.h>
 #include <jogasaki/utils/interference_size.h>
 #include <jogasaki/utils/iterator_pair.h>
@@ -38,6 +39,41 @@ using iterator = input_partition::table_iterator;
 
 using iterator_pair = utils::iterator_pair<iterator>;
 
+/**
+ * @brief cursor over the sorted records to merge
+ * @details this points either to the range in the in-memory pointer table or to the spilled run.
+ */
+class merge_cursor {
+public:
+    /**
+     * @brief create cursor over the pointer table range
+     * @param range the range in the pointer table, must not be empty
+     */
+    explicit merge_cursor(iterator_pair range) noexcept;
+
+    /**
+     * @brief create cursor over the spilled run
+     * @param run the run that has been positioned on its first record
+     */
+    explicit merge_cursor(shuffle::spilled_run* run) noexcept;
+
+    /**
+     * @brief returns the pointer to the current record
+     */
+    [[nodiscard]] void* record() const noexcept;
+
+    /**
+     * @brief proceed the cursor
+     * @return true if the cursor points to the next record
+     * @return false if the cursor reached end
+     */
+    [[nodiscard]] bool next();
+
+private:
+    iterator_pair range_{};
+    shuffle::spilled_run* run_{};
+};
+
 enum class reader_state {
     init,
     before_member,
@@ -51,16 +87,16 @@ enum class reader_state {
  * @details like std::greater, this comparator returns true when x > y, where x and y are 1st and 2nd args.
  * This is intended to be used with std::priority_queue, which positions the greatest at the top.
  */
-class iterator_pair_comparator {
+class merge_cursor_comparator {
 public:
     /**
      * @brief construct new object
      * @param info shuffle information
      * @attention info is kept and used by the comparator. The caller must ensure it outlives this object.
      */
-    explicit iterator_pair_comparator(group_info const* info);
+    explicit merge_cursor_comparator(group_info const* info);
 
-    [[nodiscard]] bool operator()(iterator_pair const& x, iterator_pair const& y);
+    [[nodiscard]] bool operator()(merge_cursor const& x, merge_cursor const& y);
 
 private:
     group_info const* info_{};
@@ -98,7 +134,7 @@ public:
 private:
     std::vector<std::unique_ptr<input_partition>>& partitions_;
     std::shared_ptr<group_info> info_{};
-    std::priority_queue<impl::iterator_pair, std::vector<impl::iterator_pair>, impl::iterator_pair_comparator> queue_;
+    std::priority_queue<impl::merge_cursor, std::vector<impl::merge_cursor>, impl::merge_cursor_comparator> queue_;
     std::size_t record_size_{};
 
     // buffer for shallow copy. Not associated with varlen memory resource because this is temporary for comparison
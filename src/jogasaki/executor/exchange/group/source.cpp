@@ -15,6 +15,7 @@
  */
 #include "source.h"
 
+#include <algorithm>
 #include <utility>
 
 #include <jogasaki/configuration.h>
@@ -45,7 +46,10 @@ void source::receive(std::unique_ptr<input_partition> in) {
 }
 
 io::reader_container source::acquire_reader() {
-    if (context_->configuration()->use_sorted_vector()) {
+    bool spilled = std::any_of(partitions_.begin(), partitions_.end(), [](auto const& p) {
+        return p && p->runs_count() != 0;
+    });
+    if (context_->configuration()->use_sorted_vector() && ! spilled) {
         return io::reader_container(
             readers_.emplace_back(std::make_unique<sorted_vector_reader>(info_, partitions_)).get()
         );
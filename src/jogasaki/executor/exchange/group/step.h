@@ -86,6 +86,11 @@ public:
 
     [[nodiscard]] maybe_shared_ptr<meta::group_meta> const& output_meta() const noexcept override;
 
+    /**
+     * @brief accessor to the group information
+     */
+    [[nodiscard]] std::shared_ptr<group_info> const& info() const noexcept;
+
 protected:
     [[nodiscard]] process::step* downstream(std::size_t index) const noexcept;
 
@@ -39,6 +39,12 @@ pointer_table::pointer pointer_table::emplace_back(pointer_table::pointer p) {
     return p;
 }
 
+void pointer_table::truncate(std::size_t size) noexcept {
+    if (size < size_) {
+        size_ = size;
+    }
+}
+
 std::size_t pointer_table::size() const noexcept {
     return size_;
 }
@@ -63,6 +63,12 @@ public:
      */
     pointer emplace_back(pointer p);
 
+    /**
+     * @brief remove the pointers following the first `size` ones
+     * @param size the number of pointers to keep. If it's not less than the current size, nothing happens.
+     */
+    void truncate(std::size_t size) noexcept;
+
     /**
      * @brief getter for the number of data count added to this store
      * @return the number of records
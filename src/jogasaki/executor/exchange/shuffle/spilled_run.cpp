@@ -0,0 +1,215 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "spilled_run.h"
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <unistd.h>
+#include <glog/logging.h>
+
+#include <takatori/util/exception.h>
+
+#include <jogasaki/accessor/binary.h>
+#include <jogasaki/accessor/text.h>
+#include <jogasaki/executor/global.h>
+#include <jogasaki/logging.h>
+#include <jogasaki/logging_helper.h>
+#include <jogasaki/meta/field_type_kind.h>
+#include <jogasaki/meta/field_type_traits.h>
+
+namespace jogasaki::executor::exchange::shuffle {
+
+using takatori::util::throw_exception;
+
+spilled_run::spilled_run(maybe_shared_ptr<meta::record_meta> meta, std::filesystem::path path) :
+    meta_(std::move(meta)),
+    path_(std::move(path)),
+    out_(path_, std::ios::binary | std::ios::trunc)
+{
+    using kind = meta::field_type_kind;
+    for(std::size_t i=0, n=meta_->field_count(); i < n; ++i) {
+        auto k = meta_->at(i).kind();
+        if(k == kind::character || k == kind::octet) {
+            varlen_fields_.emplace_back(i);
+        }
+    }
+    if(! out_) {
+        VLOG_LP(log_error) << "failed to create spill file:" << path_.string();
+    }
+}
+
+spilled_run::~spilled_run() {
+    out_.close();
+    in_.close();
+    if(! path_.empty()) {
+        std::error_code ec{};
+        std::filesystem::remove(path_, ec);
+        if(ec) {
+            VLOG_LP(log_warning) << "failed to remove spill file:" << path_.string() << " " << ec.message();
+        }
+    }
+}
+
+bool spilled_run::write(accessor::record_ref record) {
+    using kind = meta::field_type_kind;
+    if(! out_) {
+        return false;
+    }
+    out_.write(static_cast<char const*>(record.data()), static_cast<std::streamsize>(meta_->record_size()));
+    for(auto i : varlen_fields_) {
+        if(meta_->nullable(i) && record.is_null(meta_->nullity_offset(i))) {
+            continue;
+        }
+        std::string_view sv{};
+        auto offset = meta_->value_offset(i);
+        if(meta_->at(i).kind() == kind::character) {
+            auto t = record.get_value<runtime_t<kind::character>>(offset);
+            sv = static_cast<std::string_view>(t);
+        } else {
+            auto b = record.get_value<runtime_t<kind::octet>>(offset);
+            sv = static_cast<std::string_view>(b);
+        }
+        std::uint64_t len = sv.size();
+        out_.write(reinterpret_cast<char const*>(&len), sizeof(len));  //NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        out_.write(sv.data(), static_cast<std::streamsize>(sv.size()));  //NOLINT(bugprone-suspicious-stringview-data-usage)
+    }
+    if(! out_) {
+        VLOG_LP(log_error) << "failed to write spill file:" << path_.string();
+        return false;
+    }
+    ++count_;
+    return true;
+}
+
+bool spilled_run::finish_write() {
+    out_.close();
+    if(! out_) {
+        VLOG_LP(log_error) << "failed to close spill file:" << path_.string();
+        return false;
+    }
+    for(std::size_t i=0; i < slot_count; ++i) {
+        slots_[i] = data::aligned_buffer{meta_->record_size(), meta_->record_alignment()};  //NOLINT
+        resources_[i] = std::make_unique<memory::lifo_paged_memory_resource>(&global::page_pool());  //NOLINT
+    }
+    return true;
+}
+
+bool spilled_run::next() {
+    using kind = meta::field_type_kind;
+    if(read_count_ >= count_) {
+        current_ = nullptr;
+        in_.close();
+        return false;
+    }
+    if(! in_.is_open()) {
+        in_.clear();
+        in_.open(path_, std::ios::binary);
+        if(! in_) {
+            throw_exception(std::runtime_error{"failed to open spill file: " + path_.string()});
+        }
+    }
+    // switch the slot so that the previous record keeps valid
+    current_slot_ = (current_slot_ + 1) % slot_count;
+    auto& slot = slots_[current_slot_];  //NOLINT
+    auto& resource = resources_[current_slot_];  //NOLINT
+    resource->deallocate_after(memory::lifo_paged_memory_resource::initial_checkpoint);
+    in_.read(static_cast<char*>(slot.data()), static_cast<std::streamsize>(meta_->record_size()));
+    accessor::record_ref rec{slot.data(), meta_->record_size()};
+    for(auto i : varlen_fields_) {
+        if(meta_->nullable(i) && rec.is_null(meta_->nullity_offset(i))) {
+            continue;
+        }
+        std::uint64_t len{};
+        in_.read(reinterpret_cast<char*>(&len), sizeof(len));  //NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        if(! in_) break;
+        varlen_buf_.resize(len);
+        in_.read(varlen_buf_.data(), static_cast<std::streamsize>(len));
+        auto offset = meta_->value_offset(i);
+        if(meta_->at(i).kind() == kind::character) {
+            rec.set_value<runtime_t<kind::character>>(offset, accessor::text{resource.get(), varlen_buf_});
+        } else {
+            rec.set_value<runtime_t<kind::octet>>(offset, accessor::binary{resource.get(), varlen_buf_});
+        }
+    }
+    if(! in_) {
+        throw_exception(std::runtime_error{"spill file is corrupted or cannot be read: " + path_.string()});
+    }
+    ++read_count_;
+    current_ = slot.data();
+    return true;
+}
+
+void spilled_run::rewind() {
+    in_.close();
+    in_.clear();
+    read_count_ = 0;
+    current_ = nullptr;
+}
+
+void* spilled_run::current() const noexcept {
+    return current_;
+}
+
+std::size_t spilled_run::count() const noexcept {
+    return count_;
+}
+
+std::filesystem::path const& spilled_run::path() const noexcept {
+    return path_;
+}
+
+std::size_t spilled_run::record_bytes(meta::record_meta const& meta, accessor::record_ref record) noexcept {
+    using kind = meta::field_type_kind;
+    std::size_t ret = meta.record_size();
+    for(std::size_t i=0, n=meta.field_count(); i < n; ++i) {
+        auto k = meta.at(i).kind();
+        if(k != kind::character && k != kind::octet) {
+            continue;
+        }
+        if(meta.nullable(i) && record.is_null(meta.nullity_offset(i))) {
+            continue;
+        }
+        auto offset = meta.value_offset(i);
+        if(k == kind::character) {
+            ret += record.get_value<runtime_t<kind::character>>(offset).size();
+        } else {
+            ret += record.get_value<runtime_t<kind::octet>>(offset).size();
+        }
+    }
+    return ret;
+}
+
+std::filesystem::path spilled_run::create_path(std::string_view directory) {
+    static std::atomic_size_t seq{0};
+    std::filesystem::path dir{};
+    if(directory.empty()) {
+        std::error_code ec{};
+        dir = std::filesystem::temp_directory_path(ec);
+        if(ec) {
+            dir = "/tmp";
+        }
+    } else {
+        dir = directory;
+    }
+    auto name = "jogasaki_spill_" + std::to_string(::getpid()) + "_" + std::to_string(seq++) + ".tmp";
+    return dir / name;
+}
+
+}  // namespace jogasaki::executor::exchange::shuffle
@@ -0,0 +1,150 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include <takatori/util/maybe_shared_ptr.h>
+
+#include <jogasaki/accessor/record_ref.h>
+#include <jogasaki/data/aligned_buffer.h>
+#include <jogasaki/memory/lifo_paged_memory_resource.h>
+#include <jogasaki/meta/record_meta.h>
+
+namespace jogasaki::executor::exchange::shuffle {
+
+using takatori::util::maybe_shared_ptr;
+
+/**
+ * @brief sorted run of records spilled to a local temporary file
+ * @details exchange input partitions write the records of their sorted pointer tables into this object when their
+ * memory budget is exceeded, and the exchange readers merge the records read back from the file.
+ * Each record is stored as its fixed length part followed by the content of the varlen (character/octet) fields.
+ * The file is kept open only while it is written or read, so that idle runs do not consume file descriptors.
+ * The file is removed when this object is destroyed.
+ */
+class spilled_run {
+public:
+    /**
+     * @brief create empty object
+     */
+    spilled_run() = default;
+
+    /**
+     * @brief destruct the object removing the backing file
+     */
+    ~spilled_run();
+
+    spilled_run(spilled_run const& other) = delete;
+    spilled_run& operator=(spilled_run const& other) = delete;
+    spilled_run(spilled_run&& other) noexcept = delete;
+    spilled_run& operator=(spilled_run&& other) noexcept = delete;
+
+    /**
+     * @brief create new object and open the file to write
+     * @param meta the metadata of the records stored in this run
+     * @param path the path of the file to create
+     */
+    spilled_run(maybe_shared_ptr<meta::record_meta> meta, std::filesystem::path path);
+
+    /**
+     * @brief append the record to the run
+     * @param record the record to write. Records must be written in the sort order.
+     * @return true if successful
+     * @return false if I/O error occurred
+     */
+    [[nodiscard]] bool write(accessor::record_ref record);
+
+    /**
+     * @brief finish writing and close the file
+     * @details the file is opened again to read on the first call to next()
+     * @return true if successful
+     * @return false if I/O error occurred
+     */
+    [[nodiscard]] bool finish_write();
+
+    /**
+     * @brief read the next record from the run
+     * @details the record read by this call is available by current(). The record read by the previous call
+     * keeps valid until this function is called again so that the caller can still refer to it while
+     * comparing with the current one. The file is opened on the first call and closed when the run reached its end.
+     * @return true if the next record is available
+     * @return false if the run reached its end
+     * @throws std::runtime_error if the file is corrupted or I/O error occurred
+     */
+    [[nodiscard]] bool next();
+
+    /**
+     * @brief rewind the run so that next() reads the records from the beginning again
+     * @details the file is closed and opened again on the next call to next()
+     */
+    void rewind();
+
+    /**
+     * @brief accessor to the current record
+     * @return the pointer to the current record read by next()
+     */
+    [[nodiscard]] void* current() const noexcept;
+
+    /**
+     * @brief returns the number of records written to this run
+     */
+    [[nodiscard]] std::size_t count() const noexcept;
+
+    /**
+     * @brief returns the path of the backing file
+     */
+    [[nodiscard]] std::filesystem::path const& path() const noexcept;
+
+    /**
+     * @brief create new unique file path for the spilled run
+     * @param directory the directory to create the file. If empty, system temporary directory is used.
+     * @return the file path
+     */
+    [[nodiscard]] static std::filesystem::path create_path(std::string_view directory);
+
+    /**
+     * @brief estimate the memory consumed by the record
+     * @param meta the metadata of the record
+     * @param record the record to estimate
+     * @return the record size plus the length of its varlen (character/octet) data
+     */
+    [[nodiscard]] static std::size_t record_bytes(meta::record_meta const& meta, accessor::record_ref record) noexcept;
+
+private:
+    static constexpr std::size_t slot_count = 2;
+
+    maybe_shared_ptr<meta::record_meta> meta_{};
+    std::filesystem::path path_{};
+    std::vector<std::size_t> varlen_fields_{};
+    std::ofstream out_{};
+    std::ifstream in_{};
+    std::size_t count_{};
+    std::size_t read_count_{};
+    std::array<data::aligned_buffer, slot_count> slots_{};
+    std::array<std::unique_ptr<memory::lifo_paged_memory_resource>, slot_count> resources_{};
+    std::size_t current_slot_{};
+    void* current_{};
+    std::string varlen_buf_{};
+};
+
+}  // namespace jogasaki::executor::exchange::shuffle
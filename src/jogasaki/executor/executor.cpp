@@ -24,6 +24,7 @@
 #include <utility>
 #include <glog/logging.h>
 
+#include <takatori/statement/statement_kind.h>
 #include <takatori/util/downcast.h>
 #include <takatori/util/string_builder.h>
 #include <sharksfin/ErrorCode.h>
@@ -69,6 +70,7 @@
 #include <jogasaki/logging.h>
 #include <jogasaki/logging_helper.h>
 #include <jogasaki/memory/lifo_paged_memory_resource.h>
+#include <jogasaki/memory/memory_tracker.h>
 #include <jogasaki/model/task.h>
 #include <jogasaki/plan/executable_statement.h>
 #include <jogasaki/plan/mirror_container.h>
@@ -690,6 +692,27 @@ static bool validate_authorization(
     return true;
 }
 
+static bool validate_memory_admission(
+    request_context& rctx,  //NOLINT
+    error_info_stats_callback on_completion //NOLINT(performance-unnecessary-value-param)
+) {
+    // reject new statement if the server is near the memory limit so that running requests can complete
+    auto& tracker = *global::memory_tracker();
+    if(! tracker.reaches(rctx.configuration()->memory_admission_percentage())) {
+        return true;
+    }
+    VLOG_LP(log_error) << "statement rejected due to memory pressure consumed:" << tracker.consumed()
+                       << " limit:" << tracker.limit();
+    auto res = status::err_resource_limit_reached;
+    on_completion(res,
+        create_error_info(
+            error_code::sql_limit_reached_exception,
+            "The SQL engine is running out of memory. Retry after running requests complete.",
+            res
+        ), nullptr);
+    return false;
+}
+
 bool execute_async_on_context(  //NOLINT(readability-function-cognitive-complexity)
     api::impl::database& database,
     std::shared_ptr<request_context> rctx,  //NOLINT
@@ -704,6 +727,11 @@ bool execute_async_on_context(  //NOLINT(readability-function-cognitive-complexi
     }
     rctx->enable_stats();
     auto& e = s.body();
+    if (e->is_execute() || (!e->is_ddl() && !e->is_empty())) {
+        if(! validate_memory_admission(*rctx, on_completion)) {
+            return true; // false is for unrecoverable abnormal error. This case is normal error.
+        }
+    }
     auto job = rctx->job();
     auto& ts = *rctx->scheduler();
 
@@ -806,6 +834,9 @@ bool execute_async_on_context(  //NOLINT(readability-function-cognitive-complexi
     // DDL
     scheduler::statement_scheduler sched{ database.configuration(), *database.task_scheduler()};
     sched.schedule(*e->operators(), *rctx);
+    // statements compiled with the previous schema must not be shared any more (invalidate even on error
+    // since the schema may be partially updated)
+    database.statement_cache().invalidate();
     external_log_stmt_end(*rctx, req_info, statement);
     if(rctx->transaction() && rctx->status_code() != status::ok) {
         abort_transaction(rctx->transaction(), req_info);
@@ -826,7 +857,8 @@ bool execute_load(
     maybe_shared_ptr<api::parameter_set const> parameters,
     std::vector<std::string> files,
     error_info_callback on_completion,
-    request_info const& req_info
+    request_info const& req_info,
+    std::optional<file::column_value_range> range
 ) {
     (void) req_info;
     auto req = std::make_shared<scheduler::request_detail>(scheduler::request_detail_kind::load);
@@ -855,7 +887,9 @@ bool execute_load(
         std::move(stmt),
         std::move(parameters),
         tx,
-        database
+        database,
+        executor::file::loader::default_bulk_size,
+        std::move(range)
     );
     rctx->job()->callback([on_completion=std::move(on_completion), rctx, ldr](){  // callback is copy-based
         (void)ldr; // to keep ownership
@@ -873,6 +907,67 @@ bool execute_load(
     return true;
 }
 
+bool execute_batch(
+    api::impl::database& database,
+    std::shared_ptr<transaction_context> tx,  //NOLINT(performance-unnecessary-value-param)
+    api::statement_handle prepared,
+    std::vector<std::shared_ptr<api::parameter_set>> parameter_sets,
+    error_info_batch_stats_callback on_completion,
+    request_info const& req_info
+) {
+    auto req = std::make_shared<scheduler::request_detail>(scheduler::request_detail_kind::batch);
+    req->status(scheduler::request_detail_status::accepted);
+    auto stmt = get_statement(prepared);
+    if (stmt == nullptr) {
+        auto err = create_statement_handle_error(prepared);
+        auto rc = err->status();
+        on_completion(rc, std::move(err), {});
+        return false;
+    }
+    if (stmt->has_result_records()) {
+        auto msg = "batch execution of the statement with result records is unsupported";
+        VLOG_LP(log_error) << msg;
+        auto rc = status::err_unsupported;
+        on_completion(rc, create_error_info(error_code::unsupported_runtime_feature_exception, msg, rc), {});
+        return false;
+    }
+    req->statement_text(stmt->body()->sql_text_shared());  //NOLINT
+    log_request(*req);
+
+    auto rctx = create_request_context(
+        database,
+        tx,
+        nullptr,
+        std::make_shared<memory::lifo_paged_memory_resource>(&global::page_pool()),
+        req_info,
+        false,
+        req
+    );
+    // INSERT with VALUES has no read, so it can be pipelined as the load does. Others can depend on
+    // the preceding executions in the batch, so they are executed one by one.
+    bool pipelined = stmt->body()->statement()->kind() == takatori::statement::statement_kind::write;
+    auto ldr = std::make_shared<executor::file::loader>(
+        std::move(parameter_sets),
+        std::move(stmt),
+        tx,
+        database,
+        pipelined ? executor::file::loader::default_bulk_size : 1
+    );
+    rctx->job()->callback([on_completion=std::move(on_completion), rctx, ldr](){  // callback is copy-based
+        on_completion(rctx->status_code(), rctx->error_info(), ldr->statistics());
+    });
+    auto& ts = *rctx->scheduler();
+    req->status(scheduler::request_detail_status::submitted);
+    log_request(*req);
+
+    ts.schedule_task(scheduler::flat_task{
+        scheduler::task_enum_tag<scheduler::flat_task_kind::load>,
+        rctx.get(),
+        std::move(ldr)
+    });
+    return true;
+}
+
 static bool is_last(commit_response_kind_set const& response_kinds, commit_response_kind kind) {
     auto f = std::find(response_kinds.begin(), response_kinds.end(), kind);
     if(f == response_kinds.end()) {
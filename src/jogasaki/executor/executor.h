@@ -18,6 +18,7 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -32,6 +33,7 @@
 #include <jogasaki/api/statement_handle.h>
 #include <jogasaki/api/transaction_handle.h>
 #include <jogasaki/error/error_info.h>
+#include <jogasaki/executor/file/file_reader.h>
 #include <jogasaki/executor/io/dump_config.h>
 #include <jogasaki/executor/io/record_channel.h>
 #include <jogasaki/kvs/transaction_option.h>
@@ -68,6 +70,13 @@ using error_info_stats_callback = std::function<
     void(status, std::shared_ptr<error::error_info>, std::shared_ptr<request_statistics>)
 >;
 
+/**
+ * @brief the callback type exchanging statistics information for each statement in the batch
+ */
+using error_info_batch_stats_callback = std::function<
+    void(status, std::shared_ptr<error::error_info>, std::vector<std::shared_ptr<request_statistics>> const&)
+>;
+
 /**
  * @brief commit the transaction
  * @param database the database to request execution
@@ -311,6 +320,7 @@ bool execute_dump(
  * @param files the list of file path to be loaded
  * @param on_completion callback on completion of load
  * @param req_info exchange the original request/response info (mainly for logging purpose)
+ * @param range the column value range used to skip the row groups by their statistics, or nullopt to read all
  * @return status::ok when successful
  * @return error otherwise
  */
@@ -321,6 +331,32 @@ bool execute_load(
     maybe_shared_ptr<api::parameter_set const> parameters,
     std::vector<std::string> files,
     error_info_callback on_completion,
+    request_info const& req_info = {},
+    std::optional<file::column_value_range> range = {}
+);
+
+/**
+ * @brief execute the prepared statement for each of the parameter sets
+ * @details the statement is compiled once and executed in the given transaction for each parameter set.
+ * Statements without read (i.e. INSERT with VALUES) are executed concurrently as the load does, while the
+ * others are executed one by one in the order of parameter sets.
+ * If any execution fails, the transaction is aborted and the error is reported via the callback.
+ * @param database the database to request execution
+ * @param tx the transaction used to execute the request
+ * @param prepared statement to execute, which must not have result records
+ * @param parameter_sets the parameter sets, each of which is used for one statement execution
+ * @param on_completion callback on completion of all executions, receiving the statistics of each execution
+ * in the order of parameter sets
+ * @param req_info exchange the original request/response info (mainly for logging purpose)
+ * @return true when the request is successfully submitted
+ * @return false otherwise - the error is reported via the callback
+ */
+bool execute_batch(
+    api::impl::database& database,
+    std::shared_ptr<transaction_context> tx,
+    api::statement_handle prepared,
+    std::vector<std::shared_ptr<api::parameter_set>> parameter_sets,
+    error_info_batch_stats_callback on_completion,
     request_info const& req_info = {}
 );
 
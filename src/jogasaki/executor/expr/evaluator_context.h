@@ -29,6 +29,7 @@
 #include <jogasaki/relay/blob_session_container.h>
 
 #include "error.h"
+#include "like_pattern.h"
 
 namespace jogasaki::executor::expr {
 
@@ -258,6 +259,22 @@ public:
         return blob_session_container_;
     }
 
+    /**
+     * @brief set the cache for compiled LIKE patterns
+     * @param arg pointer to the cache owned by the operator context, or nullptr to compile the pattern on each evaluation
+     */
+    void like_patterns(like_pattern_cache* arg) noexcept {
+        like_patterns_ = arg;
+    }
+
+    /**
+     * @brief get the cache for compiled LIKE patterns
+     * @return pointer to the cache, or nullptr if not set
+     */
+    [[nodiscard]] like_pattern_cache* like_patterns() const noexcept {
+        return like_patterns_;
+    }
+
 private:
     memory_resource* resource_{};
     loss_precision_policy loss_precision_policy_{loss_precision_policy::ignore};
@@ -267,6 +284,7 @@ private:
     transaction_context* transaction_context_{};
     std::shared_ptr<jogasaki::error::error_info> error_info_{};
     relay::blob_session_container* blob_session_container_{};
+    like_pattern_cache* like_patterns_{};
 
 };
 
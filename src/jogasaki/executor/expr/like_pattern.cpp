@@ -0,0 +1,367 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "like_pattern.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+#include <jogasaki/utils/utf8_utils.h>
+
+namespace jogasaki::executor::expr {
+
+namespace {
+
+bool is_single_utf8_character(std::string_view view) noexcept {
+    const std::size_t char_size = utils::get_byte(utils::detect_next_encoding(view, 0));
+    return (char_size != 0 && char_size == view.size());
+}
+
+// Check if the escape sequence at the end of the pattern is unescaped
+bool has_unescaped_trailing_escape(std::string_view pattern, std::string_view escape) {
+    // escape must be non-empty and shorter than pattern
+    if (escape.empty() || pattern.size() < escape.size()) { return false; }
+    // Check if the pattern ends with the escape sequence
+    if (!std::equal(escape.begin(), escape.end(), pattern.end() - escape.size())) { return false; }
+
+    std::size_t count           = 0;
+    std::size_t last_escape_pos = pattern.size() - escape.size();
+    // Count how many times the escape sequence appears at the end of the pattern
+    while (last_escape_pos >= escape.size()) {
+        last_escape_pos -= escape.size();
+        if (std::equal(escape.begin(), escape.end(), pattern.begin() + last_escape_pos)) {
+            ++count;
+        } else {
+            break;
+        }
+    }
+    // If the count of escape sequences is odd, it means the last escape is unescaped
+    // If the count is even, it means the last escape is escaped
+    return (count % 2 == 0);
+}
+
+inline bool is_escape_sequence(std::string_view pattern, size_t i, std::string_view escape) noexcept {
+    return !escape.empty() && i + escape.size() <= pattern.size() &&
+           pattern.substr(i, escape.size()) == escape;
+}
+
+bool starts_with(std::string_view str, std::string_view prefix) noexcept {
+    return str.size() >= prefix.size() && str.substr(0, prefix.size()) == prefix;
+}
+
+bool ends_with(std::string_view str, std::string_view suffix) noexcept {
+    return str.size() >= suffix.size() && str.substr(str.size() - suffix.size()) == suffix;
+}
+
+}  // namespace
+
+bool contains_literal(std::string_view input, std::string_view literal) noexcept {
+    if (literal.empty()) { return true; }
+    if (input.size() < literal.size()) { return false; }
+    char const* p = input.data();
+    // the last position where the literal can start
+    char const* last = input.data() + (input.size() - literal.size());  //NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    char const first = literal[0];
+    std::size_t const rest = literal.size() - 1;
+    while (p <= last) {
+        auto const* found = static_cast<char const*>(std::memchr(p, first, static_cast<std::size_t>(last - p) + 1));
+        if (found == nullptr) { return false; }
+        if (std::memcmp(found + 1, literal.data() + 1, rest) == 0) {  //NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            return true;
+        }
+        p = found + 1;  //NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+    return false;
+}
+
+like_pattern::compile_result like_pattern::compile(std::string_view pattern, std::string_view escape) {
+    tokens_.clear();
+    literals_.clear();
+    shape_ = shape::empty;
+    literal_ = {};
+    if (!escape.empty() && !is_single_utf8_character(escape)) {
+        return compile_result::invalid_input_value;
+    }
+    if (pattern.empty()) {
+        return compile_result::ok;
+    }
+    if (!utils::is_valid_utf8(pattern)) { return compile_result::null_result; }
+    if (escape == pattern) { return compile_result::invalid_input_value; }
+    if (has_unescaped_trailing_escape(pattern, escape)) {
+        return compile_result::invalid_input_value;
+    }
+    tokenize(pattern, escape);
+    resolve_shape();
+    return compile_result::ok;
+}
+
+void like_pattern::tokenize(std::string_view pattern, std::string_view escape) {
+    // literal bytes are accumulated in literals_ and the tokens refer to them by offset
+    std::size_t begin = 0;
+    auto flush = [&]() {
+        if (literals_.size() != begin) {
+            tokens_.emplace_back(token{token::kind::literal, begin, literals_.size() - begin});
+        }
+        begin = literals_.size();
+    };
+    literals_.reserve(pattern.size());
+    size_t i{0};
+    while (i < pattern.size()) {
+        // match escape
+        if (is_escape_sequence(pattern, i, escape)) {
+            i += escape.size();
+            size_t char_size = utils::get_byte(utils::detect_next_encoding(pattern, i));
+            for (size_t j = 0; j < char_size && i < pattern.size(); ++j) {
+                literals_ += pattern[i++];
+            }
+        } else if (pattern[i] == '%') {
+            flush();
+            // Avoid adding multiple consecutive wildcard_any tokens
+            if (tokens_.empty() || tokens_.back().kind_ != token::kind::wildcard_any) {
+                tokens_.emplace_back(token{token::kind::wildcard_any, 0, 0});
+            }
+            ++i;
+        } else if (pattern[i] == '_') {
+            flush();
+            tokens_.emplace_back(token{token::kind::wildcard_one, 0, 0});
+            ++i;
+        } else {
+            size_t char_size = utils::get_byte(utils::detect_next_encoding(pattern, i));
+            for (size_t j = 0; j < char_size && i < pattern.size(); ++j) {
+                literals_ += pattern[i++];
+            }
+        }
+    }
+    flush();
+}
+
+void like_pattern::resolve_shape() noexcept {
+    using k = token::kind;
+    auto is = [&](std::size_t i, k kd) {
+        return tokens_[i].kind_ == kd;
+    };
+    shape_ = shape::general;
+    switch (tokens_.size()) {
+        case 1:
+            if (is(0, k::wildcard_any)) {
+                shape_ = shape::any;
+            } else if (is(0, k::literal)) {
+                shape_ = shape::exact;
+                literal_ = tokens_[0];
+            }
+            break;
+        case 2:
+            if (is(0, k::literal) && is(1, k::wildcard_any)) {
+                shape_ = shape::prefix;
+                literal_ = tokens_[0];
+            } else if (is(0, k::wildcard_any) && is(1, k::literal)) {
+                shape_ = shape::suffix;
+                literal_ = tokens_[1];
+            }
+            break;
+        case 3:
+            if (is(0, k::wildcard_any) && is(1, k::literal) && is(2, k::wildcard_any)) {
+                shape_ = shape::contains;
+                literal_ = tokens_[1];
+            }
+            break;
+        default: break;
+    }
+}
+
+bool like_pattern::match(std::string_view input) const noexcept {
+    // literals are valid utf-8 and utf-8 is self-synchronizing, so byte-wise comparison never matches
+    // in the middle of a character
+    switch (shape_) {
+        case shape::empty: return input.empty();
+        case shape::any: return true;
+        case shape::exact: return input == value_of(literal_);
+        case shape::prefix: return starts_with(input, value_of(literal_));
+        case shape::suffix: return ends_with(input, value_of(literal_));
+        case shape::contains: return contains_literal(input, value_of(literal_));
+        case shape::general: return match_general(input);
+    }
+    return match_general(input);
+}
+
+/**
+ * @brief Match the input string with the given LIKE-style pattern.
+ *
+ * This function checks whether the given input string matches a pattern
+ * expressed as a sequence of tokens.
+ * The pattern can include:
+ *
+ *   - literal tokens: must match exactly.
+ *   - wildcard_one (`_`): matches exactly one character (UTF-8 aware).
+ *   - wildcard_any (`%`): matches zero or more characters (greedy).
+ *
+ * Matching is **greedy with backtracking**, meaning:
+ *
+ *   - When encountering a `wildcard_any` token (`%`), the algorithm
+ *     initially assumes it matches zero characters (non-consuming match).
+ *   - If later matching fails, the algorithm *backtracks* to this
+ *     `wildcard_any` position and attempts to consume one more character,
+ *     retrying the rest of the pattern.
+ *   - This continues until a successful match is found or all possibilities
+ *     are exhausted.
+ *
+ *   Example:
+ *  - Input:   "abcde"
+ *  - Pattern: "a%de"
+ *
+ *  a -> matches 'a' (literal)
+ *       input_index += tok.value.size()(1)
+ *       ++pattern_index(1)
+ *  % -> (wildcard_any)
+ *       backtrack_pattern_index = pattern_index(1);
+ *       backtrack_input_index   = input_index(1);
+ *       ++pattern_i(2);
+ *  d -> not match  "bcde"
+ *        ++backtrack_input_index(2);
+ *        input_index   = backtrack_input_index(1)
+ *        pattern_index = backtrack_pattern_index(1) + 1;
+ *  d -> not match  "cde"
+ *        ++backtrack_input_index(3);
+ *        input_index   = backtrack_input_index(3)
+ *        pattern_index = backtrack_pattern_index(1) + 1;
+ *  d  -> match  "de"
+ *        input_index += tok.value.size()(4);
+ *        ++pattern_index(3);
+ *  e  -> match  "e"
+ *        input_index += tok.value.size()(5)
+ *        ++pattern_index(4)
+ *  input_index(5) == input.size(5) -> true
+ *
+ * @param input   The UTF-8 encoded input string to be matched.
+ * @return true if the input matches the pattern; false otherwise.
+ */
+bool like_pattern::match_general(std::string_view input) const noexcept {
+    auto const& pattern = tokens_;
+    std::size_t pattern_index = 0;
+    std::size_t input_index   = 0;
+
+    std::size_t backtrack_pattern_index = std::string::npos;
+    std::size_t backtrack_input_index   = std::string::npos;
+
+    // retry from the last wildcard_any consuming one more byte, returns false if there is no wildcard_any
+    auto backtrack = [&]() {
+        if (backtrack_pattern_index == std::string::npos) {
+            return false;
+        }
+        ++backtrack_input_index;
+        input_index   = backtrack_input_index;
+        pattern_index = backtrack_pattern_index + 1;
+        return true;
+    };
+
+    while (input_index <= input.size()) {
+        if (pattern_index < pattern.size()) {
+            token const& tok = pattern[pattern_index];
+            switch (tok.kind_) {
+                case token::kind::literal: {
+                    auto value = value_of(tok);
+                    if (starts_with(input.substr(input_index), value)) {
+                        input_index += value.size();
+                        ++pattern_index;
+                        break;
+                    }
+                    if (! backtrack()) { return false; }
+                    break;
+                }
+                case token::kind::wildcard_one:
+                    if (input_index < input.size()) {
+                        std::size_t char_size = utils::get_byte(utils::detect_next_encoding(input, input_index));
+                        if (input_index + char_size <= input.size()) {
+                            input_index += char_size;
+                            ++pattern_index;
+                            break;
+                        }
+                        return false;
+                    }
+                    if (! backtrack()) { return false; }
+                    break;
+                case token::kind::wildcard_any:
+                    backtrack_pattern_index = pattern_index;
+                    backtrack_input_index   = input_index;
+                    ++pattern_index;
+                    break;
+            }
+            // Digest all patterns
+        } else {
+            if (input_index == input.size()) { return true; }
+            // input 'a' and pattern '%' reaches here
+            // input 'abcde' and pattern 'abc' fails here as there is no backtrack point
+            if (! backtrack()) { return false; }
+        }
+    }
+    // input 'abc' and pattern 'abc%%%' reaches here
+    while (pattern_index < pattern.size() &&
+           pattern[pattern_index].kind_ == token::kind::wildcard_any) {
+        ++pattern_index;
+    }
+    return pattern_index == pattern.size();
+}
+
+like_pattern::shape like_pattern::kind() const noexcept {
+    return shape_;
+}
+
+std::string_view like_pattern::literal_prefix() const noexcept {
+    if (tokens_.empty() || tokens_[0].kind_ != token::kind::literal) {
+        return {};
+    }
+    return value_of(tokens_[0]);
+}
+
+std::vector<like_pattern::token> const& like_pattern::tokens() const noexcept {
+    return tokens_;
+}
+
+std::string_view like_pattern::value_of(token const& t) const noexcept {
+    return std::string_view{literals_}.substr(t.offset_, t.length_);
+}
+
+like_pattern_cache::entry const& like_pattern_cache::get(
+    void const* key,
+    std::string_view pattern,
+    std::string_view escape
+) {
+    entry* e = nullptr;
+    for (auto&& ent : entries_) {
+        if (ent.key_ == key) {
+            if (ent.pattern_ == pattern && ent.escape_ == escape) {
+                return ent;
+            }
+            e = std::addressof(ent);
+            break;
+        }
+    }
+    if (e == nullptr) {
+        e = std::addressof(entries_.emplace_back());
+        e->key_ = key;
+    }
+    e->pattern_.assign(pattern);
+    e->escape_.assign(escape);
+    e->result_ = e->compiled_.compile(pattern, escape);
+    ++compile_count_;
+    return *e;
+}
+
+std::size_t like_pattern_cache::compile_count() const noexcept {
+    return compile_count_;
+}
+
+}  // namespace jogasaki::executor::expr
@@ -0,0 +1,192 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace jogasaki::executor::expr {
+
+/**
+ * @brief compiled LIKE pattern
+ * @details the pattern is tokenized once into literals and wildcards so that it can be matched against many inputs.
+ * Common shapes (`lit`, `lit%`, `%lit` and `%lit%`) are detected on compilation and matched without the general
+ * backtracking algorithm.
+ */
+class like_pattern {
+public:
+    /**
+     * @brief the result of the compilation
+     */
+    enum class compile_result {
+        /// pattern is compiled successfully
+        ok,
+        /// pattern or escape is invalid (e.g. multi-character escape, unescaped trailing escape)
+        invalid_input_value,
+        /// pattern is not a valid utf-8 string and the match results in null
+        null_result,
+    };
+
+    /**
+     * @brief the shape of the pattern
+     */
+    enum class shape {
+        /// empty pattern - matches only empty input
+        empty,
+        /// `%` - matches any input
+        any,
+        /// `lit` - exact match
+        exact,
+        /// `lit%` - prefix match
+        prefix,
+        /// `%lit` - suffix match
+        suffix,
+        /// `%lit%` - substring match
+        contains,
+        /// others - matched by the backtracking algorithm
+        general,
+    };
+
+    /**
+     * @brief the pattern token
+     */
+    struct token {
+        enum class kind {
+            /// A literal string
+            literal,
+            /// A wildcard (`%`) that matches zero or more characters (greedy).
+            wildcard_any,
+            /// A wildcard (`_`) that matches exactly one character.
+            wildcard_one
+        };
+        kind kind_{kind::literal};  //NOLINT
+        /// the offset of the literal value in the literal buffer (used only if kind == literal)
+        std::size_t offset_{};  //NOLINT
+        /// the length of the literal value (used only if kind == literal)
+        std::size_t length_{};  //NOLINT
+    };
+
+    /**
+     * @brief create empty object
+     */
+    like_pattern() = default;
+
+    /**
+     * @brief compile the pattern
+     * @details the validation is done in the same order as the evaluation of LIKE expression, so the same
+     * error is reported regardless of whether the pattern is compiled or cached.
+     * On failure, this object is left empty.
+     * @param pattern the LIKE pattern
+     * @param escape the escape character, or empty if none
+     * @return the result of the compilation
+     */
+    compile_result compile(std::string_view pattern, std::string_view escape);
+
+    /**
+     * @brief match the input with the compiled pattern
+     * @param input the utf-8 encoded input. The caller must validate the encoding unless the shape is `empty`.
+     * @return true if the input matches the pattern
+     */
+    [[nodiscard]] bool match(std::string_view input) const noexcept;
+
+    /**
+     * @brief accessor to the pattern shape
+     */
+    [[nodiscard]] shape kind() const noexcept;
+
+    /**
+     * @brief returns the literal prefix that every matching input starts with
+     * @details this is useful to narrow the scan range for the pattern, e.g. `abc%` limits the range to the keys
+     * starting with `abc`. If the shape is `exact`, the prefix is the whole pattern.
+     * @return the literal prefix, or empty if the pattern starts with a wildcard
+     */
+    [[nodiscard]] std::string_view literal_prefix() const noexcept;
+
+    /**
+     * @brief accessor to the tokens
+     */
+    [[nodiscard]] std::vector<token> const& tokens() const noexcept;
+
+private:
+    std::vector<token> tokens_{};
+    std::string literals_{};
+    shape shape_{shape::empty};
+    // the token holding the literal for the fast paths - offset/length are kept instead of string_view
+    // so that the object can be copied or moved
+    token literal_{};
+
+    [[nodiscard]] std::string_view value_of(token const& t) const noexcept;
+    [[nodiscard]] bool match_general(std::string_view input) const noexcept;
+    void tokenize(std::string_view pattern, std::string_view escape);
+    void resolve_shape() noexcept;
+};
+
+/**
+ * @brief find the literal in the input
+ * @details this searches the first byte with `memchr` (vectorized by the C library) and compares the rest,
+ * which is faster than byte-by-byte search for the typical input.
+ * @return true if the input contains the literal
+ */
+[[nodiscard]] bool contains_literal(std::string_view input, std::string_view literal) noexcept;
+
+/**
+ * @brief cache of compiled LIKE patterns
+ * @details the cache is owned by the operator context and keeps the last compiled pattern for each LIKE expression,
+ * so constant patterns or repeated host variables are compiled only once per context.
+ * The entry is re-compiled when the pattern or escape differs from the last one.
+ * @note this object is not thread-safe. Use one cache per operator context.
+ */
+class like_pattern_cache {
+public:
+    /**
+     * @brief the cached entry
+     */
+    struct entry {
+        void const* key_{};  //NOLINT
+        std::string pattern_{};  //NOLINT
+        std::string escape_{};  //NOLINT
+        like_pattern::compile_result result_{};  //NOLINT
+        like_pattern compiled_{};  //NOLINT
+    };
+
+    /**
+     * @brief create new object
+     */
+    like_pattern_cache() = default;
+
+    /**
+     * @brief find the compiled pattern, or compile it if the cache has no matching entry
+     * @param key the key to identify the LIKE expression (typically the address of the expression node)
+     * @param pattern the LIKE pattern
+     * @param escape the escape character, or empty if none
+     * @return the entry for the pattern
+     */
+    [[nodiscard]] entry const& get(void const* key, std::string_view pattern, std::string_view escape);
+
+    /**
+     * @brief returns the number of compilations done by this cache (for testing)
+     */
+    [[nodiscard]] std::size_t compile_count() const noexcept;
+
+private:
+    // the number of LIKE expressions in an operator is small, so linear search is enough
+    std::vector<entry> entries_{};
+    std::size_t compile_count_{};
+};
+
+}  // namespace jogasaki::executor::expr
@@ -16,6 +16,8 @@
 #pragma once
 
 #include <iomanip>
+#include <memory>
+#include <string>
 #include <string_view>
 #include <boost/filesystem.hpp>
 
@@ -23,6 +25,7 @@
 
 #include <jogasaki/accessor/record_ref.h>
 #include <jogasaki/data/aligned_buffer.h>
+#include <jogasaki/data/any.h>
 #include <jogasaki/meta/external_record_meta.h>
 #include <jogasaki/utils/assert.h>
 
@@ -48,6 +51,34 @@ struct reader_field_locator {
     bool empty_{true};  //NOLINT
 };
 
+/**
+ * @brief range of the column values used to skip the row groups
+ * @details the row groups whose min/max statistics of the column show no value in the range are skipped.
+ * Rows in the remaining row groups are not filtered by the range.
+ * @note text/binary bounds refer to the caller's buffer, which must be kept while the range is in use. The caller can
+ * pass its ownership to `owner_` so that the buffer lives as long as the range.
+ */
+struct column_value_range {
+    column_value_range() = default;
+
+    /**
+     * @brief create new object
+     * @param column the column name in the file
+     * @param lower the lower bound (inclusive) of the values, or empty if unbounded
+     * @param upper the upper bound (inclusive) of the values, or empty if unbounded
+     */
+    column_value_range(std::string_view column, data::any lower, data::any upper) noexcept :
+        column_(column),
+        lower_(lower),
+        upper_(upper)
+    {}
+
+    std::string column_{};  //NOLINT
+    data::any lower_{};  //NOLINT
+    data::any upper_{};  //NOLINT
+    std::shared_ptr<void const> owner_{};  //NOLINT
+};
+
 class reader_option {
 public:
 
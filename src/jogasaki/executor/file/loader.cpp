@@ -21,36 +21,52 @@
 #include <type_traits>
 #include <glog/logging.h>
 
+#include <takatori/statement/statement_kind.h>
+#include <takatori/util/downcast.h>
 #include <takatori/util/maybe_shared_ptr.h>
 
 #include <jogasaki/accessor/record_ref.h>
 #include <jogasaki/accessor/text.h>
 #include <jogasaki/api/impl/database.h>
+#include <jogasaki/api/impl/executable_statement.h>
 #include <jogasaki/api/impl/parameter_set.h>
 #include <jogasaki/api/impl/prepared_statement.h>
 #include <jogasaki/api/parameter_set.h>
 #include <jogasaki/api/statement_handle.h>
+#include <jogasaki/configuration.h>
 #include <jogasaki/data/any.h>
 #include <jogasaki/error/error_info.h>
+#include <jogasaki/error/error_info_factory.h>
+#include <jogasaki/error_code.h>
+#include <jogasaki/executor/common/write_statement.h>
 #include <jogasaki/executor/executor.h>
 #include <jogasaki/executor/file/file_reader.h>
 #include <jogasaki/executor/file/parquet_reader.h>
+#include <jogasaki/executor/global.h>
 #include <jogasaki/executor/process/impl/variable_table_info.h>
 #include <jogasaki/logging.h>
 #include <jogasaki/logging_helper.h>
+#include <jogasaki/memory/lifo_paged_memory_resource.h>
+#include <jogasaki/memory/memory_tracker.h>
 #include <jogasaki/meta/field_type.h>
 #include <jogasaki/meta/field_type_traits.h>
+#include <jogasaki/plan/executable_statement.h>
 #include <jogasaki/plan/mirror_container.h>
 #include <jogasaki/plan/parameter_set.h>
 #include <jogasaki/plan/prepared_statement.h>
+#include <jogasaki/request_context.h>
 #include <jogasaki/request_statistics.h>
 #include <jogasaki/status.h>
+#include <jogasaki/storage/storage_manager.h>
 #include <jogasaki/transaction_context.h>
+#include <jogasaki/transaction_state_kind.h>
+#include <jogasaki/utils/copy_field_data.h>
 #include <jogasaki/utils/fail.h>
 
 namespace jogasaki::executor::file {
 
 using takatori::util::maybe_shared_ptr;
+using takatori::util::unsafe_downcast;
 
 loader::loader(
     std::vector<std::string> files,
@@ -58,7 +74,8 @@ loader::loader(
     maybe_shared_ptr<api::parameter_set const> parameters,
     std::shared_ptr<transaction_context> tx,
     api::impl::database& db,
-    std::size_t bulk_size
+    std::size_t bulk_size,
+    std::optional<column_value_range> range
 ) noexcept:
     files_(std::move(files)),
     statement_(std::move(statement)),
@@ -66,9 +83,27 @@ loader::loader(
     tx_(std::move(tx)),
     db_(std::addressof(db)),
     next_file_(files_.begin()),
+    range_(std::move(range)),
     bulk_size_(bulk_size)
 {}
 
+loader::loader(
+    std::vector<std::shared_ptr<api::parameter_set>> parameter_sets,
+    std::shared_ptr<api::impl::prepared_statement> statement,
+    std::shared_ptr<transaction_context> tx,
+    api::impl::database& db,
+    std::size_t bulk_size
+) noexcept:
+    statement_(std::move(statement)),
+    tx_(std::move(tx)),
+    db_(std::addressof(db)),
+    next_file_(files_.begin()),
+    bulk_size_(bulk_size),
+    from_parameter_sets_(true),
+    parameter_sets_(std::move(parameter_sets)),
+    statistics_(parameter_sets_.size())
+{}
+
 static meta::field_type_kind
 host_variable_type(executor::process::impl::variable_table_info const& vinfo, std::string_view name) {
     auto idx = vinfo.at(name).index();
@@ -160,6 +195,7 @@ loader_result loader::operator()() {  //NOLINT(readability-function-cognitive-co
             // currently err_aborted should be used in order to report tx aborted. When abort can be reported
             // in different channel, original status code should be passed. TODO
             status_ = status::err_aborted;
+            release_direct();
             executor::abort_transaction(tx_, {}); // TODO fill request info
             VLOG_LP(log_info) << "transaction aborted";
             error_aborted_ = true;
@@ -175,36 +211,64 @@ loader_result loader::operator()() {  //NOLINT(readability-function-cognitive-co
         return loader_result::running;
     }
     for(std::size_t i=0; i < slots; ++i) {
-        // read records, assign host variables, submit tasks
-        auto ps = std::shared_ptr<api::parameter_set>{parameters_->clone()};
-        if(! reader_) {
-            if(next_file_ == files_.end()) {
-                // reading all files completed
+        std::shared_ptr<api::parameter_set> ps{};
+        std::size_t position = next_parameter_set_;
+        if(from_parameter_sets_) {
+            if(next_parameter_set_ == parameter_sets_.size()) {
+                // all parameter sets are submitted
                 more_to_read_ = false;
                 return running_statement_count_ != 0 ? loader_result::running : loader_result::ok;
             }
-
-            reader_option opt{};
-            create_reader_option_and_mapping(*parameters_, *statement_, mapping_, opt);
-            reader_ = parquet_reader::open(*next_file_, std::addressof(opt));
-            ++next_file_;
+            ps = std::move(parameter_sets_[next_parameter_set_]);
+            ++next_parameter_set_;
+        } else {
+            // read records, assign host variables, submit tasks
             if(! reader_) {
-                status_ = status::err_io_error;
-                msg_ = "opening parquet file failed.";
-                VLOG_LP(log_error) << msg_;
-                error_aborting_ = true;
-                return loader_result::running;
+                if(! open_next_reader()) {
+                    status_ = status::err_io_error;
+                    msg_ = "opening parquet file failed.";
+                    VLOG_LP(log_error) << msg_;
+                    error_aborting_ = true;
+                    return loader_result::running;
+                }
+                if(! reader_) {
+                    // reading all files completed
+                    more_to_read_ = false;
+                    release_direct();
+                    return running_statement_count_ != 0 ? loader_result::running : loader_result::ok;
+                }
+                if(! direct_checked_) {
+                    prepare_direct();
+                    direct_checked_ = true;
+                }
             }
-        }
 
-        accessor::record_ref ref{};
-        if(! reader_->next(ref)) {
-            reader_->close();
-            reader_.reset();
-            continue;
-        }
+            accessor::record_ref ref{};
+            if(! reader_->next(ref)) {
+                reader_->close();
+                reader_.reset();
+                continue;
+            }
 
-        set_parameter(*ps, ref, mapping_);
+            if(direct_context_) {
+                if(! write_direct(ref)) {
+                    auto& info = direct_context_->error_info();
+                    std::stringstream ss{};
+                    ss << "load failed with the statement position:" << records_loaded_
+                       << " status:" << direct_context_->status_code()
+                       << " with message \"" << (info ? info->message() : "") << "\"";
+                    status_ = direct_context_->status_code();
+                    msg_ = ss.str();
+                    VLOG_LP(log_error) << msg_;  //NOLINT
+                    error_aborting_ = true;
+                    return loader_result::running;
+                }
+                ++records_loaded_;
+                continue;
+            }
+            ps = std::shared_ptr<api::parameter_set>{parameters_->clone()};
+            set_parameter(*ps, ref, mapping_);
+        }
 
         ++running_statement_count_;
         executor::execute_async(
@@ -213,16 +277,20 @@ loader_result loader::operator()() {  //NOLINT(readability-function-cognitive-co
             statement_,
             std::move(ps),
             nullptr,
-            [&](
+            [&, position](
                 status st,
                 std::shared_ptr<error::error_info> info,  //NOLINT(performance-unnecessary-value-param)
                 std::shared_ptr<request_statistics> stats  //NOLINT(performance-unnecessary-value-param)
             ){
-                (void) stats; // TODO
+                if(from_parameter_sets_) {
+                    // each callback touches distinct element, and the loader reads them after all completed
+                    statistics_[position] = std::move(stats);
+                }
                 --running_statement_count_;
                 if(st != status::ok) {
                     std::stringstream ss{};
-                    ss << "load failed with the statement position:" << records_loaded_ << " status:" << st
+                    ss << (from_parameter_sets_ ? "batch" : "load") << " failed with the statement position:"
+                       << (from_parameter_sets_ ? position : records_loaded_.load()) << " status:" << st
                        << " with message \"" << (info ? info->message() : "") << "\"";
                     status_ = st;
                     msg_ = ss.str();
@@ -237,6 +305,132 @@ loader_result loader::operator()() {  //NOLINT(readability-function-cognitive-co
     return loader_result::running;
 }
 
+bool loader::open_next_reader() {
+    while(next_row_group_ >= row_groups_.size()) {
+        if(next_file_ == files_.end()) {
+            return true;
+        }
+        current_file_ = *next_file_;
+        ++next_file_;
+        next_row_group_ = 0;
+        std::size_t row_group_count{};
+        if(! parquet_reader::find_row_groups(
+               current_file_, range_ ? std::addressof(*range_) : nullptr, row_groups_, row_group_count)) {
+            return false;
+        }
+        if(auto skipped = row_group_count - row_groups_.size(); skipped != 0) {
+            VLOG_LP(log_debug) << "row groups skipped file:" << current_file_ << " count:" << skipped;
+            row_groups_skipped_ += skipped;
+        }
+    }
+    reader_option opt{};
+    create_reader_option_and_mapping(*parameters_, *statement_, mapping_, opt);
+    auto reader = parquet_reader::open(current_file_, std::addressof(opt), row_groups_[next_row_group_++]);
+    if(! reader) {
+        return false;
+    }
+    reader_ = std::move(reader);
+    return true;
+}
+
+void loader::prepare_direct() {
+    if(! db_->configuration()->direct_load() ||
+        statement_->body()->statement()->kind() != takatori::statement::statement_kind::write) {
+        return;
+    }
+    // compile the statement once with the columns to load left null - they are filled by write_direct()
+    auto ps = std::shared_ptr<api::parameter_set>{parameters_->clone()};
+    auto pset = static_cast<api::impl::parameter_set&>(*ps).body();  //NOLINT
+    for(auto&& [name, param] : mapping_) {
+        pset->set_null(name);
+    }
+    std::unique_ptr<api::executable_statement> exec{};
+    std::shared_ptr<error::error_info> err_info{};
+    if(auto rc = db_->resolve_common(
+            *statement_,
+            std::shared_ptr<api::parameter_set const>{std::move(ps)},
+            exec,
+            err_info
+        ); rc != status::ok) {
+        // leave reporting error to the statement execution for each record
+        VLOG_LP(log_debug) << "direct load is not available status:" << rc;
+        return;
+    }
+    // acquire the storage lock and pin the storages as the statement execution does - the lock is held
+    // during the direct load so that DDL cannot drop the target while records are written
+    auto& e = unsafe_downcast<api::impl::executable_statement>(*exec).body();
+    auto stgs = e->mirrors()->storage_operation().storage();
+    auto lock = global::storage_manager()->create_shared_lock(stgs, tx_->storage_lock().get());
+    if(! lock) {
+        // leave reporting error to the statement execution for each record
+        VLOG_LP(log_debug) << "direct load is not available as the storage is locked by DDL";
+        return;
+    }
+    tx_->add_storages_ref(stgs);
+    direct_statement_ = std::move(exec);
+    direct_context_ = std::make_shared<request_context>(
+        db_->configuration(),
+        std::make_shared<memory::lifo_paged_memory_resource>(&global::page_pool()),
+        db_->kvs_db(),
+        tx_,
+        db_->sequence_manager()
+    );
+    direct_context_->storage_lock(std::move(lock));
+    direct_context_->enable_stats();
+}
+
+void loader::release_direct() {
+    if(direct_context_) {
+        direct_context_->storage_lock(nullptr);
+    }
+}
+
+bool loader::write_direct(accessor::record_ref ref) {
+    auto& stmt = *unsafe_downcast<api::impl::executable_statement>(*direct_statement_).body();
+    auto& vars = *stmt.host_variables();
+    auto& meta = *vars.meta();
+    auto target = vars.store().ref();
+    for(auto&& [name, param] : mapping_) {
+        // the reader creates records with the host variables layout, so the offsets are common
+        utils::copy_nullable_field(
+            meta.at(param.index_),
+            target,
+            param.value_offset_,
+            param.nullity_offset_,
+            ref,
+            param.value_offset_,
+            param.nullity_offset_
+        );
+    }
+    // validate as the statement execution does for each record
+    if(global::memory_tracker()->reaches(db_->configuration()->memory_admission_percentage())) {
+        auto res = status::err_resource_limit_reached;
+        set_error_context(
+            *direct_context_,
+            error_code::sql_limit_reached_exception,
+            "The SQL engine is running out of memory. Retry after running requests complete.",
+            res
+        );
+        return false;
+    }
+    auto st = tx_->state();
+    if (st != transaction_state_kind::init &&
+        st != transaction_state_kind::active &&
+        st != transaction_state_kind::unknown // for unknown, let tx engine to check if it's active
+    ) {
+        auto res = status::err_inactive_transaction;
+        set_error_context(
+            *direct_context_,
+            error_code::inactive_transaction_exception,
+            "Current transaction is inactive (maybe aborted already.)",
+            res
+        );
+        return false;
+    }
+    std::unique_lock lk{tx_->mutex()};
+    return unsafe_downcast<common::write_statement>(*stmt.operators()).process(*direct_context_);
+}
+
 std::atomic_size_t& loader::running_statement_count() noexcept {
     return running_statement_count_;
 }
@@ -249,4 +443,12 @@ std::pair<status, std::string> loader::error_info() const noexcept {
     return {status_, msg_};
 }
 
+std::size_t loader::row_groups_skipped() const noexcept {
+    return row_groups_skipped_;
+}
+
+std::vector<std::shared_ptr<request_statistics>> const& loader::statistics() const noexcept {
+    return statistics_;
+}
+
 }  // namespace jogasaki::executor::file
@@ -20,6 +20,7 @@
 #include <cstdlib>
 #include <iosfwd>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -28,12 +29,15 @@
 
 #include <takatori/util/maybe_shared_ptr.h>
 
+#include <jogasaki/api/executable_statement.h>
 #include <jogasaki/api/impl/prepared_statement.h>
 #include <jogasaki/api/parameter_set.h>
 #include <jogasaki/api/statement_handle.h>
 #include <jogasaki/executor/file/file_reader.h>
 #include <jogasaki/meta/external_record_meta.h>
+#include <jogasaki/accessor/record_ref.h>
 #include <jogasaki/meta/field_type_kind.h>
+#include <jogasaki/request_statistics.h>
 #include <jogasaki/status.h>
 #include <jogasaki/utils/interference_size.h>
 
@@ -100,6 +104,11 @@ inline std::ostream& operator<<(std::ostream& out, loader_result value) {
 
 /**
  * @brief loader to conduct reading files and executing statements
+ * @details the parameters for each statement execution are read from the files, or taken from the list of
+ * parameter sets given on construction (batch execution).
+ * When the records are read from files for INSERT statement, the loader compiles the statement once and writes
+ * each record directly to the kvs (direct load) instead of scheduling statement execution for each record.
+ * This is enabled by `configuration::direct_load()`.
  */
 class cache_align loader {
 public:
@@ -119,6 +128,13 @@ public:
 
     /**
      * @brief create new object
+     * @param files the files to read the records from. All row groups in the files are read.
+     * @param statement the statement to execute
+     * @param parameters the parameters for the statement. The ones referring columns are filled from the files.
+     * @param tx the transaction used to execute the statements
+     * @param db the database to execute the statements
+     * @param bulk_size the max number of statements executed concurrently
+     * @param range the column value range used to skip the row groups by their statistics, or nullopt to read all
      */
     loader(
         std::vector<std::string> files,
@@ -126,6 +142,24 @@ public:
         maybe_shared_ptr<api::parameter_set const> parameters,
         std::shared_ptr<transaction_context> tx,
         api::impl::database& db,
+        std::size_t bulk_size = default_bulk_size,
+        std::optional<column_value_range> range = {}
+    ) noexcept;
+
+    /**
+     * @brief create new object executing the statement for each of the given parameter sets
+     * @param parameter_sets the parameter sets, each of which is used for one statement execution
+     * @param statement the statement to execute
+     * @param tx the transaction used to execute the statements
+     * @param db the database to execute the statements
+     * @param bulk_size the max number of statements executed concurrently. Specify 1 to execute the statements
+     * one by one in the order of parameter sets.
+     */
+    loader(
+        std::vector<std::shared_ptr<api::parameter_set>> parameter_sets,
+        std::shared_ptr<api::impl::prepared_statement> statement,
+        std::shared_ptr<transaction_context> tx,
+        api::impl::database& db,
         std::size_t bulk_size = default_bulk_size
     ) noexcept;
 
@@ -155,6 +189,19 @@ public:
      */
     [[nodiscard]] std::pair<status, std::string> error_info() const noexcept;
 
+    /**
+     * @brief accessor to the number of row groups skipped by the range given on construction
+     */
+    [[nodiscard]] std::size_t row_groups_skipped() const noexcept;
+
+    /**
+     * @brief accessor to the statistics of each statement execution
+     * @return the statistics in the order of the parameter sets given on construction (empty if the
+     * parameters are read from files)
+     * @note this is valid only after all statements are completed
+     */
+    [[nodiscard]] std::vector<std::shared_ptr<request_statistics>> const& statistics() const noexcept;
+
 private:
 
     std::vector<std::string> files_{};
@@ -167,6 +214,11 @@ private:
     std::atomic_size_t records_loaded_{0};
     maybe_shared_ptr<meta::external_record_meta> meta_{};
     decltype(files_)::const_iterator next_file_{};
+    std::string current_file_{};
+    std::vector<std::size_t> row_groups_{};
+    std::size_t next_row_group_{};
+    std::optional<column_value_range> range_{};
+    std::size_t row_groups_skipped_{};
     std::unordered_map<std::string, parameter> mapping_{};
     std::size_t bulk_size_{};
     bool more_to_read_{true};
@@ -174,6 +226,18 @@ private:
     std::string msg_{};
     bool error_aborting_{false};
     bool error_aborted_{false};
+    bool from_parameter_sets_{false};
+    std::vector<std::shared_ptr<api::parameter_set>> parameter_sets_{};
+    std::size_t next_parameter_set_{};
+    std::vector<std::shared_ptr<request_statistics>> statistics_{};
+    bool direct_checked_{false};
+    std::unique_ptr<api::executable_statement> direct_statement_{};
+    std::shared_ptr<request_context> direct_context_{};
+
+    bool open_next_reader();
+    void prepare_direct();
+    void release_direct();
+    bool write_direct(accessor::record_ref ref);
 };
 
 }  // namespace executor::file
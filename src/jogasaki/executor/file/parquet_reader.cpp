@@ -21,9 +21,11 @@
 #include <cstdlib>
 #include <exception>
 #include <iterator>
+#include <memory>
 #include <optional>
 #include <ostream>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -40,6 +42,7 @@
 #include <parquet/file_reader.h>
 #include <parquet/metadata.h>
 #include <parquet/schema.h>
+#include <parquet/statistics.h>
 #include <parquet/types.h>
 
 #include <takatori/datetime/time_of_day.h>
@@ -51,6 +54,7 @@
 #include <jogasaki/accessor/record_ref.h>
 #include <jogasaki/accessor/text.h>
 #include <jogasaki/data/aligned_buffer.h>
+#include <jogasaki/data/any.h>
 #include <jogasaki/executor/file/file_reader.h>
 #include <jogasaki/logging.h>
 #include <jogasaki/logging_helper.h>
@@ -73,6 +77,64 @@ using takatori::util::maybe_shared_ptr;
 using takatori::util::string_builder;
 using takatori::util::unsafe_downcast;
 
+/**
+ * @brief the number of rows read from a column at once
+ */
+constexpr static std::size_t parquet_reader_batch_size = 1024;
+
+/**
+ * @brief column values read by a single ReadBatch call and consumed row by row
+ * @details each value buffer is allocated on the first use, so only the one matching the column type is used.
+ * For BYTE_ARRAY columns, the values refer to the page data of the column reader, which stays valid until the
+ * next ReadBatch call on the column.
+ */
+struct column_batch {
+    std::vector<std::int16_t> definition_levels_{};
+    std::vector<std::int32_t> int32_values_{};
+    std::vector<std::int64_t> int64_values_{};
+    std::vector<float> float_values_{};
+    std::vector<double> double_values_{};
+    std::unique_ptr<bool[]> bool_values_{};  //NOLINT(modernize-avoid-c-arrays)
+    std::vector<parquet::ByteArray> byte_array_values_{};
+    std::int64_t levels_read_{};
+    std::int64_t values_read_{};
+    std::int64_t level_pos_{};
+    std::int64_t value_pos_{};
+
+    template <class T>
+    T* values() {
+        if constexpr (std::is_same_v<T, bool>) {
+            if(! bool_values_) {
+                bool_values_ = std::make_unique<bool[]>(parquet_reader_batch_size);  //NOLINT(modernize-avoid-c-arrays)
+            }
+            return bool_values_.get();
+        } else {
+            auto& v = vector_of<T>();
+            if(v.size() < parquet_reader_batch_size) {
+                v.resize(parquet_reader_batch_size);
+            }
+            return v.data();
+        }
+    }
+
+private:
+    template <class T>
+    std::vector<T>& vector_of() {
+        if constexpr (std::is_same_v<T, std::int32_t>) {
+            return int32_values_;
+        } else if constexpr (std::is_same_v<T, std::int64_t>) {
+            return int64_values_;
+        } else if constexpr (std::is_same_v<T, float>) {
+            return float_values_;
+        } else if constexpr (std::is_same_v<T, double>) {
+            return double_values_;
+        } else {
+            static_assert(std::is_same_v<T, parquet::ByteArray>);
+            return byte_array_values_;
+        }
+    }
+};
+
 class parquet_reader::impl {
 public:
     impl() = default;
@@ -103,6 +165,8 @@ public:
 
     bool init(std::string_view path, reader_option const* opt, std::size_t row_group_index);
 
+    [[nodiscard]] bool row_group_in_range(std::size_t row_group_index, column_value_range const& range) const;
+
 private:
 
     maybe_shared_ptr<meta::external_record_meta> meta_{};
@@ -110,6 +174,7 @@ private:
     std::unique_ptr<parquet::ParquetFileReader> file_reader_{};
     std::shared_ptr<parquet::RowGroupReader> row_group_reader_{};
     std::vector<std::shared_ptr<parquet::ColumnReader>> column_readers_{};
+    std::vector<column_batch> column_batches_{};
     std::vector<parquet::ColumnDescriptor const*> columns_{};
     boost::filesystem::path path_{};
     std::size_t read_count_{};
@@ -119,132 +184,124 @@ private:
     std::size_t row_group_index_{};
 };
 
+/**
+ * @brief fetch the next value of the column, reading next batch if the current one is consumed
+ * @return true if the value is fetched
+ * @return false if the column has no more data
+ */
 template <class T, class Reader>
-static std::enable_if_t<! std::is_same_v<T, std::int8_t>, T>
-read_data(parquet::ColumnReader& reader, parquet::ColumnDescriptor const&, bool& null, bool& nodata) {
-    int64_t values_read = 0;
-    int64_t rows_read = 0;
-    int16_t definition_level = 0;
+static bool next_value(parquet::ColumnReader& reader, column_batch& batch, T& value, bool& null) {
     null = false;
-    nodata = false;
-    auto* r = static_cast<Reader*>(std::addressof(reader));
-    if(! r->HasNext()) {
-        nodata = true;
-        return {};
-    }
-    T value{};
-    rows_read = r->ReadBatch(1, &definition_level, nullptr, &value, &values_read);
-    if(rows_read == 1) {
-        if (values_read == 0 && definition_level == 0) {
-            null = true;
-            return {};
+    if(batch.level_pos_ >= batch.levels_read_) {
+        auto* r = static_cast<Reader*>(std::addressof(reader));
+        if(! r->HasNext()) {
+            return false;
         }
-        if (values_read == 1) {
-            return value;
+        if(batch.definition_levels_.size() < parquet_reader_batch_size) {
+            batch.definition_levels_.resize(parquet_reader_batch_size);
         }
+        batch.values_read_ = 0;
+        batch.levels_read_ = r->ReadBatch(
+            static_cast<std::int64_t>(parquet_reader_batch_size),
+            batch.definition_levels_.data(),
+            nullptr,
+            batch.values<T>(),
+            &batch.values_read_
+        );
+        batch.level_pos_ = 0;
+        batch.value_pos_ = 0;
+        if(batch.levels_read_ <= 0) {
+            throw std::logic_error{"column format error"};
+        }
+    }
+    // definition levels are not filled for REQUIRED columns (max definition level 0), whose values are never null
+    auto level = batch.definition_levels_[batch.level_pos_++];
+    auto max_level = reader.descr()->max_definition_level();
+    if(max_level > 0 && level < max_level) {
+        null = true;
+        return true;
     }
-    throw std::logic_error{"column format error"};
+    if(batch.value_pos_ >= batch.values_read_) {
+        throw std::logic_error{"column format error"};
+    }
+    value = batch.values<T>()[batch.value_pos_++];
+    return true;
+}
+
+template <class T, class Reader>
+static std::enable_if_t<! std::is_same_v<T, std::int8_t>, T>
+read_data(
+    parquet::ColumnReader& reader,
+    column_batch& batch,
+    parquet::ColumnDescriptor const&,
+    bool& null,
+    bool& nodata
+) {
+    T value{};
+    nodata = ! next_value<T, Reader>(reader, batch, value, null);
+    return value;
 }
 
 template <class T, class Reader>
 static std::enable_if_t<std::is_same_v<T, std::int8_t>, T>
-read_data(parquet::ColumnReader& reader, parquet::ColumnDescriptor const&, bool& null, bool& nodata) {
-    int64_t values_read = 0;
-    int64_t rows_read = 0;
-    int16_t definition_level = 0;
-    null = false;
-    nodata = false;
-    auto* r = static_cast<Reader*>(std::addressof(reader));
-    if(! r->HasNext()) {
-        nodata = true;
-        return {};
-    }
+read_data(
+    parquet::ColumnReader& reader,
+    column_batch& batch,
+    parquet::ColumnDescriptor const&,
+    bool& null,
+    bool& nodata
+) {
     bool value{};
-    rows_read = r->ReadBatch(1, &definition_level, nullptr, &value, &values_read);
-    if(rows_read == 1) {
-        if (values_read == 0 && definition_level == 0) {
-            null = true;
-            return {};
-        }
-        if (values_read == 1) {
-            return static_cast<std::int8_t>(value ? 1 : 0);
-        }
-    }
-    throw std::logic_error{"column format error"};
+    nodata = ! next_value<bool, Reader>(reader, batch, value, null);
+    return static_cast<std::int8_t>(value ? 1 : 0);
 }
 
 template <class T>
 static std::enable_if_t<std::is_same_v<T, accessor::text> || std::is_same_v<T, accessor::binary>, T>
-read_data(parquet::ColumnReader& reader, parquet::ColumnDescriptor const&, bool& null, bool& nodata) {
-    int64_t values_read = 0;
-    int64_t rows_read = 0;
-    int16_t definition_level = 0;
-    null = false;
-    nodata = false;
-    auto* r = static_cast<parquet::ByteArrayReader*>(std::addressof(reader));  //NOLINT
-    if(! r->HasNext()) {
-        nodata = true;
-        return {};
-    }
-
+read_data(
+    parquet::ColumnReader& reader,
+    column_batch& batch,
+    parquet::ColumnDescriptor const&,
+    bool& null,
+    bool& nodata
+) {
     parquet::ByteArray value{};
-    rows_read = r->ReadBatch(1, &definition_level, nullptr, &value, &values_read);
-    if(rows_read == 1) {
-        if (values_read == 0 && definition_level == 0) {
-            null = true;
-            return {};
-        }
-        if (values_read == 1) {
-            return T{reinterpret_cast<char const*>(value.ptr), value.len};  //NOLINT
-        }
+    nodata = ! next_value<parquet::ByteArray, parquet::ByteArrayReader>(reader, batch, value, null);
+    if(nodata || null) {
+        return {};
     }
-    throw std::logic_error{"column format error"};
+    return T{reinterpret_cast<char const*>(value.ptr), value.len};  //NOLINT
 }
 
 template <>
 runtime_t<meta::field_type_kind::decimal>
 read_data<runtime_t<meta::field_type_kind::decimal>, parquet::ByteArrayReader>(
     parquet::ColumnReader& reader,
+    column_batch& batch,
     parquet::ColumnDescriptor const& type,
     bool& null,
     bool& nodata
 ) {
-    int64_t values_read = 0;
-    int64_t rows_read = 0;
-    int16_t definition_level = 0;
-    null = false;
-    nodata = false;
-    auto* r = static_cast<parquet::ByteArrayReader*>(std::addressof(reader));  //NOLINT
-    if(! r->HasNext()) {
-        nodata = true;
+    parquet::ByteArray value{};
+    nodata = ! next_value<parquet::ByteArray, parquet::ByteArrayReader>(reader, batch, value, null);
+    if(nodata || null) {
         return {};
     }
-
-    parquet::ByteArray value{};
-    rows_read = r->ReadBatch(1, &definition_level, nullptr, &value, &values_read);
-    if(rows_read == 1) {
-        if (values_read == 0 && definition_level == 0) {
-            null = true;
-            return {};
-        }
-        if (values_read == 1) {
-            std::string_view buffer{reinterpret_cast<char const*>(value.ptr), value.len};  //NOLINT
-            if(! utils::validate_decimal_coefficient(buffer)) {
-                throw std::logic_error{"decimal column value error"};
-            }
-            return utils::read_decimal(buffer, type.type_scale());
-        }
+    std::string_view buffer{reinterpret_cast<char const*>(value.ptr), value.len};  //NOLINT
+    if(! utils::validate_decimal_coefficient(buffer)) {
+        throw std::logic_error{"decimal column value error"};
     }
-    throw std::logic_error{"column format error"};
+    return utils::read_decimal(buffer, type.type_scale());
 }
 
 template <>
 runtime_t<meta::field_type_kind::date> read_data<runtime_t<meta::field_type_kind::date>, parquet::Int32Reader>(
     parquet::ColumnReader& reader,
+    column_batch& batch,
     parquet::ColumnDescriptor const& type,
     bool& null,
     bool& nodata) {
-        auto x = read_data<std::int32_t, parquet::Int32Reader>(reader, type, null, nodata);
+        auto x = read_data<std::int32_t, parquet::Int32Reader>(reader, batch, type, null, nodata);
         return runtime_t<meta::field_type_kind::date>{x};
 }
 
@@ -252,11 +309,12 @@ template<>
 runtime_t<meta::field_type_kind::time_of_day>
 read_data<runtime_t<meta::field_type_kind::time_of_day>, parquet::Int64Reader>(
     parquet::ColumnReader& reader,
+    column_batch& batch,
     parquet::ColumnDescriptor const& type,
     bool& null,
     bool& nodata
 ) {
-    auto x = read_data<std::int64_t, parquet::Int64Reader>(reader, type, null, nodata);
+    auto x = read_data<std::int64_t, parquet::Int64Reader>(reader, batch, type, null, nodata);
     return runtime_t<meta::field_type_kind::time_of_day>{std::chrono::nanoseconds{x}};
 }
 
@@ -264,11 +322,12 @@ template<>
 runtime_t<meta::field_type_kind::time_point>
 read_data<runtime_t<meta::field_type_kind::time_point>, parquet::Int64Reader>(
     parquet::ColumnReader& reader,
+    column_batch& batch,
     parquet::ColumnDescriptor const& type,
     bool& null,
     bool& nodata
 ) {
-    auto x = read_data<std::int64_t, parquet::Int64Reader>(reader, type, null, nodata);
+    auto x = read_data<std::int64_t, parquet::Int64Reader>(reader, batch, type, null, nodata);
     auto& lt = unsafe_downcast<parquet::TimestampLogicalType const>(*type.logical_type());
     switch(lt.time_unit()) {
         case parquet::LogicalType::TimeUnit::MILLIS: return runtime_t<meta::field_type_kind::time_point>{std::chrono::milliseconds{x}};
@@ -287,21 +346,22 @@ bool parquet_reader::impl::next(accessor::record_ref& ref) {
             auto colidx = parameter_to_parquet_field_[i];
             if(colidx == npos) continue;
             auto& reader = *column_readers_[colidx];
+            auto& batch = column_batches_[colidx];
             auto& type = *columns_[colidx];
             bool null{false};
             bool nodata{false};
             switch(parameter_meta_->at(i).kind()) {
-                case meta::field_type_kind::boolean: ref.set_value<runtime_t<meta::field_type_kind::boolean>>(parameter_meta_->value_offset(i), read_data<runtime_t<meta::field_type_kind::boolean>, parquet::BoolReader>(reader, type, null, nodata)); break;
-                case meta::field_type_kind::int4: ref.set_value<runtime_t<meta::field_type_kind::int4>>(parameter_meta_->value_offset(i), read_data<runtime_t<meta::field_type_kind::int4>, parquet::Int32Reader>(reader, type, null, nodata)); break;
-                case meta::field_type_kind::int8: ref.set_value<runtime_t<meta::field_type_kind::int8>>(parameter_meta_->value_offset(i), read_data<runtime_t<meta::field_type_kind::int8>, parquet::Int64Reader>(reader, type, null, nodata)); break;
-                case meta::field_type_kind::float4: ref.set_value<runtime_t<meta::field_type_kind::float4>>(parameter_meta_->value_offset(i), read_data<runtime_t<meta::field_type_kind::float4>, parquet::FloatReader>(reader, type, null, nodata)); break;
-                case meta::field_type_kind::float8: ref.set_value<runtime_t<meta::field_type_kind::float8>>(parameter_meta_->value_offset(i), read_data<runtime_t<meta::field_type_kind::float8>, parquet::DoubleReader>(reader, type, null, nodata)); break;
-                case meta::field_type_kind::decimal: ref.set_value<runtime_t<meta::field_type_kind::decimal>>(parameter_meta_->value_offset(i), read_data<runtime_t<meta::field_type_kind::decimal>, parquet::ByteArrayReader>(reader, type, null, nodata)); break;
-                case meta::field_type_kind::character: ref.set_value<runtime_t<meta::field_type_kind::character>>(parameter_meta_->value_offset(i), read_data<runtime_t<meta::field_type_kind::character>>(reader, type, null, nodata)); break;
-                case meta::field_type_kind::octet: ref.set_value<runtime_t<meta::field_type_kind::octet>>(parameter_meta_->value_offset(i), read_data<runtime_t<meta::field_type_kind::octet>>(reader, type, null, nodata)); break;
-                case meta::field_type_kind::date: ref.set_value<runtime_t<meta::field_type_kind::date>>(parameter_meta_->value_offset(i), read_data<runtime_t<meta::field_type_kind::date>, parquet::Int32Reader>(reader, type, null, nodata)); break;
-                case meta::field_type_kind::time_of_day: ref.set_value<runtime_t<meta::field_type_kind::time_of_day>>(parameter_meta_->value_offset(i), read_data<runtime_t<meta::field_type_kind::time_of_day>, parquet::Int64Reader>(reader, type, null, nodata)); break;
-                case meta::field_type_kind::time_point: ref.set_value<runtime_t<meta::field_type_kind::time_point>>(parameter_meta_->value_offset(i), read_data<runtime_t<meta::field_type_kind::time_point>, parquet::Int64Reader>(reader, type, null, nodata)); break;
+                case meta::field_type_kind::boolean: ref.set_value<runtime_t<meta::field_type_kind::boolean>>(parameter_meta_->value_offset(i), read_data<runtime_t<meta::field_type_kind::boolean>, parquet::BoolReader>(reader, batch, type, null, nodata)); break;
+                case meta::field_type_kind::int4: ref.set_value<runtime_t<meta::field_type_kind::int4>>(parameter_meta_->value_offset(i), read_data<runtime_t<meta::field_type_kind::int4>, parquet::Int32Reader>(reader, batch, type, null, nodata)); break;
+                case meta::field_type_kind::int8: ref.set_value<runtime_t<meta::field_type_kind::int8>>(parameter_meta_->value_offset(i), read_data<runtime_t<meta::field_type_kind::int8>, parquet::Int64Reader>(reader, batch, type, null, nodata)); break;
+                case meta::field_type_kind::float4: ref.set_value<runtime_t<meta::field_type_kind::float4>>(parameter_meta_->value_offset(i), read_data<runtime_t<meta::field_type_kind::float4>, parquet::FloatReader>(reader, batch, type, null, nodata)); break;
+                case meta::field_type_kind::float8: ref.set_value<runtime_t<meta::field_type_kind::float8>>(parameter_meta_->value_offset(i), read_data<runtime_t<meta::field_type_kind::float8>, parquet::DoubleReader>(reader, batch, type, null, nodata)); break;
+                case meta::field_type_kind::decimal: ref.set_value<runtime_t<meta::field_type_kind::decimal>>(parameter_meta_->value_offset(i), read_data<runtime_t<meta::field_type_kind::decimal>, parquet::ByteArrayReader>(reader, batch, type, null, nodata)); break;
+                case meta::field_type_kind::character: ref.set_value<runtime_t<meta::field_type_kind::character>>(parameter_meta_->value_offset(i), read_data<runtime_t<meta::field_type_kind::character>>(reader, batch, type, null, nodata)); break;
+                case meta::field_type_kind::octet: ref.set_value<runtime_t<meta::field_type_kind::octet>>(parameter_meta_->value_offset(i), read_data<runtime_t<meta::field_type_kind::octet>>(reader, batch, type, null, nodata)); break;
+                case meta::field_type_kind::date: ref.set_value<runtime_t<meta::field_type_kind::date>>(parameter_meta_->value_offset(i), read_data<runtime_t<meta::field_type_kind::date>, parquet::Int32Reader>(reader, batch, type, null, nodata)); break;
+                case meta::field_type_kind::time_of_day: ref.set_value<runtime_t<meta::field_type_kind::time_of_day>>(parameter_meta_->value_offset(i), read_data<runtime_t<meta::field_type_kind::time_of_day>, parquet::Int64Reader>(reader, batch, type, null, nodata)); break;
+                case meta::field_type_kind::time_point: ref.set_value<runtime_t<meta::field_type_kind::time_point>>(parameter_meta_->value_offset(i), read_data<runtime_t<meta::field_type_kind::time_point>, parquet::Int64Reader>(reader, batch, type, null, nodata)); break;
                 default: {
                     VLOG_LP(log_error) << "Parquet reader saw invalid type: " << parameter_meta_->at(i).kind();
                     return false;
@@ -333,6 +393,165 @@ bool parquet_reader::impl::close() {
     return true;
 }
 
+template <class T>
+static bool bound_value(data::any const& bound, std::optional<T>& out) {
+    if(bound.empty()) {
+        return true;
+    }
+    if(bound.type_index() != data::any::index<T>) {
+        return false;
+    }
+    out = bound.to<T>();
+    return true;
+}
+
+static bool date_bound_value(data::any const& bound, std::optional<std::int32_t>& out) {
+    if(bound.empty()) {
+        return true;
+    }
+    if(bound.type_index() != data::any::index<runtime_t<meta::field_type_kind::date>>) {
+        return false;
+    }
+    out = static_cast<std::int32_t>(bound.to<runtime_t<meta::field_type_kind::date>>().days_since_epoch());
+    return true;
+}
+
+static bool byte_array_bound_value(data::any const& bound, std::optional<std::string>& out) {
+    if(bound.empty()) {
+        return true;
+    }
+    if(bound.type_index() == data::any::index<accessor::text>) {
+        auto t = bound.to<accessor::text>();
+        out.emplace(static_cast<std::string_view>(t));
+        return true;
+    }
+    if(bound.type_index() == data::any::index<accessor::binary>) {
+        auto b = bound.to<accessor::binary>();
+        out.emplace(static_cast<std::string_view>(b));
+        return true;
+    }
+    return false;
+}
+
+template <class T>
+static bool overlaps(T const& min, T const& max, std::optional<T> const& lower, std::optional<T> const& upper) {
+    return ! (upper && *upper < min) && ! (lower && max < *lower);
+}
+
+template <class Statistics, class T>
+static bool min_max_overlaps(
+    parquet::Statistics const& stats,
+    std::optional<T> const& lower,
+    std::optional<T> const& upper
+) {
+    auto const& s = static_cast<Statistics const&>(stats);  //NOLINT
+    return overlaps<T>(s.min(), s.max(), lower, upper);
+}
+
+static bool byte_array_min_max_overlaps(
+    parquet::Statistics const& stats,
+    std::optional<std::string> const& lower,
+    std::optional<std::string> const& upper
+) {
+    // BYTE_ARRAY statistics are ordered as unsigned bytes, same as std::string comparison
+    auto const& s = static_cast<parquet::ByteArrayStatistics const&>(stats);  //NOLINT
+    std::string min{reinterpret_cast<char const*>(s.min().ptr), s.min().len};  //NOLINT
+    std::string max{reinterpret_cast<char const*>(s.max().ptr), s.max().len};  //NOLINT
+    return overlaps<std::string>(min, max, lower, upper);
+}
+
+template <class T>
+static bool check_range(
+    parquet::Statistics const& stats,
+    column_value_range const& range,
+    bool (*extract)(data::any const&, std::optional<T>&),
+    bool (*compare)(parquet::Statistics const&, std::optional<T> const&, std::optional<T> const&)
+) {
+    std::optional<T> lower{};
+    std::optional<T> upper{};
+    if(! extract(range.lower_, lower) || ! extract(range.upper_, upper)) {
+        VLOG_LP(log_warning) << "row group range bound type does not match the column:" << range.column_;
+        return true;
+    }
+    return compare(stats, lower, upper);
+}
+
+static bool row_group_overlaps(  //NOLINT(readability-function-cognitive-complexity)
+    parquet::FileMetaData const& file_metadata,
+    std::size_t row_group_index,
+    column_value_range const& range
+) {
+    if(row_group_index >= static_cast<std::size_t>(file_metadata.num_row_groups())) {
+        return true;
+    }
+    if(range.lower_.empty() && range.upper_.empty()) {
+        return true;
+    }
+    try {
+        auto col = file_metadata.schema()->ColumnIndex(range.column_);
+        if(col < 0) {
+            VLOG_LP(log_warning) << "row group range column not found:" << range.column_;
+            return true;
+        }
+        auto rg = file_metadata.RowGroup(static_cast<int>(row_group_index));
+        auto chunk = rg->ColumnChunk(col);
+        auto stats = chunk->is_stats_set() ? chunk->statistics() : nullptr;
+        if(! stats) {
+            return true;
+        }
+        if(! stats->HasMinMax()) {
+            // the column chunk with only nulls has no min/max, and null is not in any range
+            return ! (stats->HasNullCount() && stats->null_count() == rg->num_rows());
+        }
+        auto const& c = *file_metadata.schema()->Column(col);
+        switch(c.physical_type()) {
+            case parquet::Type::type::INT32:
+                if(c.logical_type()->is_date()) {
+                    return check_range<std::int32_t>(
+                        *stats, range, date_bound_value, min_max_overlaps<parquet::Int32Statistics, std::int32_t>
+                    );
+                }
+                return check_range<std::int32_t>(
+                    *stats, range, bound_value<std::int32_t>, min_max_overlaps<parquet::Int32Statistics, std::int32_t>
+                );
+            case parquet::Type::type::INT64:
+                if(c.logical_type()->is_time() || c.logical_type()->is_timestamp()) {
+                    // time unit varies by file, so leave them unsupported
+                    return true;
+                }
+                return check_range<std::int64_t>(
+                    *stats, range, bound_value<std::int64_t>, min_max_overlaps<parquet::Int64Statistics, std::int64_t>
+                );
+            case parquet::Type::type::FLOAT:
+                return check_range<float>(
+                    *stats, range, bound_value<float>, min_max_overlaps<parquet::FloatStatistics, float>
+                );
+            case parquet::Type::type::DOUBLE:
+                return check_range<double>(
+                    *stats, range, bound_value<double>, min_max_overlaps<parquet::DoubleStatistics, double>
+                );
+            case parquet::Type::type::BYTE_ARRAY:
+                if(c.logical_type()->is_decimal()) {
+                    // decimal is compared as signed big-endian integer, which is not supported here
+                    return true;
+                }
+                return check_range<std::string>(*stats, range, byte_array_bound_value, byte_array_min_max_overlaps);
+            default:
+                break;
+        }
+    } catch (std::exception const& e) {
+        VLOG_LP(log_error) << "Parquet reader statistics error: " << e.what();
+    }
+    return true;
+}
+
+bool parquet_reader::impl::row_group_in_range(std::size_t row_group_index, column_value_range const& range) const {
+    if(! file_reader_) {
+        return true;
+    }
+    return row_group_overlaps(*file_reader_->metadata(), row_group_index, range);
+}
+
 static reader_option create_default(meta::record_meta const& meta) {
     std::vector<reader_field_locator> locs{};
     locs.reserve(meta.field_count());
@@ -677,6 +896,7 @@ bool parquet_reader::impl::init(
         for(std::size_t i=0, n=meta_->field_count(); i<n; ++i) {
             column_readers_.emplace_back(row_group_reader_->Column(static_cast<int>(i)));
         }
+        column_batches_.resize(meta_->field_count());
     } catch (std::exception const& e) {
         VLOG_LP(log_error) << "Parquet reader init error: " << e.what();
         return false;
@@ -716,6 +936,36 @@ std::size_t parquet_reader::row_group_count() const noexcept {
     return impl_->row_group_count();
 }
 
+bool parquet_reader::row_group_in_range(std::size_t row_group_index, column_value_range const& range) const {
+    return impl_->row_group_in_range(row_group_index, range);
+}
+
+bool parquet_reader::find_row_groups(
+    std::string_view path,
+    column_value_range const* range,
+    std::vector<std::size_t>& out,
+    std::size_t& row_group_count
+) {
+    out.clear();
+    row_group_count = 0;
+    try {
+        auto file_reader = parquet::ParquetFileReader::OpenFile(std::string{path}, false);
+        auto file_metadata = file_reader->metadata();
+        row_group_count = static_cast<std::size_t>(file_metadata->num_row_groups());
+        out.reserve(row_group_count);
+        for(std::size_t i=0; i < row_group_count; ++i) {
+            if(range == nullptr || row_group_overlaps(*file_metadata, i, *range)) {
+                out.emplace_back(i);
+            }
+        }
+        file_reader->Close();
+    } catch (std::exception const& e) {
+        VLOG_LP(log_error) << "Parquet reader metadata error: " << e.what();
+        return false;
+    }
+    return true;
+}
+
 std::shared_ptr<parquet_reader> parquet_reader::open(
     std::string_view path,
     reader_option const* opt,
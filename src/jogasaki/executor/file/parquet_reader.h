@@ -19,6 +19,7 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include <takatori/util/maybe_shared_ptr.h>
 
@@ -92,6 +93,35 @@ public:
      */
     [[nodiscard]] std::size_t row_group_count() const noexcept override;
 
+    /**
+     * @brief returns whether the row group may contain the values in the range
+     * @details this checks the min/max statistics of the column chunk in the row group. If the statistics is not
+     * available, or the column or bound types are not supported, the row group is treated as possibly matching.
+     * @param row_group_index the 0-origin index of the row group to check
+     * @param range the range of the column values
+     * @return false if the row group is known to have no value in the range
+     * @return true otherwise
+     */
+    [[nodiscard]] bool row_group_in_range(std::size_t row_group_index, column_value_range const& range) const;
+
+    /**
+     * @brief list the row groups in the file that may contain the values in the range
+     * @details this reads the file metadata only once, so that the caller can open readers just for the listed
+     * row groups instead of opening one for each row group to check the statistics.
+     * @param path the path to the parquet file
+     * @param range the range of the column values, or nullptr to list all row groups
+     * @param out [out] the 0-origin indices of the row groups that may contain the values in the range
+     * @param row_group_count [out] the number of row groups in the file
+     * @return true when successful
+     * @return false if the file metadata cannot be read
+     */
+    static bool find_row_groups(
+        std::string_view path,
+        column_value_range const* range,
+        std::vector<std::size_t>& out,
+        std::size_t& row_group_count
+    );
+
     /**
      * @brief factory function to construct the new parquet_reader object
      * @param path the path to the pqrquet file to read
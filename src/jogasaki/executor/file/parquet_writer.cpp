@@ -20,6 +20,8 @@
 #include <exception>
 #include <optional>
 #include <ostream>
+#include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -73,6 +75,38 @@ using parquet::Type;
 using parquet::schema::GroupNode;
 using parquet::schema::PrimitiveNode;
 
+/**
+ * @brief the number of rows buffered before they are passed to the column writers
+ */
+constexpr static std::size_t parquet_writer_batch_size = 1024;
+
+/**
+ * @brief column values buffered until they are written by a single WriteBatch call
+ * @details only the value buffer matching the column type is used. BYTE_ARRAY values are copied into `bytes_`
+ * and kept as offset/length because the source record is not valid after the write call returns.
+ */
+struct column_buffer {
+    std::vector<std::int16_t> definition_levels_{};
+    std::vector<std::int32_t> int32_values_{};
+    std::vector<std::int64_t> int64_values_{};
+    std::vector<float> float_values_{};
+    std::vector<double> double_values_{};
+    std::string bytes_{};
+    std::vector<std::pair<std::size_t, std::size_t>> byte_array_ranges_{};
+    std::vector<parquet::ByteArray> byte_array_values_{};
+
+    void clear() noexcept {
+        definition_levels_.clear();
+        int32_values_.clear();
+        int64_values_.clear();
+        float_values_.clear();
+        double_values_.clear();
+        bytes_.clear();
+        byte_array_ranges_.clear();
+        byte_array_values_.clear();
+    }
+};
+
 class parquet_writer::impl {
 public:
     impl() = default;
@@ -101,8 +135,7 @@ public:
     }
     void new_row_group();
     [[nodiscard]] std::size_t row_group_max_records() const noexcept {
-        //TODO row group size not used yet
-        return 0;
+        return option_.record_batch_size() > 0 ? static_cast<std::size_t>(option_.record_batch_size()) : 0;
     }
 
     bool init(std::string_view path);
@@ -129,6 +162,8 @@ private:
     template <class T>
     std::enable_if_t<std::is_same_v<T, accessor::text> || std::is_same_v<T, accessor::binary>, bool>
     write_character_or_octet(std::size_t colidx, T v, bool null);
+    bool write_byte_array(std::size_t colidx, std::string_view v);
+    void flush();
 
     maybe_shared_ptr<meta::external_record_meta> meta_{};
     parquet_writer_option option_{};
@@ -136,6 +171,9 @@ private:
     std::shared_ptr<parquet::ParquetFileWriter> file_writer_{};
     parquet::RowGroupWriter* row_group_writer_{};
     std::vector<parquet::ColumnWriter*> column_writers_{};
+    std::vector<column_buffer> column_buffers_{};
+    std::size_t buffered_rows_{};
+    std::size_t row_group_rows_{};
     boost::filesystem::path path_{};
     std::size_t write_count_{};
     std::vector<details::writer_column_option> column_options_{};
@@ -143,14 +181,65 @@ private:
 
 void parquet_writer::impl::new_row_group() {
     if(row_group_writer_) {
+        flush();
         row_group_writer_->Close();
         column_writers_.clear();
     }
     row_group_writer_ = file_writer_->AppendBufferedRowGroup();
+    row_group_rows_ = 0;
     column_writers_.reserve(meta_->field_count());
     for(std::size_t i=0, n=meta_->field_count(); i<n; ++i) {
         column_writers_.emplace_back(row_group_writer_->column(static_cast<int>(i)));
     }
+    column_buffers_.resize(meta_->field_count());
+}
+
+template <class Writer, class T>
+static void write_batch(parquet::ColumnWriter* writer, std::vector<std::int16_t> const& levels, T const* values) {
+    static_cast<Writer*>(writer)->WriteBatch(  //NOLINT
+        static_cast<std::int64_t>(levels.size()),
+        levels.data(),
+        nullptr,
+        values
+    );
+}
+
+void parquet_writer::impl::flush() {
+    if(buffered_rows_ == 0) {
+        return;
+    }
+    using k = meta::field_type_kind;
+    for(std::size_t i=0, n=meta_->field_count(); i<n; ++i) {
+        auto& buf = column_buffers_[i];
+        auto* writer = column_writers_[i];
+        switch(meta_->at(i).kind()) {
+            case k::int4:
+            case k::date: write_batch<parquet::Int32Writer>(writer, buf.definition_levels_, buf.int32_values_.data()); break;
+            case k::int8:
+            case k::time_of_day:
+            case k::time_point: write_batch<parquet::Int64Writer>(writer, buf.definition_levels_, buf.int64_values_.data()); break;
+            case k::float4: write_batch<parquet::FloatWriter>(writer, buf.definition_levels_, buf.float_values_.data()); break;
+            case k::float8: write_batch<parquet::DoubleWriter>(writer, buf.definition_levels_, buf.double_values_.data()); break;
+            case k::character:
+            case k::octet:
+            case k::decimal: {
+                // bytes_ is not re-allocated any more, so the pointers can be fixed now
+                buf.byte_array_values_.reserve(buf.byte_array_ranges_.size());
+                for(auto&& [offset, len] : buf.byte_array_ranges_) {
+                    buf.byte_array_values_.emplace_back(
+                        static_cast<std::uint32_t>(len),
+                        reinterpret_cast<std::uint8_t const*>(buf.bytes_.data() + offset)  //NOLINT
+                    );
+                }
+                write_batch<parquet::ByteArrayWriter>(writer, buf.definition_levels_, buf.byte_array_values_.data());
+                break;
+            }
+            default:
+                break;
+        }
+        buf.clear();
+    }
+    buffered_rows_ = 0;
 }
 
 bool parquet_writer::impl::init(std::string_view path) {
@@ -161,6 +250,8 @@ bool parquet_writer::impl::init(std::string_view path) {
         column_options_ = std::move(colopts);
         parquet::WriterProperties::Builder builder;
         builder.compression(parquet::Compression::SNAPPY);
+        // min/max statistics of each row group are used by the reader to skip row groups
+        builder.enable_statistics();
         file_writer_ = parquet::ParquetFileWriter::Open(fs_, schema, builder.build());
         new_row_group();
     } catch (std::exception const& e) {
@@ -172,6 +263,10 @@ bool parquet_writer::impl::init(std::string_view path) {
 
 bool parquet_writer::impl::write(accessor::record_ref ref) {
     try {
+        if(auto mx = row_group_max_records(); mx != 0 && row_group_rows_ >= mx) {
+            // switch row group lazily so that the file does not end with empty row group
+            new_row_group();
+        }
         using k = meta::field_type_kind;
         for(std::size_t i=0, n=meta_->field_count(); i<n; ++i) {
             bool null = ref.is_null(meta_->nullity_offset(i)) && meta_->nullable(i);
@@ -194,6 +289,10 @@ bool parquet_writer::impl::write(accessor::record_ref ref) {
                 return false;
             }
         }
+        if(++buffered_rows_ >= parquet_writer_batch_size) {
+            flush();
+        }
+        ++row_group_rows_;
     } catch (std::exception const& e) {
         VLOG_LP(log_error) << "Parquet writer write error: " << e.what();
         return false;
@@ -202,67 +301,65 @@ bool parquet_writer::impl::write(accessor::record_ref ref) {
     return true;
 }
 
-template <class T>
-static bool write_null(T* writer) {
-    int16_t definition_level = 0;
-    writer->WriteBatch(1, &definition_level, nullptr, nullptr);
+static bool write_null(column_buffer& buf) {
+    buf.definition_levels_.emplace_back(0);
     return true;
 }
 
 bool parquet_writer::impl::write_int4(std::size_t colidx, int32_t v, bool null) {
-    auto* writer = static_cast<parquet::Int32Writer*>(column_writers_[colidx]);  //NOLINT
+    auto& buf = column_buffers_[colidx];
     if (null) {
-        return write_null(writer);
+        return write_null(buf);
     }
-    int16_t definition_level = 1;
-    writer->WriteBatch(1, &definition_level, nullptr, &v);
+    buf.definition_levels_.emplace_back(1);
+    buf.int32_values_.emplace_back(v);
     return true;
 }
 
 bool parquet_writer::impl::write_int8(std::size_t colidx, std::int64_t v, bool null) {
-    auto* writer = static_cast<parquet::Int64Writer*>(column_writers_[colidx]);  //NOLINT
+    auto& buf = column_buffers_[colidx];
     if (null) {
-        return write_null(writer);
+        return write_null(buf);
     }
-    int16_t definition_level = 1;
-    writer->WriteBatch(1, &definition_level, nullptr, &v);
+    buf.definition_levels_.emplace_back(1);
+    buf.int64_values_.emplace_back(v);
     return true;
 }
 
 bool parquet_writer::impl::write_float4(std::size_t colidx, float v, bool null) {
-    auto* writer = static_cast<parquet::FloatWriter*>(column_writers_[colidx]);  //NOLINT
+    auto& buf = column_buffers_[colidx];
     if (null) {
-        return write_null(writer);
+        return write_null(buf);
     }
-    int16_t definition_level = 1;
-    writer->WriteBatch(1, &definition_level, nullptr, &v);
+    buf.definition_levels_.emplace_back(1);
+    buf.float_values_.emplace_back(v);
     return true;
 }
 
 bool parquet_writer::impl::write_float8(std::size_t colidx, double v, bool null) {
-    auto* writer = static_cast<parquet::DoubleWriter*>(column_writers_[colidx]);  //NOLINT
+    auto& buf = column_buffers_[colidx];
     if (null) {
-        return write_null(writer);
+        return write_null(buf);
     }
-    int16_t definition_level = 1;
-    writer->WriteBatch(1, &definition_level, nullptr, &v);
+    buf.definition_levels_.emplace_back(1);
+    buf.double_values_.emplace_back(v);
     return true;
 }
 
 template <class T>
 std::enable_if_t<std::is_same_v<T, accessor::text> || std::is_same_v<T, accessor::binary>, bool>
 parquet_writer::impl::write_character_or_octet(std::size_t colidx, T v, bool null) {
-    auto* writer = static_cast<parquet::ByteArrayWriter*>(column_writers_[colidx]);  //NOLINT
     if (null) {
-        return write_null(writer);
+        return write_null(column_buffers_[colidx]);
     }
+    return write_byte_array(colidx, static_cast<std::string_view>(v));
+}
 
-    parquet::ByteArray value{};
-    auto sv = static_cast<std::string_view>(v);
-    int16_t definition_level = 1;
-    value.ptr = reinterpret_cast<const uint8_t*>(sv.data());  //NOLINT
-    value.len = sv.size();
-    writer->WriteBatch(1, &definition_level, nullptr, &value);
+bool parquet_writer::impl::write_byte_array(std::size_t colidx, std::string_view v) {
+    auto& buf = column_buffers_[colidx];
+    buf.definition_levels_.emplace_back(1);
+    buf.byte_array_ranges_.emplace_back(buf.bytes_.size(), v.size());
+    buf.bytes_.append(v);
     return true;
 }
 
@@ -280,9 +377,8 @@ bool parquet_writer::impl::write_decimal(
     bool null,
     details::writer_column_option const& colopt
 ) {
-    auto* writer = static_cast<parquet::ByteArrayWriter*>(column_writers_[colidx]);  //NOLINT
     if (null) {
-        return write_null(writer);
+        return write_null(column_buffers_[colidx]);
     }
     auto sv = static_cast<decimal::Decimal>(v);
     decimal::context.clear_status();
@@ -295,13 +391,7 @@ bool parquet_writer::impl::write_decimal(
     utils::decimal_buffer out{};
     auto [hi, lo, sz] = utils::make_signed_coefficient_full(takatori::decimal::triple{y});
     utils::create_decimal(v.sign(), lo, hi, sz, out);
-
-    parquet::ByteArray value{};
-    int16_t definition_level = 1;
-    value.ptr = reinterpret_cast<const uint8_t*>(out.data());  //NOLINT
-    value.len = sz;
-    writer->WriteBatch(1, &definition_level, nullptr, &value);
-    return true;
+    return write_byte_array(colidx, std::string_view{reinterpret_cast<char const*>(out.data()), sz});  //NOLINT
 }
 
 bool parquet_writer::impl::write_date(std::size_t colidx, runtime_t<meta::field_type_kind::date> v, bool null) {
@@ -322,6 +412,7 @@ bool parquet_writer::impl::write_time_point(std::size_t colidx, runtime_t<meta::
 bool parquet_writer::impl::close() {
     if(file_writer_) {
         try {
+            flush();
             file_writer_->Close();
             // Write the bytes to file
             DCHECK(fs_->Close().ok());
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -44,8 +45,22 @@ public:
         return *this;
     }
 
+    /**
+     * @brief accessor to the max number of records written in a row group
+     * @details 0 means the row group is not split unless new_row_group() is called
+     */
+    [[nodiscard]] std::int64_t record_batch_size() const noexcept {
+        return record_batch_size_;
+    }
+
+    parquet_writer_option& record_batch_size(std::int64_t arg) noexcept {
+        record_batch_size_ = arg;
+        return *this;
+    }
+
 private:
     time_unit_kind time_unit_{time_unit_kind::unspecified};
+    std::int64_t record_batch_size_{};
 };
 
 /**
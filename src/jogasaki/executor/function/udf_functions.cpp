@@ -91,6 +91,7 @@
 #include <jogasaki/udf/log/logging_prefix.h>
 #include <jogasaki/udf/plugin_loader.h>
 #include <jogasaki/udf/udf_loader.h>
+#include <jogasaki/udf/udf_result_cache.h>
 #include <jogasaki/utils/assert.h>
 #include <jogasaki/utils/assign_reference_tag.h>
 #include <jogasaki/utils/base64_utils.h>
@@ -861,7 +862,7 @@ void fetch_and_emplace_cast(std::vector<data::any>& result, FetchFn fetch_fn, Ca
     }
 }
 
-std::vector<data::any> cursor_to_any_values(plugin::udf::generic_record_impl& response,
+std::vector<data::any> cursor_to_any_values(plugin::udf::generic_record_impl const& response,
     std::vector<plugin::udf::column_descriptor*> const& cols, evaluator_context& ctx);
 
 void append_string_result(std::vector<data::any>& result,
@@ -890,7 +891,7 @@ void append_bytes_result(std::vector<data::any>& result, plugin::udf::generic_re
 }
 
 void append_nested_result(std::vector<data::any>& result,
-    plugin::udf::generic_record_impl& response, plugin::udf::generic_record_cursor& cursor,
+    plugin::udf::generic_record_impl const& response, plugin::udf::generic_record_cursor& cursor,
     plugin::udf::column_descriptor const& col, evaluator_context& ctx) {
     if (auto nested_cols = col.nested()) {
         auto const& map = response_builder_map();
@@ -905,7 +906,7 @@ void append_nested_result(std::vector<data::any>& result,
     result.emplace_back();
 }
 
-std::vector<data::any> cursor_to_any_values(plugin::udf::generic_record_impl& response,
+std::vector<data::any> cursor_to_any_values(plugin::udf::generic_record_impl const& response,
     std::vector<plugin::udf::column_descriptor*> const& cols, evaluator_context& ctx) {
     std::vector<data::any> result;
 
@@ -1082,7 +1083,7 @@ response_builder_map() {
         };
     return map;
 }
-data::any build_udf_response(plugin::udf::generic_record_impl& response, evaluator_context& ctx,
+data::any build_udf_response(plugin::udf::generic_record_impl const& response, evaluator_context& ctx,
     plugin::udf::function_descriptor const* fn) {
     auto const& output = fn->output_record();
     auto cursor = response.cursor();
@@ -1213,6 +1214,8 @@ make_udf_server_stream_lambda(std::shared_ptr<plugin::udf::generic_client> const
  * - Invoke unary RPC:
  *   `generic_client::call(context, function_index, request, response)`
  * - Convert the response record into a single `data::any` (`build_udf_response()`).
+ * - If `cache` is given, the response is looked up by the serialized request before
+ *   the RPC, and the successful response is stored after the RPC.
  *
  * ### Contrast with server-streaming (table-valued function)
  * - TVF callable returns `std::unique_ptr<data::any_sequence_stream>`,
@@ -1223,17 +1226,25 @@ make_udf_server_stream_lambda(std::shared_ptr<plugin::udf::generic_client> const
  *
  * @param client gRPC UDF client
  * @param fn     function descriptor (function_index, input/output schema, etc.)
+ * @param cache  memoization cache of the function, or nullptr if the results are not memoized
  * @return scalar callable which returns `data::any`
  */
 std::function<data::any(evaluator_context&, sequence_view<data::any>)> make_udf_scalar_lambda(
     std::shared_ptr<plugin::udf::generic_client> const& client,
     std::shared_ptr<const plugin::udf::udf_config> const& cfg,
-    plugin::udf::function_descriptor const* fn) {
-    return [client, fn, cfg](evaluator_context& ctx, sequence_view<data::any> args) -> data::any {
+    plugin::udf::function_descriptor const* fn,
+    std::shared_ptr<plugin::udf::udf_result_cache> cache) {
+    return [client, fn, cfg, cache = std::move(cache)](
+               evaluator_context& ctx, sequence_view<data::any> args) -> data::any {
         plugin::udf::generic_record_impl request;
         if (!build_udf_request(request, ctx, fn, args)) {
             return data::any{std::in_place_type<error>, error(error_kind::udf_error)};
         }
+        std::string key{};
+        if (cache) {
+            request.serialize_values(key);
+            if (auto hit = cache->find(key)) { return build_udf_response(*hit, ctx, fn); }
+        }
         plugin::udf::generic_record_impl response;
         plugin::udf::generic_client_context context;
 
@@ -1252,6 +1263,12 @@ std::function<data::any(evaluator_context&, sequence_view<data::any>)> make_udf_
             ctx.add_error({error_kind::udf_error, msg});
             return data::any{std::in_place_type<error>, error(error_kind::udf_error)};
         }
+        if (cache) {
+            auto stored = std::make_shared<plugin::udf::generic_record_impl>();
+            stored->assign_from(std::move(response));
+            cache->put(key, stored);
+            return build_udf_response(*stored, ctx, fn);
+        }
         return build_udf_response(response, ctx, fn);
     };
 }
@@ -1364,13 +1381,47 @@ void register_server_stream_function(yugawara::function::configurable_provider&
     if (jogasaki::udf::bridge::count_effective_columns(input_record) == 0) { register_tvf({}); }
 }
 
+/**
+ * @brief check whether the columns contain BLOB/CLOB references, including the nested records
+ */
+bool contains_lob_record(std::vector<plugin::udf::column_descriptor*> const& cols) {
+    for (auto* col : cols) {
+        if (!col) continue;
+        if (auto* nested = col->nested()) {
+            auto rn = nested->record_name();
+            if (rn == jogasaki::udf::bridge::BLOB_RECORD || rn == jogasaki::udf::bridge::CLOB_RECORD) {
+                return true;
+            }
+            if (contains_lob_record(nested->columns())) { return true; }
+        }
+    }
+    return false;
+}
+
 void register_scalar_function(yugawara::function::configurable_provider& functions,
     scalar_function_repository& scalar_repo,
     yugawara::function::declaration::definition_id_type& current_id,
     std::shared_ptr<plugin::udf::generic_client> const& client,
     std::shared_ptr<const plugin::udf::udf_config> const& cfg,
     plugin::udf::function_descriptor const* fn) {
-    auto unary_func = make_udf_scalar_lambda(client, cfg, fn);
+    std::shared_ptr<plugin::udf::udf_result_cache> cache{};
+    if (cfg) {
+        std::string fn_name(fn->function_name());
+        std::transform(fn_name.begin(), fn_name.end(), fn_name.begin(), ::tolower);
+        if (cfg->memoized(fn_name)) {
+            // LOB references point to the data of the calling transaction, so equal requests may not
+            // produce equal results
+            if (contains_lob_record(fn->input_record().columns()) ||
+                contains_lob_record(fn->output_record().columns())) {
+                LOG_LP(WARNING) << jogasaki::udf::log::prefix << "function '" << fn_name
+                                << "' is not memoized because it takes or returns BLOB/CLOB";
+            } else {
+                cache = std::make_shared<plugin::udf::udf_result_cache>(
+                    std::move(fn_name), cfg->memoize_cache_size());
+            }
+        }
+    }
+    auto unary_func = make_udf_scalar_lambda(client, cfg, fn, std::move(cache));
     register_udf_function_patterns(functions, scalar_repo, current_id, unary_func, fn);
 }
 void register_udf_function(yugawara::function::configurable_provider& functions,
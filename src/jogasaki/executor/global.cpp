@@ -23,11 +23,13 @@
 
 #include <jogasaki/api/impl/database.h>
 #include <jogasaki/configuration.h>
+#include <jogasaki/dist/key_histogram_store.h>
 #include <jogasaki/executor/function/aggregate_function_repository.h>
 #include <jogasaki/executor/function/incremental/aggregate_function_repository.h>
 #include <jogasaki/executor/function/scalar_function_repository.h>
 #include <jogasaki/executor/function/table_valued_function_repository.h>
 #include <jogasaki/kvs/database.h>
+#include <jogasaki/memory/memory_tracker.h>
 #include <jogasaki/memory/page_pool.h>
 #include <jogasaki/storage/storage_manager.h>
 
@@ -47,6 +49,11 @@ memory::page_pool& page_pool(pool_operation op) {
     return *pool;
 }
 
+std::shared_ptr<memory::memory_tracker> const& memory_tracker() {
+    static std::shared_ptr<memory::memory_tracker> tracker = std::make_shared<memory::memory_tracker>();
+    return tracker;
+}
+
 executor::function::incremental::aggregate_function_repository& incremental_aggregate_function_repository() {
     static executor::function::incremental::aggregate_function_repository repo{};
     return repo;
@@ -67,6 +74,11 @@ executor::function::table_valued_function_repository& table_valued_function_repo
     return repo;
 }
 
+dist::key_histogram_store& key_histogram_store() {
+    static dist::key_histogram_store store{};
+    return store;
+}
+
 std::shared_ptr<yugawara::function::configurable_provider> const&
 regular_function_provider(std::shared_ptr<yugawara::function::configurable_provider> arg) {
     static std::shared_ptr<yugawara::function::configurable_provider> provider =
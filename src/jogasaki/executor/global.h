@@ -55,12 +55,17 @@ class database;
 
 namespace jogasaki::memory {
 class page_pool;
+class memory_tracker;
 }
 
 namespace jogasaki {
 class configuration;
 }
 
+namespace jogasaki::dist {
+class key_histogram_store;
+}
+
 namespace jogasaki::storage {
 class storage_manager;
 }
@@ -94,6 +99,14 @@ enum class pool_operation : std::int32_t {
  */
 [[nodiscard]] memory::page_pool& page_pool(pool_operation op = pool_operation::get);
 
+/**
+ * @brief thread-safe accessor to the global memory tracker
+ * @details the tracker is the root of the memory trackers and counts the pages held by all paged memory resources.
+ * It will be initialized on the first call and can be shared by multiple threads.
+ * @return reference to the tracker
+ */
+[[nodiscard]] std::shared_ptr<memory::memory_tracker> const& memory_tracker();
+
 /**
  * @brief thread-safe accessor to the global repository for incremental aggregate functions
  * @details the repository will be initialized on the first call and can be shared by multiple threads
@@ -122,6 +135,13 @@ enum class pool_operation : std::int32_t {
  */
 [[nodiscard]] executor::function::table_valued_function_repository& table_valued_function_repository();
 
+/**
+ * @brief thread-safe accessor to the global store of the key histograms
+ * @details the store will be initialized on the first call and can be shared by multiple threads
+ * @return reference to the store
+ */
+[[nodiscard]] dist::key_histogram_store& key_histogram_store();
+
 /**
  * @brief thread-safe accessor to the global configuration pool
  * @details the pool will be initialized on the first call and can be shared by multiple threads
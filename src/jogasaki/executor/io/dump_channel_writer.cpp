@@ -80,6 +80,7 @@ bool dump_channel_writer::write(accessor::record_ref rec) {
         } else {
             file::parquet_writer_option opt{};
             opt.time_unit(cfg_.time_unit_kind_);
+            opt.record_batch_size(cfg_.record_batch_size_);
             file_writer_ = file::parquet_writer::open(parent_->meta(), p.string(), opt);
         }
         if (! file_writer_) {
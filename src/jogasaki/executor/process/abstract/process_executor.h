@@ -43,6 +43,17 @@ public:
 
     [[nodiscard]] virtual status run() = 0;
 
+    /**
+     * @brief run the processor, receiving the condition to wake up the task if it goes to sleep
+     * @details the default implementation never puts the task to sleep
+     * @param condition [out] filled with the wake-up condition if status::to_sleep is returned
+     * @return the status of the processor
+     */
+    [[nodiscard]] virtual status run(task_context::wake_up_condition_type& condition) {
+        (void) condition;
+        return run();
+    }
+
     /**
      * @brief sets callback before creating tasks
      * @param arg the callback
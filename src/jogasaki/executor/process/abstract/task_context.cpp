@@ -15,6 +15,8 @@
  */
 #include "task_context.h"
 
+#include <utility>
+
 #include <jogasaki/executor/process/abstract/work_context.h>
 
 namespace jogasaki::executor::process::abstract {
@@ -31,6 +33,14 @@ std::unique_ptr<class work_context> task_context::release_work() {
     return std::move(work_context_);
 }
 
+void task_context::wake_up_condition(wake_up_condition_type condition) {
+    wake_up_condition_ = std::move(condition);
+}
+
+task_context::wake_up_condition_type task_context::release_wake_up_condition() {
+    return std::exchange(wake_up_condition_, {});
+}
+
 }
 
 
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <utility>
 
@@ -47,6 +48,9 @@ public:
     /// @brief index used to access writers
     using writer_index = std::size_t;
 
+    /// @brief condition to wake up the task suspended on this context
+    using wake_up_condition_type = std::function<bool()>;
+
     /**
      * @brief create new empty instance
      */
@@ -132,8 +136,24 @@ public:
      */
     [[nodiscard]] std::unique_ptr<class work_context> release_work();
 
+    /**
+     * @brief setter of the wake-up condition
+     * @details operators that yield because they wait for external data (e.g. table-valued function stream) can
+     * set the condition that becomes true when the data arrives, so that the task is parked and rescheduled
+     * only when the condition is met, instead of being rescheduled immediately.
+     * @param condition the condition, which must be cheap, non-blocking and callable from other threads
+     */
+    void wake_up_condition(wake_up_condition_type condition);
+
+    /**
+     * @brief detach and return the wake-up condition held by this instance
+     * @return the condition, or empty if no condition is set
+     */
+    [[nodiscard]] wake_up_condition_type release_wake_up_condition();
+
 private:
     std::unique_ptr<class work_context> work_context_{};
+    wake_up_condition_type wake_up_condition_{};
 };
 
 /**
@@ -24,6 +24,8 @@
 #include <takatori/util/maybe_shared_ptr.h>
 
 #include <jogasaki/error/error_info_factory.h>
+#include <jogasaki/executor/common/step.h>
+#include <jogasaki/executor/exchange/broadcast/flow.h>
 #include <jogasaki/executor/exchange/flow.h>
 #include <jogasaki/executor/exchange/shuffle/flow.h>
 #include <jogasaki/executor/exchange/shuffle/run_info.h>
@@ -45,6 +47,7 @@
 #include <jogasaki/plan/compiler.h>
 #include <jogasaki/plan/plan_exception.h>
 #include <jogasaki/request_context.h>
+#include <jogasaki/utils/fail.h>
 #include <jogasaki/utils/scan_parallel_enabled.h>
 
 namespace jogasaki::executor::process {
@@ -69,6 +72,10 @@ std::size_t flow::check_empty_input_and_calculate_partitions() {
     empty_input_from_shuffle_ = false;
     for(std::size_t i=0, n=exchange_map->input_count(); i < n; ++i) {
         auto& flow = exchange_map->input_at(i)->data_flow_object(*context_);
+        if(flow.kind() == model::step_kind::broadcast) {
+            // broadcast is read through the hash table and doesn't affect the partitions
+            continue;
+        }
         if(flow.kind() == model::step_kind::forward) {
             // if forward, downstream partition must be same as upstream partitions
             // for now, at most one input forward exchange exists
@@ -175,9 +182,19 @@ sequence_view<std::shared_ptr<model::task>> flow::create_tasks() {
 }
 
 sequence_view<std::shared_ptr<model::task>> flow::create_pretask(flow::port_index_type subinput) {
-    (void)subinput;
-    // TODO create prepare task for the index
-    return {};
+    // currently only broadcast exchange is connected to the sub input, and its pretask builds the hash table
+    auto ports = step_->subinput_ports();
+    if(pretasks_.empty()) {
+        pretasks_.resize(ports.size());
+    }
+    auto& upstream = unsafe_downcast<executor::common::step>(*ports[subinput]->opposites()[0]->owner());
+    auto& f = upstream.data_flow_object(*context_);
+    if(f.kind() != model::step_kind::broadcast) {
+        fail_with_exception();
+    }
+    auto& slot = pretasks_[subinput];
+    slot = unsafe_downcast<executor::exchange::broadcast::flow>(f).create_build_task(step_);
+    return {std::addressof(slot), 1};
 }
 
 model::step_kind flow::kind() const noexcept {
@@ -76,6 +76,7 @@ public:
 private:
     request_context* context_{};
     std::vector<std::shared_ptr<model::task>> tasks_{};
+    std::vector<std::shared_ptr<model::task>> pretasks_{};
     step* step_{};
     std::shared_ptr<processor_info> info_{};
     bool empty_input_from_shuffle_{};
@@ -37,6 +37,7 @@
 #include <jogasaki/executor/expr/evaluator_context.h>
 #include <jogasaki/executor/expr/lob_processing.h>
 #include <jogasaki/executor/global.h>
+#include <jogasaki/executor/process/abstract/task_context.h>
 #include <jogasaki/executor/process/impl/ops/context_container.h>
 #include <jogasaki/executor/process/impl/ops/details/error_abort.h>
 #include <jogasaki/executor/process/impl/ops/details/expression_error.h>
@@ -46,6 +47,7 @@
 #include <jogasaki/logging_helper.h>
 #include <jogasaki/meta/field_type_kind.h>
 #include <jogasaki/meta/field_type_traits.h>
+#include <jogasaki/request_context.h>
 #include <jogasaki/status.h>
 #include <jogasaki/utils/assert.h>
 #include <jogasaki/utils/cancel_request.h>
@@ -63,6 +65,26 @@ namespace jogasaki::executor::process::impl::ops {
 using takatori::util::throw_exception;
 using takatori::util::unsafe_downcast;
 
+namespace {
+
+/**
+ * @brief create the condition to wake up the task waiting for the TVF stream
+ * @details the condition is also met on cancel request so that the parked task can observe the cancel
+ */
+abstract::task_context::wake_up_condition_type create_wake_up_condition(apply_context& ctx, bool cancel_enabled) {
+    return [stream = ctx.stream_, rctx = ctx.req_context(), cancel_enabled]() {
+        if (cancel_enabled && rctx != nullptr) {
+            auto& res_src = rctx->req_info().response_source();
+            if (res_src && res_src->check_cancel()) {
+                return true;
+            }
+        }
+        return stream->ready();
+    };
+}
+
+}  // namespace
+
 apply::apply(
     operator_base::operator_index_type index,
     processor_info const& info,
@@ -188,8 +210,14 @@ try_next:
             }
             if (stream_status == data::any_sequence_stream_status::not_ready) {
                 // TVF stream is not ready yet; yield the worker thread and retry later
-                VLOG_LP(log_trace) << "apply operator yields: TVF stream not ready";
                 ctx.state(context_state::yielding);
+                if (! ctx.stream_->ready()) {
+                    // park the task until the stream has data so that workers don't re-poll the slow stream
+                    VLOG_LP(log_trace) << "apply operator sleeps: TVF stream not ready";
+                    context->wake_up_condition(create_wake_up_condition(ctx, cancel_enabled));
+                    return operation_status_kind::yield;
+                }
+                VLOG_LP(log_trace) << "apply operator yields: TVF stream not ready";
                 return operation_status_kind::yield;
             }
         }
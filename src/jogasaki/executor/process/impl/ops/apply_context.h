@@ -73,7 +73,8 @@ public:
     void release() override;
 
 private:
-    std::unique_ptr<data::any_sequence_stream> stream_{};
+    // shared with the wake-up condition which may be checked after the stream is closed
+    std::shared_ptr<data::any_sequence_stream> stream_{};
     bool has_output_{false};
     std::vector<data::any> args_{};
     expr::evaluator_context evaluator_context_;
@@ -0,0 +1,315 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "broadcast_join.h"
+
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <glog/logging.h>
+
+#include <takatori/util/downcast.h>
+
+#include <jogasaki/data/any.h>
+#include <jogasaki/error_code.h>
+#include <jogasaki/executor/exchange/broadcast/flow.h>
+#include <jogasaki/executor/expr/evaluator.h>
+#include <jogasaki/executor/expr/evaluator_context.h>
+#include <jogasaki/executor/process/impl/ops/details/encode_key.h>
+#include <jogasaki/executor/process/impl/ops/details/expression_error.h>
+#include <jogasaki/logging.h>
+#include <jogasaki/logging_helper.h>
+#include <jogasaki/status.h>
+#include <jogasaki/utils/assert.h>
+#include <jogasaki/utils/copy_field_data.h>
+#include <jogasaki/utils/handle_encode_errors.h>
+#include <jogasaki/utils/handle_generic_error.h>
+
+#include "broadcast_join_context.h"
+#include "context_helper.h"
+#include "operator_base.h"
+
+namespace jogasaki::executor::process::impl::ops {
+
+using takatori::util::unsafe_downcast;
+
+broadcast_join::broadcast_join(
+    join_kind kind,
+    operator_base::operator_index_type index,
+    processor_info const& info,
+    operator_base::block_index_type block_index,
+    exchange::step const* source,
+    meta::variable_order const& order,
+    takatori::util::maybe_shared_ptr<meta::record_meta> meta,
+    takatori::util::sequence_view<column const> columns,
+    std::vector<details::search_key_field_info> search_key_fields,
+    takatori::util::optional_ptr<takatori::scalar::expression const> condition,
+    std::unique_ptr<operator_base> downstream
+) :
+    record_operator(index, info, block_index),
+    join_kind_(kind),
+    source_(source),
+    meta_(std::move(meta)),
+    fields_(create_fields(order, columns)),
+    search_key_fields_(std::move(search_key_fields)),
+    condition_(condition),
+    evaluator_(condition_ ?
+        expr::evaluator{*condition_, info.compiled_info(), info.host_variables()} :
+        expr::evaluator{}
+    ),
+    downstream_(std::move(downstream))
+{}
+
+operation_status broadcast_join::process_record(abstract::task_context* context) {
+    assert_with_exception(context != nullptr, context);
+    context_helper ctx{*context};
+    auto* p = find_context<broadcast_join_context>(index(), ctx.contexts());
+    if (! p) {
+        auto& flow = unsafe_downcast<exchange::broadcast::flow>(source_->data_flow_object(*ctx.req_context()));
+        p = ctx.make_context<broadcast_join_context>(
+            index(),
+            block_index(),
+            ctx.resource(),
+            ctx.varlen_resource(),
+            std::addressof(flow.table())
+        );
+    }
+    return (*this)(*p, context);
+}
+
+operation_status broadcast_join::operator()(  //NOLINT(readability-function-cognitive-complexity)
+    broadcast_join_context& ctx,
+    abstract::task_context* context
+) {
+    assert_with_exception(ctx.state() != context_state::yielding, ctx.state());
+    if (ctx.aborted()) {
+        return operation_status_kind::aborted;
+    }
+    // left_outer_at_most_one is rejected by operator_builder
+    assert_with_exception(
+        join_kind_ != join_kind::full_outer && join_kind_ != join_kind::left_outer_at_most_one,
+        join_kind_
+    );
+    auto resource = ctx.varlen_resource();
+    if (ctx.state() == context_state::calling_child) {
+        VLOG_LP(log_trace) << "resuming broadcast_join op. after downstream yield";
+        if (join_kind_ == join_kind::semi || join_kind_ == join_kind::anti) {
+            // semi/anti call downstream at most once per left row, so simply re-try the downstream call
+            if (auto call_st = call_downstream(ctx, context); ! call_st) {
+                return call_st;
+            }
+            return operation_status_kind::ok;
+        }
+        goto resume_calling_child;  //NOLINT
+    }
+    nullify_output_variables(ctx.variables().ref());
+    if (! lookup(ctx)) {
+        ctx.abort();
+        return operation_status_kind::aborted;
+    }
+    if (join_kind_ == join_kind::semi || join_kind_ == join_kind::anti) {
+        bool exists_match = false;
+        for(; ctx.it_ != ctx.end_; ++ctx.it_) {
+            if (! condition_) {
+                exists_match = true;
+                break;
+            }
+            assign_output_variables(ctx, ctx.it_->second);
+            expr::evaluator_context c{
+                resource,
+                ctx.req_context() ? ctx.req_context()->transaction().get() : nullptr
+            };
+            context_helper h{ctx.task_context()};
+            c.blob_session(std::addressof(h.blob_session_container()));
+            c.like_patterns(std::addressof(ctx.like_patterns_));
+            auto r = evaluate_bool(c, evaluator_, ctx.variables(), resource);
+            if (r.error()) {
+                handle_expression_error(*ctx.req_context(), r, c);
+                ctx.abort();
+                return operation_status_kind::aborted;
+            }
+            if (r.to<bool>()) {
+                exists_match = true;
+                break;
+            }
+        }
+        nullify_output_variables(ctx.variables().ref());
+        if ((exists_match && join_kind_ == join_kind::semi) ||
+            (! exists_match && join_kind_ == join_kind::anti)) {
+            if (auto call_st = call_downstream(ctx, context); ! call_st) {
+                return call_st;
+            }
+        }
+        return operation_status_kind::ok;
+    }
+    // inner or left_outer join
+    ctx.emitted_ = false;
+    while(ctx.it_ != ctx.end_) {
+        {
+            // advance before calling downstream so that resuming from yield continues with the next record
+            auto* rec = ctx.it_->second;
+            ++ctx.it_;
+            assign_output_variables(ctx, rec);
+            if (condition_) {
+                expr::evaluator_context c{
+                    resource,
+                    ctx.req_context() ? ctx.req_context()->transaction().get() : nullptr
+                };
+                context_helper h{ctx.task_context()};
+                c.blob_session(std::addressof(h.blob_session_container()));
+                c.like_patterns(std::addressof(ctx.like_patterns_));
+                auto r = evaluate_bool(c, evaluator_, ctx.variables(), resource);
+                if (r.error()) {
+                    handle_expression_error(*ctx.req_context(), r, c);
+                    ctx.abort();
+                    return operation_status_kind::aborted;
+                }
+                if (! r.to<bool>()) {
+                    nullify_output_variables(ctx.variables().ref());
+                    continue;
+                }
+            }
+            ctx.emitted_ = true;
+        }
+resume_calling_child:
+        if (auto call_st = call_downstream(ctx, context); ! call_st) {
+            return call_st;
+        }
+        // clean output variables for next record just in case
+        nullify_output_variables(ctx.variables().ref());
+    }
+    if (! ctx.emitted_ && join_kind_ == join_kind::left_outer) {
+        // no record matched - send the record with null output variables. Resuming from the yield in this call
+        // goes back into the loop above, which exits immediately since the iterator reached the end.
+        ctx.emitted_ = true;
+        if (auto call_st = call_downstream(ctx, context); ! call_st) {
+            return call_st;
+        }
+    }
+    return operation_status_kind::ok;
+}
+
+bool broadcast_join::lookup(broadcast_join_context& ctx) {
+    auto resource = ctx.varlen_resource();
+    expr::evaluator_context ectx{
+        resource,
+        ctx.req_context() ? ctx.req_context()->transaction().get() : nullptr
+    };
+    context_helper helper{ctx.task_context()};
+    ectx.blob_session(std::addressof(helper.blob_session_container()));
+    ectx.like_patterns(std::addressof(ctx.like_patterns_));
+    std::size_t len{};
+    if(auto res = details::encode_key(
+            ectx, search_key_fields_, ctx.variables(), *resource, ctx.buf_, len, ctx.req_context());
+        res != status::ok) {
+        if(res == status::err_integrity_constraint_violation) {
+            // null is assigned for the key. Nothing should match.
+            ctx.it_ = ctx.end_ = broadcast_join_context::const_iterator{};
+            return true;
+        }
+        handle_encode_errors(*ctx.req_context(), res);
+        handle_generic_error(*ctx.req_context(), res, error_code::sql_execution_exception);
+        return false;
+    }
+    ctx.key_.assign(static_cast<char*>(ctx.buf_.data()), len);
+    auto [b, e] = ctx.table_->find(ctx.key_);
+    ctx.it_ = b;
+    ctx.end_ = e;
+    return true;
+}
+
+void broadcast_join::assign_output_variables(broadcast_join_context& ctx, void* record) {
+    auto target = ctx.variables().ref();
+    accessor::record_ref source{record, meta_->record_size()};
+    for(auto&& f : fields_) {
+        // the broadcast records are kept until all the downstream processes complete, so varlen data is not copied
+        utils::copy_nullable_field(
+            f.type_,
+            target,
+            f.target_offset_,
+            f.target_nullity_offset_,
+            source,
+            f.source_offset_,
+            f.source_nullity_offset_
+        );
+    }
+}
+
+void broadcast_join::nullify_output_variables(accessor::record_ref target) {
+    for(auto&& f : fields_) {
+        target.set_null(f.target_nullity_offset_, true);
+    }
+}
+
+operation_status broadcast_join::call_downstream(
+    broadcast_join_context& ctx,
+    abstract::task_context* context
+) {
+    if (downstream_) {
+        ctx.state(context_state::calling_child);
+        auto st = unsafe_downcast<record_operator>(downstream_.get())->process_record(context);
+        if (st.kind() == operation_status_kind::yield) {
+            return operation_status_kind::yield;
+        }
+        if (st.kind() == operation_status_kind::aborted) {
+            ctx.abort();
+            return operation_status_kind::aborted;
+        }
+        ctx.state(context_state::running_operator_body);
+        return st;
+    }
+    return operation_status_kind::ok;
+}
+
+operator_kind broadcast_join::kind() const noexcept {
+    return operator_kind::broadcast_join;
+}
+
+void broadcast_join::finish(abstract::task_context* context) {
+    if (! context) return;
+    context_helper ctx{*context};
+    if (auto* p = find_context<broadcast_join_context>(index(), ctx.contexts())) {
+        p->release();
+    }
+    if (downstream_) {
+        unsafe_downcast<record_operator>(downstream_.get())->finish(context);
+    }
+}
+
+std::vector<details::search_key_field_info> const& broadcast_join::search_key_fields() const noexcept {
+    return search_key_fields_;
+}
+
+std::vector<details::broadcast_join_field> broadcast_join::create_fields(
+    meta::variable_order const& order,
+    takatori::util::sequence_view<column const> columns
+) {
+    std::vector<details::broadcast_join_field> fields{};
+    fields.reserve(columns.size());
+    for(auto&& c : columns) {
+        auto ind = order.index(c.source());
+        auto& info = block_info().at(c.destination());
+        fields.emplace_back(details::broadcast_join_field{
+            meta_->at(ind),
+            meta_->value_offset(ind),
+            info.value_offset(),
+            meta_->nullity_offset(ind),
+            info.nullity_offset()
+        });
+    }
+    return fields;
+}
+
+}  // namespace jogasaki::executor::process::impl::ops
@@ -0,0 +1,162 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <takatori/relation/join_find.h>
+#include <takatori/relation/join_kind.h>
+#include <takatori/scalar/expression.h>
+#include <takatori/util/maybe_shared_ptr.h>
+#include <takatori/util/optional_ptr.h>
+#include <takatori/util/sequence_view.h>
+
+#include <jogasaki/executor/exchange/step.h>
+#include <jogasaki/executor/expr/evaluator.h>
+#include <jogasaki/executor/process/abstract/task_context.h>
+#include <jogasaki/executor/process/impl/ops/operation_status.h>
+#include <jogasaki/executor/process/impl/ops/operator_kind.h>
+#include <jogasaki/executor/process/processor_info.h>
+#include <jogasaki/meta/field_type.h>
+#include <jogasaki/meta/record_meta.h>
+#include <jogasaki/meta/variable_order.h>
+#include <jogasaki/utils/interference_size.h>
+
+#include "broadcast_join_context.h"
+#include "details/search_key_field_info.h"
+#include "operator_base.h"
+
+namespace jogasaki::executor::process::impl::ops {
+
+namespace details {
+
+/**
+ * @brief field info. to copy the broadcast record field to the variable
+ */
+struct cache_align broadcast_join_field {
+    meta::field_type type_{};
+    std::size_t source_offset_{};
+    std::size_t target_offset_{};
+    std::size_t source_nullity_offset_{};
+    std::size_t target_nullity_offset_{};
+};
+
+}  // namespace details
+
+/**
+ * @brief broadcast_join operator
+ * @details join_find operator whose source is a broadcast exchange. The input record key is looked up
+ * in the hash table built by the broadcast exchange, instead of reading the index on kvs.
+ */
+class broadcast_join : public record_operator {
+public:
+    friend class broadcast_join_context;
+
+    using join_kind = takatori::relation::join_kind;
+    using column = takatori::relation::join_find::column;
+
+    /**
+     * @brief create empty object
+     */
+    broadcast_join() = default;
+
+    /**
+     * @brief create new object
+     * @param kind the join kind
+     * @param index the index to identify the operator in the process
+     * @param info processor's information where this operation is contained
+     * @param block_index the index of the block that this operation belongs to
+     * @param source the broadcast exchange step that builds the hash table
+     * @param order the column order of the broadcast record
+     * @param meta the metadata of the broadcast record
+     * @param columns the columns copied from the broadcast record to the variables
+     * @param search_key_fields the key fields to look up the hash table, in the order of the hash table key
+     * @param condition the join condition, or nullptr if there is no condition
+     * @param downstream downstream operator invoked after this operation. Pass nullptr if such dispatch is not needed.
+     */
+    broadcast_join(
+        join_kind kind,
+        operator_index_type index,
+        processor_info const& info,
+        block_index_type block_index,
+        exchange::step const* source,
+        meta::variable_order const& order,
+        takatori::util::maybe_shared_ptr<meta::record_meta> meta,
+        takatori::util::sequence_view<column const> columns,
+        std::vector<details::search_key_field_info> search_key_fields,
+        takatori::util::optional_ptr<takatori::scalar::expression const> condition,
+        std::unique_ptr<operator_base> downstream = nullptr
+    );
+
+    /**
+     * @brief create context (if needed) and process record
+     * @param context task-wide context used to create operator context
+     * @return status of the operation
+     */
+    operation_status process_record(abstract::task_context* context) override;
+
+    /**
+     * @brief process record with context object
+     * @details look up the hash table with the key, join variables with found records, and invoke downstream
+     * when join conditions are met
+     * @param ctx context object for the execution
+     * @param context task context for the downstream, can be nullptr if downstream doesn't require.
+     * @return status of the operation
+     */
+    operation_status operator()(broadcast_join_context& ctx, abstract::task_context* context = nullptr);
+
+    /**
+     * @see operator_base::kind()
+     */
+    [[nodiscard]] operator_kind kind() const noexcept override;
+
+    /**
+     * @see operator_base::finish()
+     */
+    void finish(abstract::task_context* context) override;
+
+    /**
+     * @brief accessor to the search key fields
+     */
+    [[nodiscard]] std::vector<details::search_key_field_info> const& search_key_fields() const noexcept;
+
+private:
+    join_kind join_kind_{};
+    exchange::step const* source_{};
+    takatori::util::maybe_shared_ptr<meta::record_meta> meta_{};
+    std::vector<details::broadcast_join_field> fields_{};
+    std::vector<details::search_key_field_info> search_key_fields_{};
+    takatori::util::optional_ptr<takatori::scalar::expression const> condition_{};
+    expr::evaluator evaluator_{};
+    std::unique_ptr<operator_base> downstream_{};
+
+    [[nodiscard]] std::vector<details::broadcast_join_field> create_fields(
+        meta::variable_order const& order,
+        takatori::util::sequence_view<column const> columns
+    );
+
+    bool lookup(broadcast_join_context& ctx);
+
+    void assign_output_variables(broadcast_join_context& ctx, void* record);
+
+    void nullify_output_variables(accessor::record_ref target);
+
+    operation_status call_downstream(broadcast_join_context& ctx, abstract::task_context* context);
+};
+
+}  // namespace jogasaki::executor::process::impl::ops
@@ -0,0 +1,41 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "broadcast_join_context.h"
+
+#include <jogasaki/executor/process/impl/ops/context_base.h>
+
+namespace jogasaki::executor::process::impl::ops {
+
+broadcast_join_context::broadcast_join_context(
+    abstract::task_context* ctx,
+    variables_view variables,
+    context_base::memory_resource* resource,
+    context_base::memory_resource* varlen_resource,
+    exchange::broadcast::hash_table const* table
+) :
+    context_base(ctx, variables, resource, varlen_resource),
+    table_(table)
+{}
+
+operator_kind broadcast_join_context::kind() const noexcept {
+    return operator_kind::broadcast_join;
+}
+
+void broadcast_join_context::release() {
+    // no-op - the hash table is owned by the broadcast exchange
+}
+
+}  // namespace jogasaki::executor::process::impl::ops
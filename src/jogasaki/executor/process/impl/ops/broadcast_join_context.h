@@ -0,0 +1,73 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <string>
+
+#include <jogasaki/data/aligned_buffer.h>
+#include <jogasaki/executor/exchange/broadcast/hash_table.h>
+#include <jogasaki/executor/expr/like_pattern.h>
+#include <jogasaki/executor/process/abstract/task_context.h>
+#include <jogasaki/executor/process/impl/ops/operator_kind.h>
+#include <jogasaki/executor/process/impl/variables_view.h>
+
+#include "context_base.h"
+
+namespace jogasaki::executor::process::impl::ops {
+
+/**
+ * @brief broadcast_join context
+ */
+class broadcast_join_context : public context_base {
+public:
+    friend class broadcast_join;
+
+    using const_iterator = exchange::broadcast::hash_table::const_iterator;
+
+    /**
+     * @brief create empty object
+     */
+    broadcast_join_context() = default;
+
+    /**
+     * @brief create new object
+     * @param table the hash table built by the broadcast exchange
+     */
+    broadcast_join_context(
+        class abstract::task_context* ctx,
+        variables_view variables,
+        memory_resource* resource,
+        memory_resource* varlen_resource,
+        exchange::broadcast::hash_table const* table
+    );
+
+    [[nodiscard]] operator_kind kind() const noexcept override;
+
+    void release() override;
+
+private:
+    exchange::broadcast::hash_table const* table_{};
+    data::aligned_buffer buf_{};
+    std::string key_{};
+    expr::like_pattern_cache like_patterns_{};
+
+    // frame variables saved/restored at yield point `calling_child`
+    const_iterator it_{};
+    const_iterator end_{};
+    bool emitted_{};
+};
+
+}  // namespace jogasaki::executor::process::impl::ops
@@ -78,6 +78,7 @@ operation_status filter::operator()(filter_context& ctx, abstract::task_context*
         };
         context_helper helper{ctx.task_context()};
         c.blob_session(std::addressof(helper.blob_session_container()));
+        c.like_patterns(std::addressof(ctx.like_patterns_));
         auto res = evaluate_bool(c, evaluator_, ctx.variables(), resource);
         if (res.error()) {
             handle_expression_error(*ctx.req_context(), res, c);
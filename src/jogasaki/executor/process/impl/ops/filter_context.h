@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <jogasaki/executor/expr/like_pattern.h>
 #include <jogasaki/executor/process/abstract/task_context.h>
 #include <jogasaki/executor/process/impl/ops/operator_kind.h>
 #include <jogasaki/executor/process/impl/variables_view.h>
@@ -48,7 +49,7 @@ public:
 
     void release() override;
 private:
-
+    expr::like_pattern_cache like_patterns_{};
 };
 
 }
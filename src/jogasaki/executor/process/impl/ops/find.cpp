@@ -72,7 +72,8 @@ find::find(
     std::vector<index::field_info> key_fields,
     std::vector<index::field_info> value_fields,
     std::vector<details::secondary_index_field_info> secondary_key_fields,
-    std::unique_ptr<operator_base> downstream
+    std::unique_ptr<operator_base> downstream,
+    std::vector<index::field_info> secondary_value_fields
 ) :
     record_operator(index, info, block_index),
     use_secondary_(! secondary_storage_name.empty()),
@@ -84,7 +85,8 @@ find::find(
         use_secondary_,
         std::move(key_fields),
         std::move(value_fields),
-        std::move(secondary_key_fields)
+        std::move(secondary_key_fields),
+        std::move(secondary_value_fields)
     )
 {}
 
@@ -108,7 +110,15 @@ find::find(
         index::create_fields<column>(primary_idx, columns, info.vars_info_list()[block_index], true, true),
         index::create_fields<column>(primary_idx, columns, info.vars_info_list()[block_index], false, true),
         create_secondary_key_fields(secondary_idx),
-        std::move(downstream)
+        std::move(downstream),
+        secondary_idx != nullptr ?
+            index::create_covering_fields<column>(
+                primary_idx,
+                *secondary_idx,
+                columns,
+                info.vars_info_list()[block_index]
+            ) :
+            std::vector<index::field_info>{}
     )
 {}
 
@@ -264,6 +274,19 @@ resume_calling_child_1:
             handle_kvs_errors(*ctx.req_context(), res);
             return error_abort(ctx, res);
         }
+        if(field_mapper_.covering()) {
+            // covered columns are read from the secondary value instead of the primary entry
+            if(auto res = ctx.it_->read_value(v); res != status::ok) {
+                utils::modify_concurrent_operation_status(*ctx.tx_->object(), res, true); //FIXME tx_
+                if (res == status::not_found) {
+                    continue;
+                }
+                ctx.it_.reset();
+                finish(context);
+                handle_kvs_errors(*ctx.req_context(), res);
+                return error_abort(ctx, res);
+            }
+        }
 resume_calling_child_2:
         std::string_view vv = ctx.state() == context_state::calling_child ? std::string_view{ctx.value_} : v;
         std::string_view kk = ctx.state() == context_state::calling_child ? std::string_view{ctx.key_scanned_} : k;
@@ -77,6 +77,8 @@ public:
      * @param key_fields field offset information for keys
      * @param value_fields field offset information for values
      * @param downstream downstream operator invoked after this operation. Pass nullptr if such dispatch is not needed.
+     * @param secondary_value_fields field offset information for the columns covered by the secondary index value.
+     * Pass empty if the secondary index is not covering and the primary index entry needs to be fetched.
      */
     find(
         operator_index_type index,
@@ -88,7 +90,8 @@ public:
         std::vector<index::field_info> key_fields,
         std::vector<index::field_info> value_fields,
         std::vector<details::secondary_index_field_info> secondary_key_fields,
-        std::unique_ptr<operator_base> downstream = nullptr
+        std::unique_ptr<operator_base> downstream = nullptr,
+        std::vector<index::field_info> secondary_value_fields = {}
     );
 
     /**
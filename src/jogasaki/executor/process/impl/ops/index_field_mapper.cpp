@@ -21,7 +21,7 @@
 
 #include <jogasaki/error/error_info_factory.h>
 #include <jogasaki/index/field_info.h>
-#include <jogasaki/index/index_accessor.h>
+#include <jogasaki/index/record_codec.h>
 #include <jogasaki/kvs/coder.h>
 #include <jogasaki/kvs/readable_stream.h>
 #include <jogasaki/kvs/storage.h>
@@ -51,10 +51,28 @@ index_field_mapper::index_field_mapper(
     std::vector<index::field_info> primary_key_fields,
     std::vector<index::field_info> primary_value_fields,
     std::vector<details::secondary_index_field_info> secondary_key_fields
+) :
+    index_field_mapper(
+        use_secondary,
+        std::move(primary_key_fields),
+        std::move(primary_value_fields),
+        std::move(secondary_key_fields),
+        {}
+    )
+{}
+
+index_field_mapper::index_field_mapper(
+    bool use_secondary,
+    std::vector<index::field_info> primary_key_fields,
+    std::vector<index::field_info> primary_value_fields,
+    std::vector<details::secondary_index_field_info> secondary_key_fields,
+    std::vector<index::field_info> secondary_value_fields
 ) :
     use_secondary_(use_secondary),
-    primary_key_fields_(std::move(primary_key_fields)),
-    primary_value_fields_(std::move(primary_value_fields)),
+    covering_(use_secondary && ! secondary_value_fields.empty()),
+    primary_key_codec_(std::move(primary_key_fields)),
+    primary_value_codec_(std::move(primary_value_fields)),
+    secondary_value_codec_(std::move(secondary_value_fields)),
     secondary_key_fields_(std::move(secondary_key_fields))
 {}
 
@@ -96,6 +114,15 @@ status index_field_mapper::process(
     std::string_view v{value};
     if (use_secondary_) {
         k = extract_primary_key(key);
+        if (covering_ && ! value.empty()) {
+            // covered columns are stored in the secondary value - no need to fetch primary entry
+            kvs::readable_stream keys{k.data(), k.size()};
+            kvs::readable_stream values{value.data(), value.size()};
+            if(auto res = primary_key_codec_.decode(keys, target, resource); res != status::ok) {
+                return res;
+            }
+            return secondary_value_codec_.decode(values, target, resource);
+        }
         if (auto res = find_primary_index(k, stg, tx, v, req_context); res != status::ok) {
             return res;
         }
@@ -103,6 +130,10 @@ status index_field_mapper::process(
     return populate_field_variables(k, v, target, resource);
 }
 
+bool index_field_mapper::covering() const noexcept {
+    return covering_;
+}
+
 status index_field_mapper::consume_secondary_key_fields(
     std::vector<details::secondary_index_field_info> const& fields,
     kvs::readable_stream& stream
@@ -173,10 +204,10 @@ status index_field_mapper::populate_field_variables(
 ) {
     kvs::readable_stream keys{key.data(), key.size()};
     kvs::readable_stream values{value.data(), value.size()};
-    if(auto res = index::decode_fields(primary_key_fields_, keys, target, resource); res != status::ok) {
+    if(auto res = primary_key_codec_.decode(keys, target, resource); res != status::ok) {
         return res;
     }
-    if(auto res = index::decode_fields(primary_value_fields_, values, target, resource); res != status::ok) {
+    if(auto res = primary_value_codec_.decode(values, target, resource); res != status::ok) {
         return res;
     }
     return status::ok;
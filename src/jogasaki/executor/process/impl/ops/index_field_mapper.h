@@ -20,6 +20,7 @@
 
 #include <jogasaki/accessor/record_ref.h>
 #include <jogasaki/index/field_info.h>
+#include <jogasaki/index/record_codec.h>
 #include <jogasaki/kvs/coder.h>
 #include <jogasaki/kvs/storage.h>
 #include <jogasaki/memory/lifo_paged_memory_resource.h>
@@ -86,6 +87,26 @@ public:
         std::vector<details::secondary_index_field_info> secondary_key_fields
     );
 
+    /**
+     * @brief create new object using covering secondary index
+     * @details if `secondary_value_fields` is not empty, the secondary index is covering i.e. its value holds all the
+     * primary value columns that need to be filled, so the mapper decodes them from the secondary value instead of
+     * fetching the primary index entry. If the secondary value is empty (e.g. written before the index stored
+     * covered columns), the mapper falls back to the primary index.
+     * @param use_secondary whether secondary index is used
+     * @param primary_key_fields info. on primary index key fields
+     * @param primary_value_fields info. on primary index value fields
+     * @param secondary_key_fields info. on secondary index key fields
+     * @param secondary_value_fields info. on secondary index value fields (covered columns)
+     */
+    index_field_mapper(
+        bool use_secondary,
+        std::vector<index::field_info> primary_key_fields,
+        std::vector<index::field_info> primary_value_fields,
+        std::vector<details::secondary_index_field_info> secondary_key_fields,
+        std::vector<index::field_info> secondary_value_fields
+    );
+
     /**
      * @brief create new object using secondary
      * @param primary_key_fields info. on primary index key fields
@@ -113,7 +134,7 @@ public:
      * @details this function identifies the primary index record and fills the variables. If error occurs,
      * `req_context` is filled with error_info and error status code is returned
      * @param key the key of the input record (either primary or secondary)
-     * @param value the value of the input record (empty if secondary)
+     * @param value the value of the input record (secondary value if secondary, possibly empty)
      * @param target the record reference to fill the variables
      * @param stg the primary index storage
      * @param tx the transaction context
@@ -132,10 +153,17 @@ public:
         request_context& req_context
     );
 
+    /**
+     * @brief returns whether the secondary index covers the fields and primary index lookup can be skipped
+     */
+    [[nodiscard]] bool covering() const noexcept;
+
 private:
     bool use_secondary_{};
-    std::vector<index::field_info> primary_key_fields_{};
-    std::vector<index::field_info> primary_value_fields_{};
+    bool covering_{};
+    index::record_codec primary_key_codec_{};
+    index::record_codec primary_value_codec_{};
+    index::record_codec secondary_value_codec_{};
     std::vector<details::secondary_index_field_info> secondary_key_fields_{};
 
     status consume_secondary_key_fields(
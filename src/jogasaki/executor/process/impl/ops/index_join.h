@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -32,6 +33,7 @@
 #include <jogasaki/error/error_info_factory.h>
 #include <jogasaki/error_code.h>
 #include <jogasaki/executor/expr/evaluator.h>
+#include <jogasaki/executor/global.h>
 #include <jogasaki/executor/process/abstract/task_context.h>
 #include <jogasaki/executor/process/impl/ops/context_helper.h>
 #include <jogasaki/executor/process/impl/ops/details/error_abort.h>
@@ -137,7 +139,9 @@ public:
         evaluator_(condition_ ?
             expr::evaluator{*condition_, info.compiled_info(), info.host_variables()} :
             expr::evaluator{}
-        )
+        ),
+        // the entries read by the probes can be modified by the write operations in the same process
+        probe_cache_size_(info.details().has_write_operations() ? 0 : global::config_pool()->join_find_probe_cache_size())
     {}
 
     template <class T = MatchInfo, typename = std::enable_if_t<std::is_same_v<T, details::match_info_scan>, void>>
@@ -298,7 +302,13 @@ public:
                 utils::get_storage_by_index_name(primary_storage_name_),
                 use_secondary_ ? utils::get_storage_by_index_name(secondary_storage_name_) : nullptr,
                 ctx.transaction(),
-                std::make_unique<details::matcher<MatchInfo>>(use_secondary_, match_info_, key_columns_, value_columns_),
+                std::make_unique<details::matcher<MatchInfo>>(
+                    use_secondary_,
+                    match_info_,
+                    key_columns_,
+                    value_columns_,
+                    probe_cache_size_
+                ),
                 ctx.resource(),
                 ctx.varlen_resource(),
                 ctx.strand()
@@ -353,6 +363,7 @@ public:
                 ctx.req_context() ? ctx.req_context()->transaction().get() : nullptr
             };
             ectx.blob_session(std::addressof(helper.blob_session_container()));
+            ectx.like_patterns(std::addressof(ctx.like_patterns_));
             nullify_output_variables(ctx.variables().ref());
             ctx.matched_ = ctx.matcher_->template process<MatchInfo>(
                 ectx,
@@ -379,6 +390,7 @@ public:
                         };
                         context_helper h{ctx.task_context()};
                         c.blob_session(std::addressof(h.blob_session_container()));
+                        c.like_patterns(std::addressof(ctx.like_patterns_));
                         auto r = evaluate_bool(c, evaluator_, ctx.variables(), resource);
                         if (r.error()) {
                             handle_expression_error(*ctx.req_context(), r, c);
@@ -420,6 +432,7 @@ public:
                     };
                     context_helper h{ctx.task_context()};
                     c.blob_session(std::addressof(h.blob_session_container()));
+                    c.like_patterns(std::addressof(ctx.like_patterns_));
                     auto r = evaluate_bool(c, evaluator_, ctx.variables(), resource);
                     if (r.error()) {
                         handle_expression_error(*ctx.req_context(), r, c);
@@ -516,6 +529,7 @@ private:
     takatori::util::optional_ptr<takatori::scalar::expression const> condition_{};
     std::unique_ptr<operator_base> downstream_{};
     expr::evaluator evaluator_{};
+    std::size_t probe_cache_size_{};
 
     /**
      * @brief call downstream process_record and propagate yield or aborted status.
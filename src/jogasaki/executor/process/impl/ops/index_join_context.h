@@ -18,6 +18,7 @@
 #include <memory>
 #include <vector>
 
+#include <jogasaki/executor/expr/like_pattern.h>
 #include <jogasaki/executor/process/abstract/task_context.h>
 #include <jogasaki/executor/process/impl/ops/operator_kind.h>
 #include <jogasaki/executor/process/impl/variables_view.h>
@@ -99,6 +100,7 @@ private:
     transaction_context* tx_{};
     std::unique_ptr<details::matcher<MatchInfo>> matcher_{};
     kvs::transaction* strand_{};
+    expr::like_pattern_cache like_patterns_{};
 
     // frame variables for yield
     bool matched_{};
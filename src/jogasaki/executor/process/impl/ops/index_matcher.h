@@ -15,9 +15,12 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include <takatori/relation/join_find.h>
@@ -117,11 +120,21 @@ class matcher {
 public:
     using memory_resource = memory::lifo_paged_memory_resource;
 
+    /**
+     * @brief create new object
+     * @param use_secondary whether the secondary index is used
+     * @param info the static information for matching
+     * @param key_columns the key columns of the primary index
+     * @param value_columns the value columns of the primary index
+     * @param probe_cache_size the max number of the primary index entries cached to answer repeated join_find
+     * probes without accessing kvs (0 disables the cache). Not used for join_scan or secondary index.
+     */
     matcher(
         bool use_secondary,
         MatchInfo const& info,
         std::vector<index::field_info> key_columns,
-        std::vector<index::field_info> value_columns
+        std::vector<index::field_info> value_columns,
+        std::size_t probe_cache_size = 0
     ) :
         use_secondary_(use_secondary),
         info_(info),
@@ -131,7 +144,8 @@ public:
             std::move(key_columns),
             std::move(value_columns),
             info.secondary_key_fields_
-        )
+        ),
+        probe_cache_size_(for_join_scan_ || use_secondary_ ? 0 : probe_cache_size)
     {}
 
     /**
@@ -172,7 +186,7 @@ public:
         std::string_view value{};
 
         if (! use_secondary_) {
-            auto res = primary_stg.content_get(tx, key, value);
+            auto res = find_primary(primary_stg, tx, key, value);
             status_ = res;
             if (res != status::ok) {
                 utils::modify_concurrent_operation_status(*ctx.transaction(), res, false);
@@ -356,6 +370,13 @@ public:
         return status_;
     }
 
+    /**
+     * @brief accessor to the number of join_find probes answered by the probe cache
+     */
+    [[nodiscard]] std::size_t probe_cache_hits() const noexcept {
+        return probe_cache_hits_;
+    }
+
 private:
     bool use_secondary_{};
     MatchInfo const& info_;  //NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
@@ -370,6 +391,65 @@ private:
     kvs::transaction* tx_{};
     matcher::memory_resource* resource_{};
     std::unique_ptr<kvs::iterator> it_{};
+
+    std::size_t probe_cache_size_{};
+    std::unordered_map<std::string, std::optional<std::string>> probe_cache_{};
+    std::string probe_key_{};
+    std::size_t probe_cache_hits_{};
+    std::size_t probe_cache_filled_hits_{};
+
+    /**
+     * @brief find the primary index entry, answering repeated keys from the probe cache
+     * @details the cache keeps the entries (or their absence) already read by the transaction, so repeated probes
+     * (e.g. foreign keys of the fact table joined with a dimension table) are answered without accessing kvs.
+     * Entries are dropped when the cache becomes full, and caching stops if entries are not reused enough.
+     * @return status::ok if the entry is found. `value` is valid until next call.
+     * @return status::not_found if the entry is not found
+     * @return any other error returned by kvs, which is not cached
+     */
+    status find_primary(
+        kvs::storage& stg,
+        kvs::transaction& tx,
+        std::string_view key,
+        std::string_view& value
+    ) {
+        if(probe_cache_size_ == 0) {
+            return stg.content_get(tx, key, value);
+        }
+        probe_key_.assign(key);
+        if(auto it = probe_cache_.find(probe_key_); it != probe_cache_.end()) {
+            ++probe_cache_hits_;
+            ++probe_cache_filled_hits_;
+            if(! it->second) {
+                return status::not_found;
+            }
+            value = *it->second;
+            return status::ok;
+        }
+        auto res = stg.content_get(tx, key, value);
+        if(res != status::ok && res != status::not_found) {
+            return res;
+        }
+        if(probe_cache_.size() >= probe_cache_size_) {
+            if(probe_cache_filled_hits_ < probe_cache_.size()) {
+                // entries are used less than twice on average - the cache doesn't pay
+                probe_cache_size_ = 0;
+                probe_cache_.clear();
+                return res;
+            }
+            probe_cache_.clear();
+            probe_cache_filled_hits_ = 0;
+        }
+        auto [it, inserted] = probe_cache_.emplace(
+            probe_key_,
+            res == status::ok ? std::optional<std::string>{value} : std::nullopt
+        );
+        (void) inserted;
+        if(it->second) {
+            value = *it->second;
+        }
+        return res;
+    }
 };
 
 }  // namespace jogasaki::executor::process::impl::ops::details
@@ -262,6 +262,7 @@ public:
                             ctx.req_context() ? ctx.req_context()->transaction().get() : nullptr
                         };
                         c.blob_session(std::addressof(helper.blob_session_container()));
+                        c.like_patterns(std::addressof(ctx.like_patterns_));
                         result = assign_and_evaluate_condition(ctx, cgrp, ctx.incr_, c);
                         if(result.error()) {
                             handle_expression_error(*ctx.req_context(), result, c);
@@ -294,6 +295,7 @@ resume_calling_child_1:
                                     ctx.req_context() ? ctx.req_context()->transaction().get() : nullptr
                                 };
                                 c.blob_session(std::addressof(helper.blob_session_container()));
+                                c.like_patterns(std::addressof(ctx.like_patterns_));
                                 result = assign_and_evaluate_condition(ctx, cgrp, ctx.incr_, c);
                                 if (result.error()) {
                                     handle_expression_error(*ctx.req_context(), result, c);
@@ -351,6 +353,7 @@ resume_calling_child_3:
                                     ctx.req_context() ? ctx.req_context()->transaction().get() : nullptr
                                 };
                                 c.blob_session(std::addressof(helper.blob_session_container()));
+                                c.like_patterns(std::addressof(ctx.like_patterns_));
                                 result = assign_and_evaluate_condition(ctx, cgrp, ctx.incr_, c);
                                 if (result.error()) {
                                     handle_expression_error(*ctx.req_context(), result, c);
@@ -413,6 +416,7 @@ resume_calling_child_6:
                                 ctx.req_context() ? ctx.req_context()->transaction().get() : nullptr
                             };
                             c.blob_session(std::addressof(helper.blob_session_container()));
+                            c.like_patterns(std::addressof(ctx.like_patterns_));
                             auto a = assign_and_evaluate_condition(ctx, cgrp, ctx.incr_, c);
                             if (a.error()) {
                                 handle_expression_error(*ctx.req_context(), a, c);
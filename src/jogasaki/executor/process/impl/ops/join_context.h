@@ -15,6 +15,8 @@
  */
 #pragma once
 
+#include <jogasaki/executor/expr/like_pattern.h>
+
 #include "context_base.h"
 
 namespace jogasaki::executor::process::impl::ops {
@@ -68,6 +70,7 @@ public:
     std::size_t right_group_size_{};  //NOLINT
     std::size_t idx_{};  //NOLINT
     bool resuming_calling_child_6_{};  //NOLINT
+    expr::like_pattern_cache like_patterns_{};  //NOLINT
 };
 
 }  // namespace jogasaki::executor::process::impl::ops
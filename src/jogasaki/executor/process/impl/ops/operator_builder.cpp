@@ -15,9 +15,12 @@
  */
 #include "operator_builder.h"
 
+#include <chrono>
 #include <cstddef>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -41,7 +44,10 @@
 #include <jogasaki/data/iterable_record_store.h>
 #include <jogasaki/dist/key_range.h>
 #include <jogasaki/dist/simple_key_distribution.h>
+#include <jogasaki/dist/key_histogram_store.h>
+#include <jogasaki/dist/sampling_key_distribution.h>
 #include <jogasaki/dist/uniform_key_distribution.h>
+#include <jogasaki/executor/exchange/broadcast/step.h>
 #include <jogasaki/executor/global.h>
 #include <jogasaki/executor/process/impl/bound.h>
 #include <jogasaki/executor/process/impl/ops/details/encode_key.h>
@@ -50,6 +56,7 @@
 #include <jogasaki/executor/process/impl/ops/operator_base.h>
 #include <jogasaki/executor/process/impl/ops/operator_container.h>
 #include <jogasaki/executor/process/impl/scan_range.h>
+#include <jogasaki/executor/process/impl/scan_range_pool.h>
 #include <jogasaki/executor/process/impl/variable_table.h>
 #include <jogasaki/executor/process/impl/variable_table_info.h>
 #include <jogasaki/executor/process/impl/variables_view.h>
@@ -58,7 +65,9 @@
 #include <jogasaki/executor/process/relation_io_map.h>
 #include <jogasaki/executor/process/step.h>
 #include <jogasaki/memory/lifo_paged_memory_resource.h>
+#include <jogasaki/model/step_kind.h>
 #include <jogasaki/plan/plan_exception.h>
+#include <jogasaki/storage/storage_manager.h>
 #include <jogasaki/utils/assert.h>
 #include <jogasaki/utils/from_endpoint.h>
 #include <jogasaki/utils/get_storage_by_index_name.h>
@@ -66,6 +75,7 @@
 
 #include "aggregate_group.h"
 #include "apply.h"
+#include "broadcast_join.h"
 #include "buffer.h"
 #include "emit.h"
 #include "filter.h"
@@ -181,6 +191,9 @@ std::unique_ptr<operator_base> operator_builder::operator()(const relation::scan
 }
 
 std::unique_ptr<operator_base> operator_builder::operator()(const relation::join_find& node) {
+    if(yugawara::binding::extract_if<takatori::plan::exchange>(node.source())) {
+        return create_broadcast_join(node);
+    }
     auto block_index = info_->block_indices().at(&node);
     auto downstream = dispatch(*this, node.output().opposite()->owner());
     auto& secondary_or_primary_index = yugawara::binding::extract<yugawara::storage::index>(node.source());
@@ -200,7 +213,78 @@ std::unique_ptr<operator_base> operator_builder::operator()(const relation::join
     );
 }
 
+std::unique_ptr<operator_base> operator_builder::create_broadcast_join(relation::join_find const& node) {
+    if(node.operator_kind() == relation::join_kind::left_outer_at_most_one) {
+        throw_exception(jogasaki::plan::plan_exception{create_error_info(
+            error_code::unsupported_runtime_feature_exception,
+            "broadcast join with left_outer_at_most_one is not supported yet",
+            status::err_unsupported
+        )});
+    }
+    auto block_index = info_->block_indices().at(&node);
+    auto input_index = relation_io_map_->input_index(node.source());
+    auto& input = io_info_->input_at(input_index);
+    auto* source = io_exchange_map_->input_at(input_index);
+    if(source->kind() != model::step_kind::broadcast) {
+        throw_exception(jogasaki::plan::plan_exception{create_error_info(
+            error_code::unsupported_runtime_feature_exception,
+            "join_find from the exchange other than broadcast is not supported",
+            status::err_unsupported
+        )});
+    }
+    auto& bcast = *unsafe_downcast<executor::exchange::broadcast::step>(source)->info();
+
+    // the hash table key is fixed when the broadcast exchange is compiled, so the keys must match it
+    auto& order = input.column_order();
+    std::unordered_map<std::size_t, takatori::scalar::expression const*> key_expressions{};
+    for(auto&& k : node.keys()) {
+        key_expressions.emplace(order.index(k.variable()), &k.value());
+    }
+    std::vector<details::search_key_field_info> search_key_fields{};
+    search_key_fields.reserve(bcast.key_indices().size());
+    for(auto i : bcast.key_indices()) {
+        auto it = key_expressions.find(i);
+        if(it == key_expressions.end()) {
+            break;
+        }
+        search_key_fields.emplace_back(
+            input.record_meta()->at(i),
+            false,
+            kvs::spec_key_ascending,
+            expr::evaluator{*it->second, info_->compiled_info(), info_->host_variables()}
+        );
+    }
+    if(search_key_fields.size() != key_expressions.size() || search_key_fields.size() != bcast.key_indices().size()) {
+        throw_exception(jogasaki::plan::plan_exception{create_error_info(
+            error_code::unsupported_runtime_feature_exception,
+            "broadcast exchange referenced by join_find with different keys is not supported",
+            status::err_unsupported
+        )});
+    }
+    auto downstream = dispatch(*this, node.output().opposite()->owner());
+    return std::make_unique<broadcast_join>(
+        node.operator_kind(),
+        index_++,
+        *info_,
+        block_index,
+        source,
+        order,
+        input.record_meta(),
+        node.columns(),
+        std::move(search_key_fields),
+        node.condition(),
+        std::move(downstream)
+    );
+}
+
 std::unique_ptr<operator_base> operator_builder::operator()(const relation::join_scan& node) {
+    if(yugawara::binding::extract_if<takatori::plan::exchange>(node.source())) {
+        throw_exception(jogasaki::plan::plan_exception{create_error_info(
+            error_code::unsupported_runtime_feature_exception,
+            "join_scan from broadcast exchange is not supported",
+            status::err_unsupported
+        )});
+    }
     auto block_index = info_->block_indices().at(&node);
     auto downstream = dispatch(*this, node.output().opposite()->owner());
     auto& secondary_or_primary_index = yugawara::binding::extract<yugawara::storage::index>(node.source());
@@ -536,13 +620,28 @@ std::vector<std::shared_ptr<impl::scan_range>> operator_builder::create_scan_ran
     if (rtx_parallel_scan_enabled && scan_parallel_count > 1 && is_rtx && !is_empty) {
         std::unique_ptr<kvs::storage> stg{};
         std::unique_ptr<dist::key_distribution> distribution{};
-        if(global::config_pool()->key_distribution() == key_distribution_kind::uniform) {
+        auto kind = global::config_pool()->key_distribution();
+        if(kind == key_distribution_kind::uniform) {
             stg = utils::get_storage_by_index_name(secondary_or_primary_index.simple_name());
             distribution = std::make_unique<dist::uniform_key_distribution>(
                 *stg,
                 *request_context_->transaction()->object(),
                 request_context_
             );
+        } else if(kind == key_distribution_kind::sampling) {
+            auto& smgr = *global::storage_manager();
+            auto storage_key = smgr.get_storage_key(secondary_or_primary_index.simple_name());
+            stg = utils::get_storage_by_index_name(secondary_or_primary_index.simple_name());
+            distribution = std::make_unique<dist::sampling_key_distribution>(
+                *stg,
+                *request_context_->transaction()->object(),
+                storage_key.value_or(std::string{secondary_or_primary_index.simple_name()}),
+                global::key_histogram_store(),
+                global::config_pool()->key_distribution_sample_count(),
+                global::config_pool()->key_distribution_max_scan_entries(),
+                std::chrono::milliseconds{global::config_pool()->key_distribution_refresh_interval_ms()},
+                request_context_
+            );
         } else {
             distribution = std::make_unique<dist::simple_key_distribution>();
         }
@@ -575,6 +674,13 @@ std::vector<std::shared_ptr<impl::scan_range>> operator_builder::create_scan_ran
                     std::make_unique<data::aligned_buffer>(pivots.back())),
                 std::move(end), is_empty));
         }
+        if(global::config_pool()->enable_scan_range_split() && scan_ranges.size() > 1) {
+            // ranges can be split at runtime and handed to the tasks finished early
+            auto pool = std::make_shared<impl::scan_range_pool>();
+            for(auto&& r : scan_ranges) {
+                r->pool(pool);
+            }
+        }
         VLOG_LP(log_trace) << "rtx scan runs in parallel:" << scan_ranges.size() << " config. max:" << scan_parallel_count;
     } else {
         scan_ranges.reserve(1);
@@ -135,6 +135,8 @@ public:
     std::vector<std::shared_ptr<impl::scan_range>> scan_ranges_{};
     request_context* request_context_{};
 
+    std::unique_ptr<operator_base> create_broadcast_join(relation::join_find const& node);
+
 };
 
 /**
@@ -40,6 +40,7 @@ enum class operator_kind : std::size_t {
     apply,
     values,
     buffer,
+    broadcast_join,
 };
 
 /**
@@ -70,6 +71,7 @@ constexpr inline std::string_view to_string_view(operator_kind value) noexcept {
         case operator_kind::apply: return "apply"sv;
         case operator_kind::values: return "values"sv;
         case operator_kind::buffer: return "buffer"sv;
+        case operator_kind::broadcast_join: return "broadcast_join"sv;
     }
     std::abort();
 }
@@ -88,5 +90,5 @@ inline std::ostream& operator<<(std::ostream& out, operator_kind value) {
 using operator_kind_set = takatori::util::enum_set<
     operator_kind,
     operator_kind::unknown,
-    operator_kind::buffer>;
+    operator_kind::broadcast_join>;
 }
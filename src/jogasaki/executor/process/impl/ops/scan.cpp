@@ -17,6 +17,8 @@
 
 #include <chrono>
 #include <cstddef>
+#include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -32,6 +34,7 @@
 
 #include <jogasaki/data/aligned_buffer.h>
 #include <jogasaki/data/small_record_store.h>
+#include <jogasaki/dist/uniform_key_distribution.h>
 #include <jogasaki/error_code.h>
 #include <jogasaki/executor/global.h>
 #include <jogasaki/executor/process/impl/bound.h>
@@ -76,7 +79,8 @@ scan::scan(
     std::vector<index::field_info> key_fields,
     std::vector<index::field_info> value_fields,
     std::vector<details::secondary_index_field_info> secondary_key_fields,
-    std::unique_ptr<operator_base> downstream
+    std::unique_ptr<operator_base> downstream,
+    std::vector<index::field_info> secondary_value_fields
 ) :
     record_operator(index, info, block_index),
     use_secondary_(! secondary_storage_name.empty()),
@@ -87,7 +91,8 @@ scan::scan(
         use_secondary_,
         std::move(key_fields),
         std::move(value_fields),
-        std::move(secondary_key_fields)
+        std::move(secondary_key_fields),
+        std::move(secondary_value_fields)
     )
 {}
 
@@ -109,7 +114,15 @@ scan::scan(
         index::create_fields(primary_idx, columns, info.vars_info_list()[block_index], true, true),
         index::create_fields(primary_idx, columns, info.vars_info_list()[block_index], false, true),
         create_secondary_key_fields(secondary_idx),
-        std::move(downstream)
+        std::move(downstream),
+        secondary_idx != nullptr ?
+            index::create_covering_fields(
+                primary_idx,
+                *secondary_idx,
+                columns,
+                info.vars_info_list()[block_index]
+            ) :
+            std::vector<index::field_info>{}
     )
 {}
 
@@ -144,13 +157,13 @@ operation_status scan::operator()(  //NOLINT(readability-function-cognitive-comp
         return operation_status_kind::aborted;
     }
     if (ctx.state() == context_state::yielding) {
-        assert_with_exception(ctx.it_ != nullptr);
+        assert_with_exception(ctx.it_ != nullptr || ctx.waiting_);
         // scan is the top level operator (operators tree root), so the resume after yield is fairly simple than
         // other passive operators because there is no need to consider saving the contexts on the upstream operators.
         // We can resume simply by skipping open scan and calling next on the iterator.
         ctx.state(context_state::running_operator_body);
     }
-    if(ctx.it_ == nullptr){
+    if(ctx.it_ == nullptr && ! ctx.waiting_){
         if (ctx.range_->is_empty()){
             // range keys contain null. Nothing should match.
             finish(context);
@@ -162,6 +175,10 @@ operation_status scan::operator()(  //NOLINT(readability-function-cognitive-comp
            return error_abort(ctx, res);
         }
         ctx.cp_.set_checkpoint();
+        if(ctx.pool_ != nullptr) {
+            ctx.pool_->activate();
+            ctx.active_ = true;
+        }
     }
     auto target = ctx.variables().ref();
     auto resource = ctx.varlen_resource();
@@ -172,34 +189,55 @@ operation_status scan::operator()(  //NOLINT(readability-function-cognitive-comp
     auto previous_time = std::chrono::steady_clock::now();
     auto cancel_enabled = utils::request_cancel_enabled(request_cancel_kind::scan);
     while(true) {
+        if(ctx.waiting_) {
+            if(auto r = ctx.pool_->take()) {
+                ctx.waiting_ = false;
+                ctx.active_ = true;
+                ctx.current_range_ = std::move(r);
+                ctx.range_ = ctx.current_range_.get();
+                if((st = open(ctx)) != status::ok) {
+                    break;
+                }
+                continue;
+            }
+            auto now = std::chrono::steady_clock::now();
+            auto waited = std::chrono::duration_cast<std::chrono::milliseconds>(now - ctx.wait_yielded_at_);
+            if(! ctx.pool_->has_active() || (ctx.wait_yielded_ && waited.count() >= scan_yield_interval)) {
+                // nobody can donate the range any more, or the active tasks did not donate within a yield interval
+                ctx.pool_->give_up();
+                ctx.waiting_ = false;
+                st = status::not_found;
+                break;
+            }
+            if(! ctx.wait_yielded_) {
+                ctx.wait_yielded_ = true;
+                ctx.wait_yielded_at_ = now;
+            }
+            ctx.state(context_state::yielding);
+            return operation_status_kind::yield;
+        }
         if(ctx.state() != context_state::calling_child) {
             if (cancel_enabled && cancel_if_needed(ctx)) {
                 finish(context);
                 return operation_status_kind::aborted;
             }
-            if((st = ctx.it_->next()) != status::ok) {
-                handle_kvs_errors(*ctx.req_context(), st);
-                break;
-            }
             std::string_view k{};
             std::string_view v{};
-            ctx.cp_.release();
-            if((st = ctx.it_->read_key(k)) != status::ok) {
-                utils::modify_concurrent_operation_status(*ctx.transaction(), st, true);
-                if(st == status::not_found) {
-                    continue;
-                }
-                handle_kvs_errors(*ctx.req_context(), st);
-                break;
-            }
-            if((st = ctx.it_->read_value(v)) != status::ok) {
-                utils::modify_concurrent_operation_status(*ctx.transaction(), st, true);
-                if (st == status::not_found) {
+            if((st = read_next(ctx, k, v)) != status::ok) {
+                if(st == status::not_found && ctx.pool_ != nullptr) {
+                    // own range is exhausted - wait for the range donated by other tasks
+                    close(ctx);
+                    ctx.pool_->deactivate();
+                    ctx.active_ = false;
+                    ctx.pool_->wait();
+                    ctx.waiting_ = true;
+                    ctx.wait_yielded_ = false;
                     continue;
                 }
                 handle_kvs_errors(*ctx.req_context(), st);
                 break;
             }
+            ctx.cp_.release();
             auto& tx = ctx.strand() != nullptr ? *ctx.strand() : *ctx.tx_->object();
             if(st = field_mapper_.process(k, v, target, *ctx.stg_, tx, resource, *ctx.req_context());
                st != status::ok) {
@@ -227,6 +265,11 @@ operation_status scan::operator()(  //NOLINT(readability-function-cognitive-comp
             auto elapsed_time =
                 std::chrono::duration_cast<std::chrono::milliseconds>(current_time - previous_time);
             if (elapsed_time.count() >= scan_yield_interval) {
+                if(ctx.pool_ != nullptr && ctx.pool_->wanted()) {
+                    if((st = split_range(ctx)) != status::ok) {
+                        break;
+                    }
+                }
                 ++ctx.yield_count_;
                 VLOG_LP(log_trace_fine
                 ) << "scan operator yields count:"
@@ -291,10 +334,78 @@ status scan::open(scan_context& ctx) {  //NOLINT(readability-make-member-functio
 }
 
 
+status scan::split_range(scan_context& ctx) {  //NOLINT(readability-make-member-function-const)
+    std::string_view k{};
+    if(ctx.it_->read_key(k) != status::ok) {
+        return status::ok;
+    }
+    // the iterator is placed on the last entry read, so the unscanned remainder starts after it
+    std::string current{k};
+    auto& stg = use_secondary_ ? *ctx.secondary_stg_ : *ctx.stg_;
+    auto& tx = ctx.strand() != nullptr ? *ctx.strand() : *ctx.tx_->object();
+    auto const& end = ctx.range_->end();
+    std::string high{};
+    if(end.endpointkind() == kvs::end_point_kind::unbound) {
+        dist::uniform_key_distribution distribution{stg, tx};
+        if(distribution.highkey(high) != status::ok) {
+            return status::ok;
+        }
+    } else {
+        high = end.key();
+    }
+    auto pivots = dist::generate_strings2(1, current, high);
+    if(pivots.empty()) {
+        // the remainder is too narrow to split
+        return status::ok;
+    }
+    auto const& pivot = pivots.front();
+    auto donated = std::make_shared<impl::scan_range>(
+        bound(kvs::end_point_kind::inclusive, pivot.size(), std::make_unique<data::aligned_buffer>(pivot)),
+        bound(end.endpointkind(), end.key().size(), std::make_unique<data::aligned_buffer>(end.key())),
+        false
+    );
+    ctx.current_range_ = std::make_shared<impl::scan_range>(
+        bound(kvs::end_point_kind::exclusive, current.size(), std::make_unique<data::aligned_buffer>(current)),
+        bound(kvs::end_point_kind::exclusive, pivot.size(), std::make_unique<data::aligned_buffer>(pivot)),
+        false
+    );
+    ctx.range_ = ctx.current_range_.get();
+    ctx.it_.reset();
+    if(auto res = open(ctx); res != status::ok) {
+        return res;
+    }
+    ctx.pool_->donate(std::move(donated));
+    VLOG_LP(log_trace) << "scan range split and donated to waiting task";
+    return status::ok;
+}
+
 void scan::close(scan_context& ctx) {
     ctx.it_.reset();
 }
 
+status scan::read_next(scan_context& ctx, std::string_view& key, std::string_view& value) {  //NOLINT(readability-make-member-function-const)
+    while(true) {
+        if(auto st = ctx.it_->next(); st != status::ok) {
+            return st;
+        }
+        if(auto st = ctx.it_->read_key(key); st != status::ok) {
+            utils::modify_concurrent_operation_status(*ctx.transaction(), st, true);
+            if(st == status::not_found) {
+                continue;
+            }
+            return st;
+        }
+        if(auto st = ctx.it_->read_value(value); st != status::ok) {
+            utils::modify_concurrent_operation_status(*ctx.transaction(), st, true);
+            if(st == status::not_found) {
+                continue;
+            }
+            return st;
+        }
+        return status::ok;
+    }
+}
+
 std::vector<details::secondary_index_field_info> scan::create_secondary_key_fields(
     yugawara::storage::index const* idx
 ) {
@@ -69,6 +69,8 @@ public:
      * @param key_fields field offset information for keys
      * @param value_fields field offset information for values
      * @param downstream downstream operator invoked after this operation. Pass nullptr if such dispatch is not needed.
+     * @param secondary_value_fields field offset information for the columns covered by the secondary index value.
+     * Pass empty if the secondary index is not covering and the primary index entry needs to be fetched.
      */
     scan(
         operator_index_type index,
@@ -79,7 +81,8 @@ public:
         std::vector<index::field_info> key_fields,
         std::vector<index::field_info> value_fields,
         std::vector<details::secondary_index_field_info> secondary_key_fields,
-        std::unique_ptr<operator_base> downstream = nullptr
+        std::unique_ptr<operator_base> downstream = nullptr,
+        std::vector<index::field_info> secondary_value_fields = {}
     );
 
     /**
@@ -155,6 +158,23 @@ private:
     [[nodiscard]] status open(scan_context& ctx);
     void close(scan_context& ctx);
 
+    /**
+     * @brief read the next entry from the iterator, skipping the entries concurrently removed
+     * @return status::ok if the entry is read successfully
+     * @return status::not_found if the iterator reached the end
+     * @return any error otherwise
+     */
+    [[nodiscard]] status read_next(scan_context& ctx, std::string_view& key, std::string_view& value);
+
+    /**
+     * @brief split the unscanned remainder of the current range and donate the latter half to the pool
+     * @details the iterator is re-opened for the former half. Nothing is done if the remainder is too narrow
+     * to split.
+     * @return status::ok if the range is split or left as it is
+     * @return any error from re-opening the iterator
+     */
+    [[nodiscard]] status split_range(scan_context& ctx);
+
     std::vector<details::secondary_index_field_info> create_secondary_key_fields(
         yugawara::storage::index const* idx
     );
@@ -42,7 +42,8 @@ scan_context::scan_context(
     tx_(tx),
     range_(range),
     strand_(strand),
-    cp_(varlen_resource)
+    cp_(varlen_resource),
+    pool_(range != nullptr ? range->pool().get() : nullptr)
 {}
 
 operator_kind scan_context::kind() const noexcept {
@@ -54,6 +55,16 @@ void scan_context::release() {
         // TODO revisit the life-time of storage objects
         it_ = nullptr;
     }
+    if(pool_ != nullptr) {
+        if(active_) {
+            pool_->deactivate();
+        }
+        if(waiting_) {
+            pool_->give_up();
+        }
+    }
+    active_ = false;
+    waiting_ = false;
 }
 
 transaction_context* scan_context::transaction() const noexcept {
@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <vector>
 
@@ -22,6 +23,7 @@
 #include <jogasaki/executor/process/abstract/task_context.h>
 #include <jogasaki/executor/process/impl/ops/operator_kind.h>
 #include <jogasaki/executor/process/impl/scan_range.h>
+#include <jogasaki/executor/process/impl/scan_range_pool.h>
 #include <jogasaki/executor/process/impl/variables_view.h>
 #include <jogasaki/executor/process/processor_info.h>
 #include <jogasaki/executor/process/step.h>
@@ -81,6 +83,14 @@ private:
     impl::scan_range const* range_{};
     kvs::transaction* strand_{};
     utils::lazy_checkpoint_holder cp_{};
+    impl::scan_range_pool* pool_{};
+    // the range split or taken from the pool at runtime, which replaces `range_`
+    std::shared_ptr<impl::scan_range> current_range_{};
+    bool active_{};
+    bool waiting_{};
+    // whether the waiting task has yielded, and when, to bound the wait for the donated range
+    bool wait_yielded_{};
+    std::chrono::steady_clock::time_point wait_yielded_at_{};
 };
 
 } // namespace jogasaki::executor::process::impl::ops
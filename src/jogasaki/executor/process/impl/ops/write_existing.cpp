@@ -488,6 +488,22 @@ static bool overwraps(
     return false;
 }
 
+static bool overwraps(
+    std::vector<yugawara::storage::index::column_ref> const& values,
+    sequence_view<write_existing::column const> columns
+) {
+    yugawara::binding::factory bindings{};
+    for(auto&& v : values) {
+        auto vc = bindings(v);
+        for(auto&& c : columns) {
+            if(c.destination() == vc) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 static std::pair<std::vector<index::secondary_target>, write_existing::bool_list_type>
 create_secondary_targets_and_key_update_list(
     yugawara::storage::index const& idx,
@@ -521,7 +537,8 @@ create_secondary_targets_and_key_update_list(
                 key_meta,
                 value_meta
             );
-            ret_r[i] = overwraps(entry->keys(), columns);
+            // covered columns are stored in the secondary value, so the entry is rewritten when they are updated
+            ret_r[i] = overwraps(entry->keys(), columns) || overwraps(entry->values(), columns);
             ++i;
         }
     );
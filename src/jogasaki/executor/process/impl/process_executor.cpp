@@ -44,6 +44,16 @@ abstract::process_executor_factory& default_process_executor_factory() {
 }
 
 process_executor::status process_executor::run() {
+    abstract::task_context::wake_up_condition_type condition{};
+    auto rc = run(condition);
+    if (rc == status::to_sleep) {
+        // caller is not able to wait for the condition, so just yield
+        return status::to_yield;
+    }
+    return rc;
+}
+
+process_executor::status process_executor::run(abstract::task_context::wake_up_condition_type& condition) {
     // assign context
     auto context = contexts_->pop();
 
@@ -87,6 +97,12 @@ process_executor::status process_executor::run() {
         VLOG_LP(log_trace) << "writer_pool::release() success";
     }
 
+    if (rc == status::to_yield) {
+        if (auto c = context->release_wake_up_condition(); c) {
+            condition = std::move(c);
+            rc = status::to_sleep;
+        }
+    }
     switch(rc) {
         case status::completed:
         case status::completed_with_errors:
@@ -42,6 +42,13 @@ public:
 
     [[nodiscard]] status run() override;
 
+    /**
+     * @brief run the processor, receiving the condition to wake up the task if it goes to sleep
+     * @details if the processor yields leaving the wake-up condition on the task context, status::to_sleep is
+     * returned with the condition
+     */
+    [[nodiscard]] status run(abstract::task_context::wake_up_condition_type& condition) override;
+
 private:
     std::shared_ptr<abstract::processor> processor_{};
     std::shared_ptr<impl::task_context_pool> contexts_{};
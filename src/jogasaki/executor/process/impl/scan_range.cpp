@@ -26,6 +26,8 @@ scan_range::scan_range() noexcept: is_empty_(true) {}
 [[nodiscard]] bound const& scan_range::begin() const noexcept { return begin_; }
 [[nodiscard]] bound const& scan_range::end() const noexcept { return end_; }
 [[nodiscard]] bool scan_range::is_empty() const noexcept { return is_empty_; }
+[[nodiscard]] std::shared_ptr<scan_range_pool> const& scan_range::pool() const noexcept { return pool_; }
+void scan_range::pool(std::shared_ptr<scan_range_pool> arg) noexcept { pool_ = std::move(arg); }
 
 void scan_range::dump(std::ostream& out, int indent) const noexcept {
     std::string indent_space(indent, ' ');
@@ -15,8 +15,11 @@
  */
 #pragma once
 
+#include <memory>
+
 #include <jogasaki/executor/process/abstract/range.h>
 #include <jogasaki/executor/process/impl/bound.h>
+#include <jogasaki/executor/process/impl/scan_range_pool.h>
 
 namespace jogasaki::executor::process::impl {
 
@@ -32,6 +35,15 @@ class scan_range : public abstract::range {
     [[nodiscard]] bound const& begin() const noexcept;
     [[nodiscard]] bound const& end() const noexcept;
     [[nodiscard]] bool is_empty() const noexcept;
+    /**
+     * @brief accessor to the pool shared by the ranges of a parallel scan
+     * @return the pool, or nullptr if the range is not split at runtime
+     */
+    [[nodiscard]] std::shared_ptr<scan_range_pool> const& pool() const noexcept;
+    /**
+     * @brief setter of the pool shared by the ranges of a parallel scan
+     */
+    void pool(std::shared_ptr<scan_range_pool> arg) noexcept;
     /**
      * @brief Support for debugging, callable in GDB
      * @param out The output stream to which the buffer's internal state will be written.
@@ -44,6 +56,7 @@ class scan_range : public abstract::range {
     bound begin_;
     bound end_;
     bool is_empty_;
+    std::shared_ptr<scan_range_pool> pool_{};
 };
 
 } // namespace jogasaki::executor::process::impl
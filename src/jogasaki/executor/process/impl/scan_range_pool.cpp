@@ -0,0 +1,83 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "scan_range_pool.h"
+
+#include <utility>
+
+#include <jogasaki/executor/process/impl/scan_range.h>
+
+namespace jogasaki::executor::process::impl {
+
+void scan_range_pool::activate() {
+    std::lock_guard lk{mutex_};
+    ++active_;
+}
+
+void scan_range_pool::deactivate() {
+    std::lock_guard lk{mutex_};
+    if(active_ > 0) {
+        --active_;
+    }
+}
+
+void scan_range_pool::wait() {
+    std::lock_guard lk{mutex_};
+    ++waiting_;
+}
+
+void scan_range_pool::give_up() {
+    std::lock_guard lk{mutex_};
+    if(waiting_ > 0) {
+        --waiting_;
+    }
+}
+
+bool scan_range_pool::wanted() const {
+    std::lock_guard lk{mutex_};
+    return waiting_ > ranges_.size();
+}
+
+void scan_range_pool::donate(std::shared_ptr<scan_range> range) {
+    std::lock_guard lk{mutex_};
+    ranges_.emplace_back(std::move(range));
+    ++donated_count_;
+}
+
+std::shared_ptr<scan_range> scan_range_pool::take() {
+    std::lock_guard lk{mutex_};
+    if(ranges_.empty()) {
+        return {};
+    }
+    auto ret = std::move(ranges_.front());
+    ranges_.pop_front();
+    if(waiting_ > 0) {
+        --waiting_;
+    }
+    ++active_;
+    return ret;
+}
+
+bool scan_range_pool::has_active() const {
+    std::lock_guard lk{mutex_};
+    return active_ > 0;
+}
+
+std::size_t scan_range_pool::donated_count() const {
+    std::lock_guard lk{mutex_};
+    return donated_count_;
+}
+
+}  // namespace jogasaki::executor::process::impl
@@ -0,0 +1,97 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+namespace jogasaki::executor::process::impl {
+
+class scan_range;
+
+/**
+ * @brief pool of the scan ranges shared by the tasks of a parallel scan
+ * @details the scan tasks which finished their own ranges wait for work here, and the tasks still scanning donate
+ * the latter half of their unscanned ranges at the yield points while someone is waiting. This balances the work
+ * between the tasks when the ranges divided up front contain different number of entries.
+ * This object is thread-safe.
+ */
+class scan_range_pool {
+public:
+    /**
+     * @brief create empty object
+     */
+    scan_range_pool() = default;
+
+    /**
+     * @brief register the scan task that starts scanning
+     */
+    void activate();
+
+    /**
+     * @brief unregister the scan task that stops scanning
+     */
+    void deactivate();
+
+    /**
+     * @brief register the scan task that finished its range and waits for a donated one
+     */
+    void wait();
+
+    /**
+     * @brief unregister the waiting scan task that gives up waiting
+     */
+    void give_up();
+
+    /**
+     * @brief returns whether donating the range helps some waiting task
+     */
+    [[nodiscard]] bool wanted() const;
+
+    /**
+     * @brief add the range for the waiting tasks
+     * @param range the range donated by the active task
+     */
+    void donate(std::shared_ptr<scan_range> range);
+
+    /**
+     * @brief take the donated range
+     * @details if a range is taken, the caller becomes active (i.e. no longer waiting)
+     * @return the donated range, or nullptr if nothing is available
+     */
+    [[nodiscard]] std::shared_ptr<scan_range> take();
+
+    /**
+     * @brief returns whether any task is scanning and can donate the range
+     */
+    [[nodiscard]] bool has_active() const;
+
+    /**
+     * @brief returns the number of the ranges donated to this pool so far
+     */
+    [[nodiscard]] std::size_t donated_count() const;
+
+private:
+    mutable std::mutex mutex_{};
+    std::deque<std::shared_ptr<scan_range>> ranges_{};
+    std::size_t active_{};
+    std::size_t waiting_{};
+    std::size_t donated_count_{};
+};
+
+}  // namespace jogasaki::executor::process::impl
@@ -23,6 +23,7 @@
 #include <jogasaki/logging.h>
 #include <jogasaki/logging_helper.h>
 #include <jogasaki/executor/exchange/aggregate/flow.h>
+#include <jogasaki/executor/exchange/broadcast/flow.h>
 #include <jogasaki/executor/exchange/forward/flow.h>
 #include <jogasaki/executor/exchange/group/flow.h>
 #include <jogasaki/executor/exchange/sink.h>
@@ -89,6 +90,8 @@ void task_context::deactivate_writer(writer_index idx) {
             return unsafe_downcast<exchange::aggregate::flow>(flow).sink_at(sink_index).deactivate(); //NOLINT
         case step_kind::forward:
             return unsafe_downcast<exchange::forward::flow>(flow).sink_at(sink_index).deactivate(); //NOLINT
+        case step_kind::broadcast:
+            return unsafe_downcast<exchange::broadcast::flow>(flow).sink_at(sink_index).deactivate(); //NOLINT
         default:
             fail_with_exception();
     }
@@ -106,6 +109,8 @@ io::record_writer* task_context::downstream_writer(task_context::writer_index id
             return &unsafe_downcast<exchange::aggregate::flow>(flow).sink_at(sink_index).acquire_writer(); //NOLINT
         case step_kind::forward:
             return &unsafe_downcast<exchange::forward::flow>(flow).sink_at(sink_index).acquire_writer(); //NOLINT
+        case step_kind::broadcast:
+            return &unsafe_downcast<exchange::broadcast::flow>(flow).sink_at(sink_index).acquire_writer(); //NOLINT
         default:
             fail_with_exception();
     }
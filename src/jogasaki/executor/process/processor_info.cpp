@@ -106,6 +106,18 @@ processor_info::processor_info(
     block_indices_ = std::move(p.second);
 }
 
+processor_info::processor_info(
+    processor_info const& other,
+    variable_table const* host_variables
+) :
+    relations_(other.relations_),
+    info_(other.info_),
+    vars_info_list_(other.vars_info_list_),
+    block_indices_(other.block_indices_),
+    details_(other.details_),
+    host_variables_(host_variables)
+{}
+
 relation::graph_type const& processor_info::relations() const noexcept {
     return *relations_;
 }
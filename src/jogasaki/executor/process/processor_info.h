@@ -93,6 +93,16 @@ public:
         variable_table const* host_variables = nullptr
     );
 
+    /**
+     * @brief create copy of the other processor info bound to the given host variables
+     * @details this skips analyzing the relational operators and is used to reuse the compiled processor
+     * information across executions of the prepared statement.
+     */
+    processor_info(
+        processor_info const& other,
+        variable_table const* host_variables
+    );
+
     [[nodiscard]] relation::graph_type const& relations() const noexcept;
 
     [[nodiscard]] yugawara::compiled_info const& compiled_info() const noexcept;
@@ -26,6 +26,7 @@
 #include <takatori/util/reference_iterator.h>
 #include <takatori/util/sequence_view.h>
 
+#include <jogasaki/executor/exchange/broadcast/step.h>
 #include <jogasaki/executor/exchange/forward/step.h>
 #include <jogasaki/executor/exchange/shuffle/step.h>
 #include <jogasaki/executor/exchange/step.h>
@@ -65,6 +66,14 @@ std::shared_ptr<io_info> step::create_io_info() {
                 );
                 break;
             }
+            case model::step_kind::broadcast: {
+                auto& bc = unsafe_downcast<exchange::broadcast::step>(xchg);
+                inputs.emplace_back(
+                    bc.output_meta(),
+                    bc.output_order()
+                );
+                break;
+            }
             case model::step_kind::group:
             case model::step_kind::aggregate:
             {
@@ -84,6 +93,7 @@ std::shared_ptr<io_info> step::create_io_info() {
         auto& xchg = *io_exchange_map_->output_at(i);
         switch(xchg.kind()) {
             case model::step_kind::forward:
+            case model::step_kind::broadcast:
             case model::step_kind::group:
             case model::step_kind::aggregate: {
                 outputs.emplace_back(
@@ -184,4 +194,8 @@ void step::io_exchange_map(std::shared_ptr<class io_exchange_map> arg) noexcept
 std::shared_ptr<class io_exchange_map> const& step::io_exchange_map() const noexcept {
     return io_exchange_map_;
 }
+
+std::shared_ptr<processor_info> const& step::info() const noexcept {
+    return info_;
+}
 }
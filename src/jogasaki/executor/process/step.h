@@ -84,6 +84,17 @@ public:
 
     [[nodiscard]] std::shared_ptr<class io_exchange_map> const& io_exchange_map() const noexcept;
 
+    /**
+     * @brief accessor to the processor information
+     */
+    [[nodiscard]] std::shared_ptr<processor_info> const& info() const noexcept;
+
+    /**
+     * @brief create io information from the io_exchange_map
+     * @pre io_exchange_map is populated with the input/output exchanges of this step
+     */
+    [[nodiscard]] std::shared_ptr<class io_info> create_io_info();
+
 private:
     std::shared_ptr<processor_info> info_{};
     std::shared_ptr<abstract::process_executor_factory> executor_factory_{};
@@ -91,8 +102,6 @@ private:
     std::size_t partitions_{global::config_pool()->default_partitions()};
     std::shared_ptr<class relation_io_map> relation_io_map_{};
     std::shared_ptr<class io_exchange_map> io_exchange_map_{std::make_shared<class io_exchange_map>()};
-
-    std::shared_ptr<class io_info> create_io_info();
 };
 
 } // namespace jogasaki::executor::process
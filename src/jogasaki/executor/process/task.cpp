@@ -55,7 +55,7 @@ model::task_result task::operator()() {
         (*cb)(&arg);
     }
 
-    auto status = executor_->run();
+    auto status = executor_->run(wake_up_condition_);
     switch (status) {
         case abstract::status::completed:
             // raise appropriate event if needed
@@ -66,10 +66,6 @@ model::task_result task::operator()() {
             common::send_event(*context(), event_enum_tag<event_kind::task_completed>, step()->id(), id());
             break;
         case abstract::status::to_sleep:
-            // TODO support sleep/yield
-
-            fail_with_exception();
-            break;
         case abstract::status::to_yield:
             break;
         default:
@@ -95,8 +91,9 @@ model::task_result task::operator()() {
     switch (status) {
         case abstract::status::completed:
         case abstract::status::completed_with_errors:
-        case abstract::status::to_sleep:
             return jogasaki::model::task_result::complete;
+        case abstract::status::to_sleep:
+            return jogasaki::model::task_result::sleep;
         case abstract::status::to_yield:
             return jogasaki::model::task_result::yield;
         default:
@@ -108,6 +105,10 @@ model::task_transaction_kind task::transaction_capability() {
     return transaction_capability_;
 }
 
+std::function<bool()> task::release_wake_up_condition() {
+    return std::exchange(wake_up_condition_, {});
+}
+
 } // namespace jogasaki::executor::process
 
 
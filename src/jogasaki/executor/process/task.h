@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <functional>
 #include <memory>
 
 #include <jogasaki/executor/common/task.h>
@@ -43,10 +44,13 @@ public:
 
     [[nodiscard]] model::task_transaction_kind transaction_capability() override;
 
+    [[nodiscard]] std::function<bool()> release_wake_up_condition() override;
+
 private:
     std::shared_ptr<abstract::process_executor> executor_{};
     std::shared_ptr<abstract::processor> processor_{};
     model::task_transaction_kind transaction_capability_{};
+    abstract::task_context::wake_up_condition_type wake_up_condition_{};
 };
 
 }
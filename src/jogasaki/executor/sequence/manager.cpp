@@ -58,9 +58,11 @@ static void populate_sequences(manager::sequences_type& sequences, manager::id_m
 
 manager::manager(
     kvs::database& db,
-    id_map_type const& id_map
+    id_map_type const& id_map,
+    std::size_t cache_size
 ) :
-    db_(std::addressof(db))
+    db_(std::addressof(db)),
+    cache_size_(cache_size)
 {
     populate_sequences(sequences_, id_map);
 }
@@ -139,7 +141,7 @@ sequence* manager::register_sequence(
         v.version_ = initial_sequence_version;
         v.value_ = initial_value;
     }
-    acc->second.sequence(std::make_unique<sequence>(*p, *this, v.version_, v.value_));
+    acc->second.sequence(std::make_unique<sequence>(*p, *this, v.version_, v.value_, cache_size_));
 
     if (save_id_map_entry) {
         save_id_map(tx);
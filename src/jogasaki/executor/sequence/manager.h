@@ -107,8 +107,10 @@ public:
      * @brief create new manager object
      * @param db database where the sequences are stored/saved
      * @param id_map definition id to sequence id map
+     * @param cache_size the number of values each thread reserves at once for the sequences registered
+     * by this manager (0 or 1 disables caching)
      */
-    explicit manager(kvs::database& db, id_map_type const& id_map = {});
+    explicit manager(kvs::database& db, id_map_type const& id_map = {}, std::size_t cache_size = 1);
 
     /**
      * @brief load sequence id mapping from system_sequences table and initialize in-memory sequence objects.
@@ -214,6 +216,7 @@ public:
 
 private:
     kvs::database* db_{};
+    std::size_t cache_size_{1};
     sequences_type sequences_{};
     tbb::concurrent_hash_map<kvs::transaction*, std::unordered_set<sequence*>> used_sequences_{};
 
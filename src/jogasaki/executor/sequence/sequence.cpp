@@ -16,6 +16,9 @@
 #include "sequence.h"
 
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
 #include <utility>
 
 #include <jogasaki/common_types.h>
@@ -26,14 +29,36 @@
 
 namespace jogasaki::executor::sequence {
 
+namespace {
+
+/**
+ * @brief the values reserved by the current thread
+ */
+struct cached_block {
+    sequence_value next_{};
+    std::size_t remaining_{};
+};
+
+std::atomic_uint64_t cache_key_source{};  //NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+std::unordered_map<std::uint64_t, cached_block>& thread_cache() {
+    thread_local std::unordered_map<std::uint64_t, cached_block> cache{};  //NOLINT(misc-use-internal-linkage) false positive
+    return cache;
+}
+
+}  // namespace
+
 sequence::sequence(
     class info const& info,
     manager& parent,
     sequence_version version,
-    sequence_value value
+    sequence_value value,
+    std::size_t cache_size
 ) :
     info_(std::addressof(info)),
     parent_(std::addressof(parent)),
+    cache_size_(cache_size),
+    cache_key_(++cache_key_source),
     body_({version, value})
 {}
 
@@ -42,39 +67,75 @@ sequence_versioned_value sequence::get() const noexcept {
 }
 
 either<sequence_error, sequence_value> sequence::next(kvs::transaction& tx) {
+    // mark even if the value comes from the cache so that the tx makes the high-water mark durable
     parent_->mark_sequence_used_by(tx, *this);
+    if(cache_size_ > 1) {
+        auto& b = thread_cache()[cache_key_];
+        if(b.remaining_ > 0) {
+            auto ret = b.next_;
+            if(--b.remaining_ > 0) {
+                b.next_ += info_->increment();
+            }
+            return ret;
+        }
+    }
+    return reserve();
+}
+
+either<sequence_error, sequence_value> sequence::reserve() {
+    auto inc = info_->increment();
+    auto has_next = [&](sequence_value v) {
+        if(inc > 0) {
+            return info_->maximum_value() - v >= inc;
+        }
+        if(inc < 0) {
+            return v - info_->minimum_value() >= -inc;
+        }
+        return true;
+    };
     aligned_sequence_versioned_value cur{};
     aligned_sequence_versioned_value next{};
+    sequence_value first{};
+    std::size_t count{};
     do {
         cur = body_.load();
         if(cur.version_ == initial_sequence_version) {
             // the first version is the special case and use initial value
-            next = {cur.version_ + 1, info_->initial_value()};
-            continue;
-        }
-        sequence_value val{};
-        if (info_->increment() > 0 && info_->maximum_value() - cur.value_ < info_->increment()) {
-            if(info_->cycle()) {
-                val = info_->minimum_value();
-            } else {
+            first = info_->initial_value();
+        } else if (inc > 0 && ! has_next(cur.value_)) {
+            if(! info_->cycle()) {
                 return sequence_error::out_of_upper_bound;
             }
-        } else if (info_->increment() < 0 && cur.value_ - info_->minimum_value() < -info_->increment()) {
-            if(info_->cycle()) {
-                val = info_->maximum_value();
-            } else {
+            first = info_->minimum_value();
+        } else if (inc < 0 && ! has_next(cur.value_)) {
+            if(! info_->cycle()) {
                 return sequence_error::out_of_lower_bound;
             }
+            first = info_->maximum_value();
         } else {
-            val = cur.value_ + info_->increment();
+            first = cur.value_ + inc;
+        }
+        // the block stops at the boundary, and the next reservation cycles if necessary
+        sequence_value last = first;
+        count = 1;
+        while(count < cache_size_ && has_next(last)) {
+            last += inc;
+            ++count;
         }
-        next = {cur.version_ + 1, val};
+        next = {cur.version_ + 1, last};
     } while(! body_.compare_exchange_strong(cur, next));
-    return next.value_;
+    if(count > 1) {
+        thread_cache()[cache_key_] = cached_block{first + inc, count - 1};
+    }
+    return first;
 }
 
 class info const& sequence::info() const noexcept {
     return *info_;
 }
 
+std::size_t sequence::cache_size() const noexcept {
+    return cache_size_;
+}
+
 }  // namespace jogasaki::executor::sequence
@@ -16,6 +16,8 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <unordered_set>
 
 #include <takatori/util/either.h>
@@ -64,7 +66,12 @@ inline std::ostream& operator<<(std::ostream& out, sequence_error value) {
 
 /**
  * @brief in-memory sequence object
- * @details represent thread-safe updatable sequence object managed in-memory
+ * @details represent thread-safe updatable sequence object managed in-memory.
+ * If the cache size is greater than 1, each thread reserves a block of values at once and hands them out
+ * from its local cache, so that the shared value is updated once per block. The shared value then holds the
+ * high-water mark of the reserved blocks, which is what is made durable by manager::notify_updates().
+ * Values are unique, but not monotonic across threads, and the values left in the caches are skipped
+ * when the sequence is re-loaded (e.g. on restart.)
  */
 class sequence {
 public:
@@ -89,12 +96,14 @@ public:
      * @param parent the owner of the sequence
      * @param version the current version of the sequence
      * @param value the current value of the sequence
+     * @param cache_size the number of values reserved by a thread at once (0 or 1 disables caching)
      */
     sequence(
         class info const& info,
         manager& parent,
         sequence_version version,
-        sequence_value value
+        sequence_value value,
+        std::size_t cache_size = 1
     );
 
     /**
@@ -114,9 +123,17 @@ public:
      */
     [[nodiscard]] class info const& info() const noexcept;
 
+    /**
+     * @brief accessor to the cache size
+     */
+    [[nodiscard]] std::size_t cache_size() const noexcept;
+
 private:
     class info const* info_{};
     manager* parent_{};
+    std::size_t cache_size_{1};
+    // identifies this object in thread local caches - address can be re-used after the sequence is removed
+    std::uint64_t cache_key_{};
 
     /**
      * @brief aligned versioned value to be used in atomic operations
@@ -128,6 +145,7 @@ private:
 
     std::atomic<aligned_sequence_versioned_value> body_{};
 
+    either<sequence_error, sequence_value> reserve();
 };
 
 /**
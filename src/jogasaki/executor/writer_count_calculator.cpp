@@ -74,6 +74,10 @@ size_t intermediate_calculate_partition(
             const auto& upstreams = process.upstreams();
             if (upstreams.empty()) { return terminal_calculate_partition(s, partitions, is_rtx); }
             for (auto&& t : upstreams) {
+                if (t.kind() == takatori::plan::step_kind::broadcast) {
+                    // broadcast is read entirely by each partition of the process
+                    continue;
+                }
                 auto par = intermediate_calculate_partition(t, partitions, is_rtx);
                 if (sum != 0 && sum != par) {
                     VLOG_LP(log_error) << "two upstreams have different partitions " << sum << ", "
@@ -18,6 +18,7 @@
 #include <cstddef>
 #include <functional>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <takatori/descriptor/variable.h>
@@ -141,4 +142,42 @@ std::vector<index::field_info> create_fields(
     return ret;
 }
 
+/**
+ * @brief create fields to read the covered columns from the secondary index value
+ * @details the secondary index covers the columns if every column read from the table is either a primary key
+ * column or one of the secondary index values, and then the primary index lookup can be skipped.
+ * @param primary the primary index
+ * @param secondary the secondary index
+ * @param columns the columns read from the table
+ * @param varinfo the variable table info. for the output variables
+ * @return the secondary value fields if the secondary index covers the columns
+ * @return empty vector otherwise
+ */
+template <class Column>
+std::vector<index::field_info> create_covering_fields(
+    yugawara::storage::index const& primary,
+    yugawara::storage::index const& secondary,
+    sequence_view<Column const> columns,
+    variable_table_info const& varinfo
+) {
+    if (secondary.values().empty()) {
+        return {};
+    }
+    using variable = takatori::descriptor::variable;
+    yugawara::binding::factory bindings{};
+    std::unordered_set<variable> available{};
+    for(auto&& k : primary.keys()) {
+        available.emplace(bindings(k.column()));
+    }
+    for(auto&& v : secondary.values()) {
+        available.emplace(bindings(v));
+    }
+    for(auto&& c : columns) {
+        if (available.count(c.source()) == 0) {
+            return {};
+        }
+    }
+    return create_fields(secondary, columns, varinfo, false, true);
+}
+
 }  // namespace jogasaki::index
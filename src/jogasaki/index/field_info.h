@@ -41,7 +41,7 @@ struct cache_align field_info {
      * @param nullable whether the target field is nullable or not
      * @param spec the spec of the target field used for encode/decode
      * @param source_region_id identifies the variable_table region that holds the source variable.
-     *   Only meaningful when encoding from input variables (i.e. used by primary_target::input_keys_).
+     *   Only meaningful when encoding from input variables (i.e. used for the input keys of primary_target).
      *   Defaults to undefined for fields where it is not applicable.
      */
     field_info(
@@ -22,54 +22,9 @@
 
 namespace jogasaki::index {
 
-status decode_fields(
-    std::vector<index::field_info> const& fields,
-    kvs::readable_stream& stream,
-    accessor::record_ref target,
-    memory::lifo_paged_memory_resource* resource
-) {
-    for(auto&& f : fields) {
-        kvs::coding_context ctx{};
-        if (! f.exists_) {
-            if (f.nullable_) {
-                if(auto res = kvs::consume_stream_nullable(stream, f.type_, f.spec_, ctx); res != status::ok) {
-                    return res;
-                }
-                continue;
-            }
-            if(auto res = kvs::consume_stream(stream, f.type_, f.spec_, ctx); res != status::ok) {
-                return res;
-            }
-            continue;
-        }
-        if (f.nullable_) {
-            if(auto res = kvs::decode_nullable(
-                    stream,
-                    f.type_,
-                    f.spec_,
-                    ctx,
-                    target,
-                    f.offset_,
-                    f.nullity_offset_,
-                    resource
-                ); res != status::ok) {
-                return res;
-            }
-            continue;
-        }
-        if(auto res = kvs::decode(stream, f.type_, f.spec_, ctx, target, f.offset_, resource); res != status::ok) {
-            return res;
-        }
-        target.set_null(f.nullity_offset_, false); // currently assuming target variable fields are
-        // nullable and f.nullity_offset_ is valid
-        // even if f.nullable_ is false
-    }
-    return status::ok;
-}
-
 mapper::mapper(std::vector<field_info> key_fields, std::vector<field_info> value_fields) :
-    key_fields_(std::move(key_fields)),
-    value_fields_(std::move(value_fields))
+    key_codec_(std::move(key_fields)),
+    value_codec_(std::move(value_fields))
 {}
 
 bool mapper::read(
@@ -78,8 +33,8 @@ bool mapper::read(
     accessor::record_ref target,
     memory::lifo_paged_memory_resource* resource
 ) {
-    auto& flds = key ? key_fields_ : value_fields_;
-    return decode_fields(flds, stream, target, resource) == status::ok;
+    auto& codec = key ? key_codec_ : value_codec_;
+    return codec.decode(stream, target, resource) == status::ok;
 }
 
 }  // namespace jogasaki::index
@@ -22,6 +22,7 @@
 
 #include <jogasaki/accessor/record_ref.h>
 #include <jogasaki/index/field_info.h>
+#include <jogasaki/index/record_codec.h>
 #include <jogasaki/kvs/coder.h>
 #include <jogasaki/memory/lifo_paged_memory_resource.h>
 #include <jogasaki/status.h>
@@ -29,31 +30,27 @@
 namespace jogasaki::index {
 
 /**
- * @brief decode fields
- * @param fields fields to decode
- * @param stream input stream to decode
- * @param target target record
- * @param resource memory resource for decoding
- * @return status::ok when successful
- * @return status::err_data_corruption if decoded data is not valid
- * @return any error otherwise
+ * @brief mapper to decode key/value of the index into the record
  */
-status decode_fields(
-    std::vector<index::field_info> const& fields,
-    kvs::readable_stream& stream,
-    accessor::record_ref target,
-    memory::lifo_paged_memory_resource* resource
-);
-
 class mapper {
 public:
     mapper() = default;
 
+    /**
+     * @brief create new object
+     * @param key_fields the fields encoded in the key
+     * @param value_fields the fields encoded in the value
+     */
     mapper(
         std::vector<field_info> key_fields,
         std::vector<field_info> value_fields
     );
 
+    /**
+     * @brief decode key or value into the target record
+     * @return true if successful
+     * @return false if decoded data is not valid
+     */
     bool read(
         bool key,
         kvs::readable_stream& stream,
@@ -62,8 +59,8 @@ public:
     );
 
 private:
-    std::vector<field_info> key_fields_{};
-    std::vector<field_info> value_fields_{};
+    record_codec key_codec_{};
+    record_codec value_codec_{};
 };
 
 }  // namespace jogasaki::index
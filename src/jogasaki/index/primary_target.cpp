@@ -27,6 +27,7 @@
 #include <jogasaki/executor/process/impl/variables_view.h>
 #include <jogasaki/index/field_info.h>
 #include <jogasaki/index/primary_context.h>
+#include <jogasaki/index/record_codec.h>
 #include <jogasaki/kvs/coder.h>
 #include <jogasaki/kvs/readable_stream.h>
 #include <jogasaki/kvs/writable_stream.h>
@@ -42,34 +43,6 @@ namespace jogasaki::index {
 using takatori::util::maybe_shared_ptr;
 using executor::process::impl::variables_view;
 
-template<class SourceFn>
-static status encode_fields(
-    primary_target::field_mapping_type const& fields,
-    kvs::writable_stream& target,
-    SourceFn const& get_source
-) {
-    for(auto const& f : fields) {
-        auto source = get_source(f);
-        kvs::coding_context ctx{};
-        ctx.coding_for_write(true);
-        if(f.nullable_) {
-            if(auto res = kvs::encode_nullable(source, f.offset_, f.nullity_offset_, f.type_, f.spec_, ctx, target);
-                res != status::ok) {
-                return res;
-            }
-        } else {
-            if(source.is_null(f.nullity_offset_)) {
-                VLOG_LP(log_error) << "Null assigned for non-nullable field.";
-                return status::err_integrity_constraint_violation;
-            }
-            if(auto res = kvs::encode(source, f.offset_, f.type_, f.spec_, ctx, target); res != status::ok) {
-                return res;
-            }
-        }
-    }
-    return status::ok;
-}
-
 /**
  * @brief encode fields into buffer, retrying once if buffer is too small
  * @param get_source callable taking field_info const& and returning accessor::record_ref for that field;
@@ -78,14 +51,14 @@ static status encode_fields(
 template<class SourceFn>
 static status do_encode(
     data::aligned_buffer& buf,
-    primary_target::field_mapping_type const& info,
+    record_codec const& codec,
     SourceFn const& get_source,
     std::string_view& out
 ) {
     std::size_t length{};
     for(int loop = 0; loop < 2; ++loop) { // if first trial overflows `buf`, extend it and retry
         kvs::writable_stream keys{buf.data(), buf.capacity(), loop == 0};
-        if(auto res = encode_fields(info, keys, get_source); res != status::ok) {
+        if(auto res = codec.encode(keys, get_source); res != status::ok) {
             return res;
         }
         length = keys.size();
@@ -113,9 +86,9 @@ primary_target::primary_target(
     storage_name_(storage_name),
     key_meta_(std::move(key_meta)),
     value_meta_(std::move(value_meta)),
-    input_keys_(std::move(input_keys)),
-    extracted_keys_(std::move(extracted_keys)),
-    extracted_values_(std::move(extracted_values))
+    input_key_codec_(std::move(input_keys)),
+    extracted_key_codec_(std::move(extracted_keys)),
+    extracted_value_codec_(std::move(extracted_values))
 {}
 
 status primary_target::find_by_encoded_key(
@@ -134,12 +107,12 @@ status primary_target::find_by_encoded_key(
     }
     kvs::readable_stream keys{encoded_key.data(), encoded_key.size()};
     kvs::readable_stream values{v.data(), v.size()};
-    if(auto res = decode_fields(extracted_keys_, keys, dest_key, varlen_resource);
+    if(auto res = extracted_key_codec_.decode(keys, dest_key, varlen_resource);
        res != status::ok) {
         handle_encode_errors(*ctx.req_context(), res);
         return res;
     }
-    if(auto res = decode_fields(extracted_values_, values, dest_value, varlen_resource);
+    if(auto res = extracted_value_codec_.decode(values, dest_value, varlen_resource);
        res != status::ok) {
         handle_encode_errors(*ctx.req_context(), res);
         return res;
@@ -179,7 +152,7 @@ status primary_target::prepare_encoded_key(
     accessor::record_ref source,
     std::string_view& out
 ) const {
-    if(auto res = do_encode(ctx.key_buf_, input_keys_, [&](auto const&) { return source; }, out);
+    if(auto res = do_encode(ctx.key_buf_, input_key_codec_, [&](auto const&) { return source; }, out);
         res != status::ok) {
         handle_encode_errors(*ctx.req_context(), res);
         return res;
@@ -193,7 +166,7 @@ status primary_target::prepare_encoded_key(
     variables_view variables,
     std::string_view& out
 ) const {
-    if(auto res = do_encode(ctx.key_buf_, input_keys_,
+    if(auto res = do_encode(ctx.key_buf_, input_key_codec_,
             [&](auto const& f) { return variables.ref(f.source_region_id_); }, out);
         res != status::ok) {
         handle_encode_errors(*ctx.req_context(), res);
@@ -304,7 +277,7 @@ status primary_target::encode_put(
     std::vector<lob::lob_id_type> lobs{};
     if (ctx.req_context()) {  // some testcase does not set req_context
       if (auto res = ensure_lobs_resolved_and_collect_ids(
-              *ctx.req_context(), value_record, extracted_values_, lobs);
+              *ctx.req_context(), value_record, extracted_value_codec_.fields(), lobs);
           res != status::ok) {
             // error info set by resolve_fields
             return res;
@@ -312,13 +285,13 @@ status primary_target::encode_put(
     }
     std::string_view k{};
     std::string_view v{};
-    if(auto res = do_encode(ctx.key_buf_, extracted_keys_, [&](auto const&) { return key_record; }, k);
+    if(auto res = do_encode(ctx.key_buf_, extracted_key_codec_, [&](auto const&) { return key_record; }, k);
         res != status::ok) {
         handle_encode_errors(*ctx.req_context(), res);
         return res;
     }
     ctx.key_len_ = k.size();
-    if(auto res = do_encode(ctx.value_buf_, extracted_values_, [&](auto const&) { return value_record; }, v);
+    if(auto res = do_encode(ctx.value_buf_, extracted_value_codec_, [&](auto const&) { return value_record; }, v);
         res != status::ok) {
         handle_encode_errors(*ctx.req_context(), res);
         return res;
@@ -331,38 +304,6 @@ status primary_target::encode_put(
     return status::ok;
 }
 
-status primary_target::decode_fields(
-    primary_target::field_mapping_type const& fields,
-    kvs::readable_stream& stream,
-    accessor::record_ref target,
-    memory::lifo_paged_memory_resource* varlen_resource
-) const {
-    for(auto&& f : fields) {
-        kvs::coding_context ctx{};
-        if (f.nullable_) {
-            if(auto res = kvs::decode_nullable(
-                    stream,
-                    f.type_,
-                    f.spec_,
-                    ctx,
-                    target,
-                    f.offset_,
-                    f.nullity_offset_,
-                    varlen_resource
-                ); res != status::ok) {
-                return res;
-            }
-            continue;
-        }
-        if(auto res = kvs::decode(stream, f.type_, f.spec_, ctx, target, f.offset_, varlen_resource); res != status::ok) {
-            return res;
-        }
-        target.set_null(f.nullity_offset_, false); // currently assuming fields are nullable and
-        // f.nullity_offset_ is valid even if f.nullable_ is false
-    }
-    return status::ok;
-}
-
 maybe_shared_ptr<meta::record_meta> const& primary_target::key_meta() const noexcept {
     return key_meta_;
 }
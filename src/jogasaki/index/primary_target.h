@@ -31,6 +31,7 @@
 #include <jogasaki/executor/process/impl/variables_view.h>
 #include <jogasaki/index/field_factory.h>
 #include <jogasaki/index/field_info.h>
+#include <jogasaki/index/record_codec.h>
 #include <jogasaki/index/utils.h>
 #include <jogasaki/kvs/coder.h>
 #include <jogasaki/kvs/storage.h>
@@ -282,17 +283,9 @@ private:
     std::string storage_name_{};
     maybe_shared_ptr<meta::record_meta> key_meta_{};
     maybe_shared_ptr<meta::record_meta> value_meta_{};
-    field_mapping_type input_keys_{};
-    field_mapping_type extracted_keys_{};
-    field_mapping_type extracted_values_{};
-
-
-    status decode_fields(
-        field_mapping_type const& fields,
-        kvs::readable_stream& stream,
-        accessor::record_ref target,
-        memory_resource* varlen_resource
-    ) const;
+    record_codec input_key_codec_{};
+    record_codec extracted_key_codec_{};
+    record_codec extracted_value_codec_{};
 
     /**
      * @brief encode key on `ctx.encoded_key_` and return its view
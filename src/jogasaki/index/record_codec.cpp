@@ -0,0 +1,308 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "record_codec.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <ratio>
+#include <utility>
+#include <glog/logging.h>
+
+#include <takatori/datetime/date.h>
+#include <takatori/datetime/time_of_day.h>
+#include <takatori/util/exception.h>
+#include <takatori/util/stacktrace.h>
+
+#include <jogasaki/constants.h>
+#include <jogasaki/logging.h>
+#include <jogasaki/logging_helper.h>
+#include <jogasaki/meta/field_type_kind.h>
+#include <jogasaki/meta/field_type_traits.h>
+
+namespace jogasaki::index {
+
+using takatori::util::throw_exception;
+using kind = meta::field_type_kind;
+
+namespace {
+
+template<kind Kind>
+runtime_t<Kind> read_value(
+    kvs::readable_stream& src,
+    field_info const& f,
+    bool discard,
+    memory::paged_memory_resource* resource
+) {
+    auto odr = f.spec_.ordering();
+    if constexpr (Kind == kind::decimal) {
+        return src.read<runtime_t<Kind>>(odr, discard, *f.type_.option_unsafe<kind::decimal>());
+    } else if constexpr (Kind == kind::character) {
+        return src.read<runtime_t<Kind>>(odr, discard, resource);
+    } else if constexpr (Kind == kind::octet) {
+        return src.read<runtime_t<Kind>>(odr, discard, *f.type_.option_unsafe<kind::octet>(), resource);
+    } else {
+        (void) resource;
+        return src.read<runtime_t<Kind>>(odr, discard);
+    }
+}
+
+template<kind Kind>
+status write_value(kvs::writable_stream& dest, runtime_t<Kind> value, field_info const& f) {
+    auto odr = f.spec_.ordering();
+    if constexpr (Kind == kind::decimal) {
+        return dest.write<runtime_t<Kind>>(value, odr, *f.type_.option_unsafe<kind::decimal>());
+    } else if constexpr (Kind == kind::character) {
+        return dest.write<runtime_t<Kind>>(value, odr, *f.type_.option_unsafe<kind::character>(), f.spec_.is_key());
+    } else if constexpr (Kind == kind::octet) {
+        return dest.write<runtime_t<Kind>>(value, odr, *f.type_.option_unsafe<kind::octet>(), f.spec_.is_key());
+    } else {
+        return dest.write<runtime_t<Kind>>(value, odr);
+    }
+}
+
+template<kind Kind, bool Nullable, bool Exists>
+status decode_field(
+    field_info const& f,
+    kvs::readable_stream& src,
+    accessor::record_ref target,
+    memory::paged_memory_resource* resource
+) {
+    if constexpr (Nullable) {
+        auto flag = src.read<runtime_t<kind::boolean>>(f.spec_.ordering(), false);
+        if(! (flag == 0 || flag == 1)) {
+            LOG_LP(ERROR) << "unexpected data in nullity bit:" << flag; //NOLINT
+            return status::err_data_corruption;
+        }
+        bool is_null = flag == 0;
+        if constexpr (Exists) {
+            target.set_null(f.nullity_offset_, is_null);
+        }
+        if(is_null) {
+            return status::ok;
+        }
+    }
+    if constexpr (Exists) {
+        target.set_value<runtime_t<Kind>>(f.offset_, read_value<Kind>(src, f, false, resource));
+        if constexpr (! Nullable) {
+            // currently assuming target variable fields are nullable and f.nullity_offset_ is valid
+            // even if f.nullable_ is false
+            target.set_null(f.nullity_offset_, false);
+        }
+    } else {
+        (void) read_value<Kind>(src, f, true, nullptr);
+    }
+    return status::ok;
+}
+
+template<kind Kind, bool Nullable>
+status encode_field(field_info const& f, accessor::const_record_ref src, kvs::writable_stream& dest) {
+    bool is_null = src.is_null(f.nullity_offset_);
+    if constexpr (Nullable) {
+        if(auto res = dest.write<runtime_t<kind::boolean>>(is_null ? 0 : 1, f.spec_.ordering()); res != status::ok) {
+            return res;
+        }
+        if(is_null) {
+            return status::ok;
+        }
+    } else {
+        if(is_null) {
+            VLOG_LP(log_error) << "Null assigned for non-nullable field.";
+            return status::err_integrity_constraint_violation;
+        }
+    }
+    return write_value<Kind>(dest, src.get_value<runtime_t<Kind>>(f.offset_), f);
+}
+
+status unsupported_decode(
+    field_info const&,
+    kvs::readable_stream&,
+    accessor::record_ref,
+    memory::paged_memory_resource*
+) {
+    throw_exception(std::domain_error{"Unsupported types or metadata corruption"});
+}
+
+status unsupported_encode(field_info const&, accessor::const_record_ref, kvs::writable_stream&) {
+    throw_exception(std::domain_error{"Unsupported types or metadata corruption"});
+}
+
+/**
+ * @brief traits for the types encoded as single fixed-width integer or floating point number
+ * @details `encoded_type` is the type read from the stream, and `to_runtime` converts it to the runtime type
+ * in the same way as `kvs::readable_stream::read`
+ */
+template<kind Kind>
+struct fixed_width {
+    using encoded_type = runtime_t<Kind>;
+    static runtime_t<Kind> to_runtime(encoded_type v) noexcept {
+        return v;
+    }
+};
+
+template<>
+struct fixed_width<kind::date> {
+    using encoded_type = std::int64_t;
+    static runtime_t<kind::date> to_runtime(encoded_type v) noexcept {
+        return takatori::datetime::date{v};
+    }
+};
+
+template<>
+struct fixed_width<kind::time_of_day> {
+    using encoded_type = std::int64_t;
+    static runtime_t<kind::time_of_day> to_runtime(encoded_type v) noexcept {
+        return takatori::datetime::time_of_day{std::chrono::duration<std::uint64_t, std::nano>{v}};
+    }
+};
+
+template<kind Kind>
+void decode_fixed_field(field_info const& f, char const* data, accessor::record_ref target) {
+    using encoded_type = typename fixed_width<Kind>::encoded_type;
+    constexpr std::size_t bits = sizeof(encoded_type) * bits_per_byte;
+    if(! f.exists_) {
+        return;
+    }
+    kvs::details::uint_t<bits> d{};
+    std::memcpy(&d, data, sizeof(d));
+    encoded_type value{};
+    kvs::details::key_decode<bits>(value, d, f.spec_.ordering());
+    target.set_value<runtime_t<Kind>>(f.offset_, fixed_width<Kind>::to_runtime(value));
+    target.set_null(f.nullity_offset_, false);
+}
+
+template<kind Kind>
+record_codec::step create_step(field_info const& f) {
+    record_codec::step ret{};
+    if(f.nullable_) {
+        if(f.exists_) {
+            ret.decode_ = decode_field<Kind, true, true>;
+        } else {
+            ret.decode_ = decode_field<Kind, true, false>;
+        }
+        ret.encode_ = encode_field<Kind, true>;
+        return ret;
+    }
+    if(f.exists_) {
+        ret.decode_ = decode_field<Kind, false, true>;
+    } else {
+        ret.decode_ = decode_field<Kind, false, false>;
+    }
+    ret.encode_ = encode_field<Kind, false>;
+    if constexpr (
+        Kind == kind::boolean || Kind == kind::int1 || Kind == kind::int2 || Kind == kind::int4 ||
+        Kind == kind::int8 || Kind == kind::float4 || Kind == kind::float8 || Kind == kind::date ||
+        Kind == kind::time_of_day
+    ) {
+        ret.fixed_decode_ = decode_fixed_field<Kind>;
+        ret.width_ = sizeof(typename fixed_width<Kind>::encoded_type);
+    }
+    return ret;
+}
+
+record_codec::step create_step_for(field_info const& f) {
+    switch(f.type_.kind()) {
+        case kind::boolean: return create_step<kind::boolean>(f);
+        case kind::int1: return create_step<kind::int1>(f);
+        case kind::int2: return create_step<kind::int2>(f);
+        case kind::int4: return create_step<kind::int4>(f);
+        case kind::int8: return create_step<kind::int8>(f);
+        case kind::float4: return create_step<kind::float4>(f);
+        case kind::float8: return create_step<kind::float8>(f);
+        case kind::decimal: return create_step<kind::decimal>(f);
+        case kind::character: return create_step<kind::character>(f);
+        case kind::octet: return create_step<kind::octet>(f);
+        case kind::date: return create_step<kind::date>(f);
+        case kind::time_of_day: return create_step<kind::time_of_day>(f);
+        case kind::time_point: return create_step<kind::time_point>(f);
+        case kind::blob: return create_step<kind::blob>(f);
+        case kind::clob: return create_step<kind::clob>(f);
+        default: break;
+    }
+    // report the error on use, same as kvs::encode/decode
+    return record_codec::step{unsupported_decode, unsupported_encode, nullptr, 0};
+}
+
+}  // namespace
+
+record_codec::record_codec(std::vector<field_info> fields) :
+    fields_(std::move(fields))
+{
+    steps_.reserve(fields_.size());
+    bool prefix = true;
+    for(auto&& f : fields_) {
+        auto& s = steps_.emplace_back(create_step_for(f));
+        if(prefix && s.fixed_decode_ != nullptr) {
+            ++fixed_prefix_count_;
+            fixed_prefix_bytes_ += s.width_;
+            continue;
+        }
+        prefix = false;
+    }
+}
+
+status record_codec::decode(
+    kvs::readable_stream& stream,
+    accessor::record_ref target,
+    memory::paged_memory_resource* resource
+) const {
+    kvs::coding_context ctx{};
+    stream.set_context(ctx);
+    try {
+        std::size_t i = 0;
+        if(fixed_prefix_count_ != 0 && stream.rest().size() >= fixed_prefix_bytes_) {
+            // whole prefix is known to be available, so decode it without checking each field
+            auto const* p = stream.rest().data();
+            for(; i < fixed_prefix_count_; ++i) {
+                auto const& s = steps_[i];
+                s.fixed_decode_(fields_[i], p, target);
+                p += s.width_;  //NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            }
+            stream.skip(fixed_prefix_bytes_);
+        }
+        for(std::size_t n = steps_.size(); i < n; ++i) {
+            if(auto res = steps_[i].decode_(fields_[i], stream, target, resource); res != status::ok) {
+                return res;
+            }
+        }
+    } catch (std::domain_error const& e) {
+        return handle_domain_error(e);
+    }
+    return status::ok;
+}
+
+std::vector<field_info> const& record_codec::fields() const noexcept {
+    return fields_;
+}
+
+std::size_t record_codec::fixed_prefix_count() const noexcept {
+    return fixed_prefix_count_;
+}
+
+std::size_t record_codec::fixed_prefix_bytes() const noexcept {
+    return fixed_prefix_bytes_;
+}
+
+status record_codec::handle_domain_error(std::domain_error const& e) {
+    LOG_LP(ERROR) << "Unexpected data error: " << e.what();
+    if(auto* tr = takatori::util::find_trace(e); tr != nullptr) {
+        LOG_LP(ERROR) << *tr;
+    }
+    return status::err_data_corruption;
+}
+
+}  // namespace jogasaki::index
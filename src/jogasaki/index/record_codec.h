@@ -0,0 +1,151 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <jogasaki/accessor/const_record_ref.h>
+#include <jogasaki/accessor/record_ref.h>
+#include <jogasaki/index/field_info.h>
+#include <jogasaki/kvs/coder.h>
+#include <jogasaki/kvs/coding_context.h>
+#include <jogasaki/kvs/readable_stream.h>
+#include <jogasaki/kvs/writable_stream.h>
+#include <jogasaki/memory/paged_memory_resource.h>
+#include <jogasaki/status.h>
+
+namespace jogasaki::index {
+
+/**
+ * @brief compiled encoder/decoder for the list of index fields
+ * @details the codec resolves the type dispatch of `kvs::encode`/`kvs::decode` once on construction and keeps
+ * a sequence of type-specialized steps, so that encoding or decoding a whole record runs in a single loop
+ * without switching on the field type for each field. The leading fixed-width non-nullable fields (typically the
+ * primary key prefix) are decoded after a single bounds check on the stream.
+ * @note the codec is immutable after construction and can be shared among threads
+ */
+class record_codec {
+public:
+    using decode_fn = status(*)(
+        field_info const&,
+        kvs::readable_stream&,
+        accessor::record_ref,
+        memory::paged_memory_resource*
+    );
+    using encode_fn = status(*)(field_info const&, accessor::const_record_ref, kvs::writable_stream&);
+    using fixed_decode_fn = void(*)(field_info const&, char const*, accessor::record_ref);
+
+    /**
+     * @brief type-specialized step for a field
+     */
+    struct step {
+        decode_fn decode_{};  //NOLINT
+        encode_fn encode_{};  //NOLINT
+        fixed_decode_fn fixed_decode_{};  //NOLINT
+        std::size_t width_{};  //NOLINT
+    };
+
+    /**
+     * @brief create empty object
+     */
+    record_codec() = default;
+
+    /**
+     * @brief create new object
+     * @param fields the fields encoded/decoded by this codec, in the order on the stream
+     */
+    explicit record_codec(std::vector<field_info> fields);
+
+    /**
+     * @brief decode fields
+     * @param stream input stream to decode
+     * @param target target record
+     * @param resource memory resource for decoding variable length data
+     * @return status::ok when successful
+     * @return status::err_data_corruption if decoded data is not valid
+     * @return any error otherwise
+     */
+    [[nodiscard]] status decode(
+        kvs::readable_stream& stream,
+        accessor::record_ref target,
+        memory::paged_memory_resource* resource
+    ) const;
+
+    /**
+     * @brief encode fields taken from the source record
+     * @param source the source record
+     * @param dest the stream to write the encoded data
+     * @return status::ok when successful
+     * @return status::err_integrity_constraint_violation if null is assigned to non-nullable field
+     * @return any error otherwise
+     */
+    [[nodiscard]] status encode(accessor::const_record_ref source, kvs::writable_stream& dest) const {
+        return encode(dest, [&](field_info const&) { return source; });
+    }
+
+    /**
+     * @brief encode fields taken from the records given by `get_source`
+     * @param dest the stream to write the encoded data
+     * @param get_source callable taking field_info const& and returning the record that holds the field
+     * @return status::ok when successful
+     * @return status::err_integrity_constraint_violation if null is assigned to non-nullable field
+     * @return any error otherwise
+     */
+    template<class SourceFn>
+    [[nodiscard]] status encode(kvs::writable_stream& dest, SourceFn const& get_source) const {
+        kvs::coding_context ctx{};
+        ctx.coding_for_write(true);
+        dest.set_context(ctx);
+        try {
+            for(std::size_t i = 0, n = steps_.size(); i < n; ++i) {
+                auto const& f = fields_[i];
+                if(auto res = steps_[i].encode_(f, get_source(f), dest); res != status::ok) {
+                    return res;
+                }
+            }
+        } catch (std::domain_error const& e) {
+            return handle_domain_error(e);
+        }
+        return status::ok;
+    }
+
+    /**
+     * @brief accessor to the fields
+     */
+    [[nodiscard]] std::vector<field_info> const& fields() const noexcept;
+
+    /**
+     * @brief returns the number of leading fields decoded by the fixed-width fast path
+     */
+    [[nodiscard]] std::size_t fixed_prefix_count() const noexcept;
+
+    /**
+     * @brief returns the encoded byte length of the leading fields decoded by the fixed-width fast path
+     */
+    [[nodiscard]] std::size_t fixed_prefix_bytes() const noexcept;
+
+private:
+    std::vector<field_info> fields_{};
+    std::vector<step> steps_{};
+    std::size_t fixed_prefix_count_{};
+    std::size_t fixed_prefix_bytes_{};
+
+    static status handle_domain_error(std::domain_error const& e);
+};
+
+}  // namespace jogasaki::index
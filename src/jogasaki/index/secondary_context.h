@@ -55,6 +55,7 @@ public:
 private:
     std::unique_ptr<kvs::storage> stg_{};
     data::aligned_buffer encoded_secondary_key_{};
+    data::aligned_buffer encoded_secondary_value_{};
     request_context* rctx_{};
 };
 
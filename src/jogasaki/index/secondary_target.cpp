@@ -16,6 +16,7 @@
 #include "secondary_target.h"
 
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <type_traits>
 #include <vector>
@@ -60,10 +61,36 @@ status secondary_target::create_secondary_key(
     std::string_view encoded_primary_key,
     std::string_view& out
 ) const {
+    return encode_fields(ctx, buf, secondary_key_fields_, primary_key, primary_value, encoded_primary_key, out);
+}
+
+status secondary_target::create_secondary_value(
+    secondary_context& ctx,
+    data::aligned_buffer& buf,
+    accessor::record_ref primary_key,
+    accessor::record_ref primary_value,
+    std::string_view& out
+) const {
+    if(secondary_value_fields_.empty()) {
+        out = {};
+        return status::ok;
+    }
+    return encode_fields(ctx, buf, secondary_value_fields_, primary_key, primary_value, {}, out);
+}
+
+status secondary_target::encode_fields(
+    secondary_context& ctx,
+    data::aligned_buffer& buf,
+    field_mapping_type const& fields,
+    accessor::record_ref primary_key,
+    accessor::record_ref primary_value,
+    std::string_view suffix,
+    std::string_view& out
+) {
     std::size_t length{};
     for(int loop = 0; loop < 2; ++loop) { // if first trial overflows `buf`, extend it and retry
         kvs::writable_stream s{buf.data(), buf.capacity(), loop == 0};
-        for(auto&& f : secondary_key_fields_) {
+        for(auto&& f : fields) {
             auto src = f.key_ ? primary_key : primary_value;
             kvs::coding_context cctx{};
             cctx.coding_for_write(true);
@@ -80,7 +107,7 @@ status secondary_target::create_secondary_key(
                 }
             }
         }
-        if (auto res = s.write(encoded_primary_key.data(), encoded_primary_key.size()); res != status::ok) {
+        if (auto res = s.write(suffix.data(), suffix.size()); res != status::ok) {
             handle_encode_errors(*ctx.req_context(), res);
             return res;
         }
@@ -109,7 +136,12 @@ status secondary_target::encode_put(
     if(auto res = encode_secondary_key(ctx, primary_key, primary_value, encoded_primary_key, k); res != status::ok) {
         return res;
     }
-    if(auto res = ctx.stg_->content_put(*tx.object(), k, {}, kvs::put_option::create_or_update); res != status::ok) {
+    std::string_view v{};
+    if(auto res = create_secondary_value(ctx, ctx.encoded_secondary_value_, primary_key, primary_value, v);
+        res != status::ok) {
+        return res;
+    }
+    if(auto res = ctx.stg_->content_put(*tx.object(), k, v, kvs::put_option::create_or_update); res != status::ok) {
         handle_kvs_errors(*ctx.req_context(), res);
         handle_generic_error(*ctx.req_context(), res, error_code::sql_execution_exception);
         return res;
@@ -144,6 +176,41 @@ status secondary_target::encode_remove(
     return remove_by_encoded_key(ctx, tx, k);
 }
 
+// find the column in the primary index and create the field reading it from primary key/value record
+static std::optional<secondary_key_field> create_source_field(
+    yugawara::storage::index const& primary,
+    yugawara::storage::column const& column,
+    kvs::coding_spec spec,
+    maybe_shared_ptr<meta::record_meta> const& primary_key_meta,
+    maybe_shared_ptr<meta::record_meta> const& primary_value_meta
+) {
+    for(std::size_t i=0, n=primary.keys().size(); i<n; ++i) {
+        if(primary.keys().at(i).column() == column) {
+            return secondary_key_field{
+                primary_key_meta->at(i),
+                primary_key_meta->value_offset(i),
+                primary_key_meta->nullity_offset(i),
+                column.criteria().nullity().nullable(),
+                spec,
+                true
+            };
+        }
+    }
+    for(std::size_t i=0, n=primary.values().size(); i<n; ++i) {
+        if(primary.values().at(i) == column) {
+            return secondary_key_field{
+                primary_value_meta->at(i),
+                primary_value_meta->value_offset(i),
+                primary_value_meta->nullity_offset(i),
+                column.criteria().nullity().nullable(),
+                spec,
+                false
+            };
+        }
+    }
+    return {};
+}
+
 secondary_target::field_mapping_type secondary_target::create_fields(
     yugawara::storage::index const& idx,
     maybe_shared_ptr<meta::record_meta> const& primary_key_meta,
@@ -153,44 +220,32 @@ secondary_target::field_mapping_type secondary_target::create_fields(
     auto primary = table.owner()->find_primary_index(table);
     if(!(primary != nullptr)) throw_exception(std::logic_error{""});
     secondary_target::field_mapping_type ret{};
-    ret.reserve(table.columns().size());
+    ret.reserve(idx.keys().size());
     for(auto&& k : idx.keys()) {
-        bool found = false;
-        for(std::size_t i=0, n=primary->keys().size(); i<n; ++i) {
-            if(primary->keys().at(i) == k) {
-                auto spec = k.direction() == takatori::relation::sort_direction::ascendant ?
-                    kvs::spec_key_ascending : kvs::spec_key_descending;
-                ret.emplace_back(
-                    primary_key_meta->at(i),
-                    primary_key_meta->value_offset(i),
-                    primary_key_meta->nullity_offset(i),
-                    k.column().criteria().nullity().nullable(),
-                    spec,
-                    true
-                );
-                found = true;
-                break;
-            }
-        }
-        if(found) continue;
-        for(std::size_t i=0, n=primary->values().size(); i<n; ++i) {
-            if(primary->values().at(i) == k.column()) {
-                auto spec = k.direction() == takatori::relation::sort_direction::ascendant ?
-                    kvs::spec_key_ascending : kvs::spec_key_descending;
-                ret.emplace_back(
-                    primary_value_meta->at(i),
-                    primary_value_meta->value_offset(i),
-                    primary_value_meta->nullity_offset(i),
-                    k.column().criteria().nullity().nullable(),
-                    spec,
-                    false
-                );
-                found = true;
-                break;
-            }
-        }
-        if(found) continue;
-        throw_exception(std::logic_error{""});
+        auto spec = k.direction() == takatori::relation::sort_direction::ascendant ?
+            kvs::spec_key_ascending : kvs::spec_key_descending;
+        auto f = create_source_field(*primary, k.column(), spec, primary_key_meta, primary_value_meta);
+        if(! f) throw_exception(std::logic_error{""});
+        ret.emplace_back(std::move(*f));
+    }
+    return ret;
+}
+
+secondary_target::field_mapping_type secondary_target::create_value_fields(
+    yugawara::storage::index const& idx,
+    maybe_shared_ptr<meta::record_meta> const& primary_key_meta,
+    maybe_shared_ptr<meta::record_meta> const& primary_value_meta
+) {
+    auto& table = idx.table();
+    auto primary = table.owner()->find_primary_index(table);
+    if(!(primary != nullptr)) throw_exception(std::logic_error{""});
+    secondary_target::field_mapping_type ret{};
+    ret.reserve(idx.values().size());
+    for(auto&& v : idx.values()) {
+        auto& c = static_cast<yugawara::storage::column const&>(v);
+        auto f = create_source_field(*primary, c, kvs::spec_value, primary_key_meta, primary_value_meta);
+        if(! f) throw_exception(std::logic_error{""});
+        ret.emplace_back(std::move(*f));
     }
     return ret;
 }
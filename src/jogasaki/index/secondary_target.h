@@ -88,6 +88,8 @@ struct cache_align secondary_key_field : index::field_info {
  * This object has the following record definition and each is represented with a field mapping.
  * - primary index key/value records
  *   - the source columns of the primary index key/value to generate secondary index key
+ *   - the source columns of the primary index key/value stored in the secondary index value (i.e. the columns
+ *     covered by the secondary index, if any)
  * This object has common static information and dynamically changing parts are separated as secondary_context.
  */
 class secondary_target {
@@ -110,13 +112,16 @@ public:
      * @brief create new object
      * @param storage_name the primary storage name to write
      * @param secondary_key_fields the secondary key fields
+     * @param secondary_value_fields the fields stored in the secondary index value
      */
     secondary_target(
         std::string_view storage_name,
-        field_mapping_type secondary_key_fields
+        field_mapping_type secondary_key_fields,
+        field_mapping_type secondary_value_fields = {}
     ) :
         storage_name_(storage_name),
-        secondary_key_fields_(std::move(secondary_key_fields))
+        secondary_key_fields_(std::move(secondary_key_fields)),
+        secondary_value_fields_(std::move(secondary_value_fields))
     {}
 
     ~secondary_target() = default;
@@ -138,7 +143,8 @@ public:
     ) :
         secondary_target(
             idx.simple_name(),
-            create_fields(idx, primary_key_meta, primary_value_meta)
+            create_fields(idx, primary_key_meta, primary_value_meta),
+            create_value_fields(idx, primary_key_meta, primary_value_meta)
         )
     {}
 
@@ -203,6 +209,22 @@ public:
         std::string_view& out
     ) const;
 
+    /**
+     * @brief encode secondary value
+     * @details this is used to generate secondary index value, which consists of the columns covered by
+     * the secondary index, from primary index key/value
+     * @param out [out] the encoded value, or empty if the index covers no column
+     * @returns status::ok when successful
+     * @returns any other error otherwise
+     */
+    status create_secondary_value(
+        secondary_context& ctx,
+        data::aligned_buffer& buf,
+        accessor::record_ref primary_key,
+        accessor::record_ref primary_value,
+        std::string_view& out
+    ) const;
+
     /**
      * @brief remove secondary index entry by given encoded key
      * @details this is used to remove secondary index entry by given encoded key
@@ -217,13 +239,27 @@ public:
 private:
     std::string storage_name_{};
     field_mapping_type secondary_key_fields_{};
-
+    field_mapping_type secondary_value_fields_{};
 
     field_mapping_type create_fields(
         yugawara::storage::index const& idx,
         maybe_shared_ptr<meta::record_meta> const& primary_key_meta, //NOLINT
         maybe_shared_ptr<meta::record_meta> const& primary_value_meta //NOLINT
     );
+    field_mapping_type create_value_fields(
+        yugawara::storage::index const& idx,
+        maybe_shared_ptr<meta::record_meta> const& primary_key_meta, //NOLINT
+        maybe_shared_ptr<meta::record_meta> const& primary_value_meta //NOLINT
+    );
+    static status encode_fields(
+        secondary_context& ctx,
+        data::aligned_buffer& buf,
+        field_mapping_type const& fields,
+        accessor::record_ref primary_key,
+        accessor::record_ref primary_value,
+        std::string_view suffix,
+        std::string_view& out
+    );
     status encode_secondary_key(
         secondary_context& ctx,
         accessor::record_ref primary_key,
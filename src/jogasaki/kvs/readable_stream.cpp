@@ -55,6 +55,13 @@ std::string_view readable_stream::rest() const noexcept {
     return {base_+pos_, capacity_-pos_};  //NOLINT
 }
 
+void readable_stream::skip(std::size_t len) {
+    if(!(pos_ + len <= capacity_)) throw_exception(std::domain_error{ //NOLINT
+        string_builder{} << base_filename() << " condition pos_ + len <= capacity_ failed with pos_:" << pos_ << " len:" << len << " capacity_:" << capacity_ << string_builder::to_string //NOLINT
+    });
+    pos_ += len;
+}
+
 constexpr std::size_t max_decimal_coefficient_size = sizeof(std::uint64_t) * 2 + 1;
 
 static std::string_view process_order_and_msb(
@@ -317,6 +317,13 @@ public:
      */
     [[nodiscard]] std::string_view rest() const noexcept;
 
+    /**
+     * @brief advance the current position without decoding
+     * @param len the number of bytes to skip
+     * @throws std::domain_error if the stream doesn't have `len` bytes remaining
+     */
+    void skip(std::size_t len);
+
     /**
      * @brief coding context setter
      * @details context information during read is stored in the context
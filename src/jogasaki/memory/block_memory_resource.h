@@ -83,6 +83,7 @@ public:
     ~block_memory_resource() override {
         for (auto iter = blocks_.begin(); iter != blocks_.end(); ++iter) {
             page_pool_->release_page(iter->first);
+            discharge(page_size);
         }
     }
 
@@ -125,7 +126,12 @@ protected:
         }
 
         // acquire a new page
+        charge(page_size);
         auto next_head = page_pool_->acquire_page();
+        if (! next_head) {
+            discharge(page_size);
+            throw_exception(std::bad_alloc());
+        }
         auto [iter, success] = blocks_.emplace(next_head, block_info { next_head });
         if (!success) {
             LOG_LP(ERROR) << "invalid memory request bytes:" << bytes << " alignment:" << alignment;
@@ -190,6 +196,7 @@ protected:
             }
             // otherwise, gives back the acquired page
             page_pool_->release_page(block.head());
+            discharge(page_size);
             if (std::addressof(block) == active_) {
                 active_ = nullptr;
             }
@@ -35,6 +35,7 @@ using takatori::util::throw_exception;
 fifo_paged_memory_resource::~fifo_paged_memory_resource() {
     for (const auto& p : pages_) {
         page_pool_->release_page(p.head());
+        discharge(page_size);
     }
 }
 
@@ -65,11 +66,13 @@ void fifo_paged_memory_resource::deallocate_before(fifo_paged_memory_resource::c
             page.lower_bound_offset(point.offset_);
             if (page.empty()) {
                 page_pool_->release_page(page.head());
+                discharge(page_size);
                 pages_.pop_front();
             }
             break;
         }
         page_pool_->release_page(page.head());
+        discharge(page_size);
         pages_.pop_front();
     }
 }
@@ -116,6 +119,7 @@ void fifo_paged_memory_resource::do_deallocate(void *p, std::size_t bytes, std::
     // release if the page is empty
     if (last.empty()) {
         page_pool_->release_page(last.head());
+        discharge(page_size);
         pages_.pop_front();
     }
 }
@@ -132,8 +136,10 @@ std::size_t fifo_paged_memory_resource::do_page_remaining(std::size_t alignment)
 }
 
 details::page_allocation_info &fifo_paged_memory_resource::acquire_new_page() {
+    charge(page_size);
     page_pool::page_info new_page = page_pool_->acquire_page();
     if (!new_page) {
+        discharge(page_size);
         throw_exception(std::bad_alloc());
     }
     return pages_.emplace_back(new_page);
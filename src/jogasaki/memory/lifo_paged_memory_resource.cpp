@@ -38,6 +38,7 @@ lifo_paged_memory_resource::~lifo_paged_memory_resource() {
     }
     if (reserved_page_) {
         page_pool_->release_page(reserved_page_);
+        discharge(page_size);
         reserved_page_ = page_pool::page_info();
     }
 }
@@ -146,8 +147,10 @@ details::page_allocation_info &lifo_paged_memory_resource::acquire_new_page() {
         new_page = reserved_page_;
         reserved_page_ = page_pool::page_info();
     } else {
+        charge(page_size);
         new_page = page_pool_->acquire_page();
         if (!new_page) {
+            discharge(page_size);
             throw_exception(std::bad_alloc());
         }
     }
@@ -157,6 +160,7 @@ details::page_allocation_info &lifo_paged_memory_resource::acquire_new_page() {
 void lifo_paged_memory_resource::release_deallocated_page(page_pool::page_info deallocated_page) {
     if (reserved_page_) {
         page_pool_->release_page(reserved_page_);
+        discharge(page_size);
     }
     reserved_page_ = deallocated_page;
 }
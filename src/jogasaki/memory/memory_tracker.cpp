@@ -0,0 +1,135 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "memory_tracker.h"
+
+#include <utility>
+
+#include <jogasaki/executor/global.h>
+
+namespace jogasaki::memory {
+
+namespace {
+
+thread_local std::shared_ptr<memory_tracker> current_tracker_{};  //NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace
+
+memory_tracker::memory_tracker(std::shared_ptr<memory_tracker> parent, std::size_t limit) noexcept :
+    parent_(std::move(parent)),
+    limit_(limit)
+{}
+
+bool memory_tracker::try_consume(std::size_t bytes) noexcept {
+    for(auto* t = this; t != nullptr; t = t->parent()) {
+        if(! t->consume_local(bytes, true)) {
+            // roll back the descendants already charged
+            for(auto* r = this; r != t; r = r->parent()) {
+                r->consumed_.fetch_sub(bytes);
+            }
+            return false;
+        }
+    }
+    return true;
+}
+
+void memory_tracker::consume(std::size_t bytes) noexcept {
+    for(auto* t = this; t != nullptr; t = t->parent()) {
+        (void) t->consume_local(bytes, false);
+    }
+}
+
+void memory_tracker::release(std::size_t bytes) noexcept {
+    for(auto* t = this; t != nullptr; t = t->parent()) {
+        t->consumed_.fetch_sub(bytes);
+    }
+}
+
+std::size_t memory_tracker::consumed() const noexcept {
+    return consumed_.load();
+}
+
+std::size_t memory_tracker::peak() const noexcept {
+    return peak_.load();
+}
+
+std::size_t memory_tracker::limit() const noexcept {
+    return limit_.load();
+}
+
+void memory_tracker::limit(std::size_t arg) noexcept {
+    limit_.store(arg);
+}
+
+bool memory_tracker::reaches(std::size_t percentage) const noexcept {
+    auto lim = limit_.load();
+    if(lim == unlimited) {
+        return false;
+    }
+    return consumed_.load() * 100 >= lim * percentage;
+}
+
+bool memory_tracker::reaches_with_ancestors(std::size_t percentage) const noexcept {
+    for(auto const* t = this; t != nullptr; t = t->parent()) {
+        if(t->reaches(percentage)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+memory_tracker* memory_tracker::parent() const noexcept {
+    return parent_.get();
+}
+
+bool memory_tracker::consume_local(std::size_t bytes, bool check_limit) noexcept {
+    auto current = consumed_.fetch_add(bytes) + bytes;
+    if(check_limit) {
+        if(auto lim = limit_.load(); lim != unlimited && current > lim) {
+            consumed_.fetch_sub(bytes);
+            return false;
+        }
+    }
+    update_peak(current);
+    return true;
+}
+
+void memory_tracker::update_peak(std::size_t current) noexcept {
+    auto peak = peak_.load();
+    while(peak < current && ! peak_.compare_exchange_weak(peak, current)) {}
+}
+
+std::shared_ptr<memory_tracker> const& current_memory_tracker() noexcept {
+    if(current_tracker_) {
+        return current_tracker_;
+    }
+    return global::memory_tracker();
+}
+
+memory_tracker_scope::memory_tracker_scope(std::shared_ptr<memory_tracker> tracker) noexcept :
+    active_(static_cast<bool>(tracker))
+{
+    if(active_) {
+        previous_ = std::exchange(current_tracker_, std::move(tracker));
+    }
+}
+
+memory_tracker_scope::~memory_tracker_scope() {
+    if(active_) {
+        current_tracker_ = std::move(previous_);
+    }
+}
+
+}  // namespace jogasaki::memory
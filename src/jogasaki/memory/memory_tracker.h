@@ -0,0 +1,168 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+
+#include <jogasaki/utils/interference_size.h>
+
+namespace jogasaki::memory {
+
+/**
+ * @brief hierarchical memory usage tracker
+ * @details the tracker counts the bytes of pages held by paged_memory_resources. Trackers form a tree
+ * (global -> job -> resource) and the consumption charged to a tracker is propagated to all its ancestors.
+ * Each tracker can have a limit, and the charge fails if it exceeds the limit of the tracker or any ancestor.
+ * @note this object is thread-safe
+ */
+class cache_align memory_tracker {
+public:
+    /**
+     * @brief the limit value indicating the consumption is not limited
+     */
+    constexpr static std::size_t unlimited = 0;
+
+    /**
+     * @brief create root tracker without limit
+     */
+    memory_tracker() = default;
+
+    /**
+     * @brief create new object
+     * @param parent the parent tracker to propagate the consumption (nullptr if this is the root)
+     * @param limit the max bytes to be consumed under this tracker (`unlimited` if there is no limit)
+     */
+    explicit memory_tracker(std::shared_ptr<memory_tracker> parent, std::size_t limit = unlimited) noexcept;
+
+    ~memory_tracker() = default;
+    memory_tracker(memory_tracker const& other) = delete;
+    memory_tracker& operator=(memory_tracker const& other) = delete;
+    memory_tracker(memory_tracker&& other) noexcept = delete;
+    memory_tracker& operator=(memory_tracker&& other) noexcept = delete;
+
+    /**
+     * @brief charge the consumption if it doesn't exceed the limit of this or ancestor trackers
+     * @param bytes the bytes to consume
+     * @return true if successful
+     * @return false if a limit is exceeded - nothing is charged in this case
+     */
+    [[nodiscard]] bool try_consume(std::size_t bytes) noexcept;
+
+    /**
+     * @brief charge the consumption regardless of the limit
+     * @param bytes the bytes to consume
+     */
+    void consume(std::size_t bytes) noexcept;
+
+    /**
+     * @brief return the consumption charged before
+     * @param bytes the bytes to release
+     */
+    void release(std::size_t bytes) noexcept;
+
+    /**
+     * @brief accessor to the bytes currently consumed under this tracker
+     */
+    [[nodiscard]] std::size_t consumed() const noexcept;
+
+    /**
+     * @brief accessor to the peak of the consumed bytes
+     */
+    [[nodiscard]] std::size_t peak() const noexcept;
+
+    /**
+     * @brief accessor to the limit
+     * @return `unlimited` if the consumption is not limited
+     */
+    [[nodiscard]] std::size_t limit() const noexcept;
+
+    /**
+     * @brief setter of the limit
+     */
+    void limit(std::size_t arg) noexcept;
+
+    /**
+     * @brief return whether the consumption reaches the given percentage of the limit
+     * @param percentage the percentage of the limit
+     * @return false if the consumption is not limited
+     */
+    [[nodiscard]] bool reaches(std::size_t percentage) const noexcept;
+
+    /**
+     * @brief return whether the consumption of this tracker or any ancestor reaches the given percentage of its limit
+     * @param percentage the percentage of the limit
+     * @return false if none of the trackers is limited
+     */
+    [[nodiscard]] bool reaches_with_ancestors(std::size_t percentage) const noexcept;
+
+    /**
+     * @brief accessor to the parent tracker
+     * @return nullptr if this is the root
+     */
+    [[nodiscard]] memory_tracker* parent() const noexcept;
+
+private:
+    std::shared_ptr<memory_tracker> parent_{};
+    std::atomic_size_t limit_{unlimited};
+    cache_align std::atomic_size_t consumed_{};
+    std::atomic_size_t peak_{};
+
+    bool consume_local(std::size_t bytes, bool check_limit) noexcept;
+    void update_peak(std::size_t current) noexcept;
+};
+
+/**
+ * @brief exception thrown when page allocation is rejected by the memory tracker
+ */
+class memory_limit_exceeded : public std::bad_alloc {
+public:
+    [[nodiscard]] char const* what() const noexcept override {
+        return "memory usage exceeds the limit";
+    }
+};
+
+/**
+ * @brief accessor to the tracker charged by the paged_memory_resources created on the current thread
+ * @return the tracker set by the innermost memory_tracker_scope, or the global tracker if there is none
+ */
+[[nodiscard]] std::shared_ptr<memory_tracker> const& current_memory_tracker() noexcept;
+
+/**
+ * @brief RAII object to set the current memory tracker of the current thread
+ */
+class memory_tracker_scope {
+public:
+    /**
+     * @brief set the current tracker until this object is destructed
+     * @param tracker the tracker to set (nullptr makes this scope no-op)
+     */
+    explicit memory_tracker_scope(std::shared_ptr<memory_tracker> tracker) noexcept;
+
+    ~memory_tracker_scope();
+    memory_tracker_scope(memory_tracker_scope const& other) = delete;
+    memory_tracker_scope& operator=(memory_tracker_scope const& other) = delete;
+    memory_tracker_scope(memory_tracker_scope&& other) noexcept = delete;
+    memory_tracker_scope& operator=(memory_tracker_scope&& other) noexcept = delete;
+
+private:
+    std::shared_ptr<memory_tracker> previous_{};
+    bool active_{};
+};
+
+}  // namespace jogasaki::memory
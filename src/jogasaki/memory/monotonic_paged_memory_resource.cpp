@@ -34,6 +34,7 @@ using takatori::util::throw_exception;
 monotonic_paged_memory_resource::~monotonic_paged_memory_resource() {
     for (const auto& p : pages_) {
         page_pool_->release_page(p.head());
+        discharge(page_size);
     }
 }
 
@@ -89,8 +90,10 @@ std::size_t monotonic_paged_memory_resource::do_page_remaining(std::size_t align
 }
 
 details::page_allocation_info &monotonic_paged_memory_resource::acquire_new_page() {
+    charge(page_size);
     page_pool::page_info new_page = page_pool_->acquire_page();
     if (!new_page) {
+        discharge(page_size);
         throw_exception(std::bad_alloc());
     }
     return pages_.emplace_back(new_page);
@@ -15,8 +15,15 @@
  */
 #pragma once
 
+#include <cstddef>
+#include <memory>
+#include <utility>
 #include <boost/container/pmr/memory_resource.hpp>
 
+#include <takatori/util/exception.h>
+
+#include "memory_tracker.h"
+
 namespace jogasaki::memory {
 
 /**
@@ -31,6 +38,8 @@ namespace jogasaki::memory {
  * Subclasses are required to implement so that allocate(m) is successful as long as m is equal or less than page_size.
  * This interface doesn't assume any allocation/de-allocation patterns by the caller, so subclasses can implement
  * optimized logic specific to their purpose based on access patterns such as FIFO/LIFO.
+ * The pages held by the resource are charged to the memory tracker, which is the current memory tracker
+ * (see memory_tracker_scope) of the thread constructing the resource unless it's changed by tracker(arg).
  */
 class paged_memory_resource : public boost::container::pmr::memory_resource {
 public:
@@ -58,13 +67,65 @@ public:
      */
     virtual void end_current_page() = 0;
 
+    /**
+     * @brief change the memory tracker charged by this resource
+     * @details the bytes of the pages currently held by this resource are moved to the new tracker
+     * @param arg the new tracker
+     */
+    void tracker(std::shared_ptr<memory_tracker> arg) noexcept {
+        if(! arg || arg == tracker_) {
+            return;
+        }
+        arg->consume(charged_bytes_);
+        tracker_->release(charged_bytes_);
+        tracker_ = std::move(arg);
+    }
+
+    /**
+     * @brief accessor to the memory tracker charged by this resource
+     */
+    [[nodiscard]] std::shared_ptr<memory_tracker> const& tracker() const noexcept {
+        return tracker_;
+    }
+
+    /**
+     * @brief accessor to the bytes of the pages currently held by this resource
+     */
+    [[nodiscard]] std::size_t charged_bytes() const noexcept {
+        return charged_bytes_;
+    }
+
 protected:
+    /**
+     * @brief charge the page bytes to the memory tracker
+     * @details subclasses should call this before acquiring page from the page pool
+     * @throws memory_limit_exceeded if the charge exceeds the limit of the tracker
+     */
+    void charge(std::size_t bytes) {
+        if(! tracker_->try_consume(bytes)) {
+            takatori::util::throw_exception(memory_limit_exceeded{});
+        }
+        charged_bytes_ += bytes;
+    }
+
+    /**
+     * @brief return the page bytes to the memory tracker
+     * @details subclasses should call this when the page is released to the page pool
+     */
+    void discharge(std::size_t bytes) noexcept {
+        tracker_->release(bytes);
+        charged_bytes_ -= bytes;
+    }
+
     /**
      * @brief subclass implementation of page_remaining
      * @see page_remaining()
      */
     [[nodiscard]] virtual std::size_t do_page_remaining(std::size_t alignment) const noexcept = 0;
 
+private:
+    std::shared_ptr<memory_tracker> tracker_{current_memory_tracker()};
+    std::size_t charged_bytes_{};
 };
 
 } // namespace jogasaki::memory
@@ -17,6 +17,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <ostream>
 
 namespace jogasaki::model {
@@ -72,7 +73,7 @@ enum class task_result : std::size_t {
 
     /**
      * @brief sleep and detach thread from this task, the task needs wake-up to resume
-     * @attention this is future functionality and not yet supported
+     * @details the task is rescheduled when the condition returned by task::release_wake_up_condition() is met
      */
     sleep,
 
@@ -211,6 +212,16 @@ public:
      */
     [[nodiscard]] virtual task_transaction_kind transaction_capability() = 0;
 
+    /**
+     * @brief detach and return the condition to wake up the task
+     * @details this is called when the task body returns task_result::sleep. The task is rescheduled when the
+     * returned condition becomes true.
+     * @return the condition, or empty if the task should be rescheduled immediately
+     */
+    [[nodiscard]] virtual std::function<bool()> release_wake_up_condition() {
+        return {};
+    }
+
 protected:
     virtual std::ostream& write_to(std::ostream& out) const = 0;
 
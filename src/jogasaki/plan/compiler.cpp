@@ -15,9 +15,12 @@
  */
 #include "compiler.h"
 
+#include <algorithm>
 #include <any>
 #include <cstdint>
 #include <cstdlib>
+#include <iterator>
+#include <memory>
 #include <optional>
 #include <sstream>
 #include <stdexcept>
@@ -37,6 +40,7 @@
 #include <takatori/document/region.h>
 #include <takatori/graph/graph.h>
 #include <takatori/plan/aggregate.h>
+#include <takatori/plan/broadcast.h>
 #include <takatori/plan/forward.h>
 #include <takatori/plan/graph.h>
 #include <takatori/plan/group.h>
@@ -117,6 +121,8 @@
 #include <jogasaki/executor/compare_info.h>
 #include <jogasaki/executor/exchange/aggregate/aggregate_info.h>
 #include <jogasaki/executor/exchange/aggregate/step.h>
+#include <jogasaki/executor/exchange/broadcast/broadcast_info.h>
+#include <jogasaki/executor/exchange/broadcast/step.h>
 #include <jogasaki/executor/exchange/forward/step.h>
 #include <jogasaki/executor/exchange/group/group_info.h>
 #include <jogasaki/executor/exchange/group/step.h>
@@ -137,6 +143,7 @@
 #include <jogasaki/model/statement.h>
 #include <jogasaki/model/step_kind.h>
 #include <jogasaki/plan/compiler_context.h>
+#include <jogasaki/plan/execute_template.h>
 #include <jogasaki/plan/parameter_set.h>
 #include <jogasaki/plan/plan_exception.h>
 #include <jogasaki/plan/prepared_statement.h>
@@ -289,14 +296,19 @@ void preprocess(
                     auth::action_set{auth::action_kind::select}
                 );
                 break;
-            case takatori::relation::expression_kind::join_find:
-                add_table_to_storage_list(
-                    unsafe_downcast<takatori::relation::join_find>(op).source(),
-                    container,
-                    auth::action_set{auth::action_kind::select}
-                );
+            case takatori::relation::expression_kind::join_find: {
+                auto& source = unsafe_downcast<takatori::relation::join_find>(op).source();
+                if(! yugawara::binding::extract_if<takatori::plan::exchange>(source)) {
+                    // join_find from broadcast exchange doesn't access storage
+                    add_table_to_storage_list(
+                        source,
+                        container,
+                        auth::action_set{auth::action_kind::select}
+                    );
+                }
                 container->work_level().set_minimum(statement_work_level_kind::join);
                 break;
+            }
             case takatori::relation::expression_kind::join_group: //fall-thru
             case takatori::relation::expression_kind::take_group: //fall-thru
             case takatori::relation::expression_kind::take_cogroup: //fall-thru
@@ -346,6 +358,9 @@ std::pair<status, std::shared_ptr<mirror_container>> preprocess_mirror(
                             // TODO check if UDF is not used
                             container->work_level().set_minimum(statement_work_level_kind::aggregate);
                             break;
+                        case takatori::plan::step_kind::broadcast:
+                            container->work_level().set_minimum(statement_work_level_kind::join);
+                            break;
                         case takatori::plan::step_kind::forward:
                             // TODO check if UDF is not used
                             container->work_level().set_minimum(statement_work_level_kind::simple_multirecord_operation);
@@ -689,7 +704,6 @@ static status prepare(
 
     yugawara::runtime_feature_set runtime_features {
         //TODO enable features
-//        yugawara::runtime_feature::broadcast_exchange,
         yugawara::runtime_feature::aggregate_exchange,
 //        yugawara::runtime_feature::broadcast_join_scan,
         yugawara::runtime_feature::always_inline_scalar_local_variables,
@@ -701,6 +715,9 @@ static status prepare(
     if(cfg && cfg->enable_join_scan()) {
         runtime_features.insert(yugawara::runtime_feature::index_join_scan);
     }
+    if(cfg && cfg->enable_broadcast_join()) {
+        runtime_features.insert(yugawara::runtime_feature::broadcast_exchange);
+    }
     std::shared_ptr<yugawara::analyzer::index_estimator> indices{};
     auto sp = std::make_shared<storage_processor>();
     yugawara::compiler_options c_options{
@@ -718,7 +735,6 @@ static status prepare(
             yugawara::restricted_feature::relation_identify,
             yugawara::restricted_feature::relation_difference,
             yugawara::restricted_feature::relation_intersection,
-            yugawara::restricted_feature::exchange_broadcast,
             yugawara::restricted_feature::exchange_discard,
             yugawara::restricted_feature::statement_write_delete,
             yugawara::restricted_feature::statement_write_update,
@@ -726,6 +742,11 @@ static status prepare(
             yugawara::restricted_feature::statement_rename_index,
             yugawara::restricted_feature::statement_rename_table,
         };
+        if(! cfg || ! cfg->enable_broadcast_join()) {
+            c_options.restricted_features() += {
+                yugawara::restricted_feature::exchange_broadcast,
+            };
+        }
         if(cfg && ! cfg->enable_truncate()) {
             c_options.restricted_features() += {
                 yugawara::restricted_feature::statement_truncate_table,
@@ -807,6 +828,69 @@ executor::exchange::forward::step create(
         std::move(column_order)};
 }
 
+/**
+ * @brief find the hash table key of the broadcast exchange
+ * @details the key is taken from the first join_find operator that refers to the broadcast in the downstream
+ * processes. Other join_find operators referring the same broadcast must use the same key.
+ * @return the indices of the broadcast columns used as the key, in the order of join_find keys
+ */
+static std::vector<std::size_t> find_broadcast_key_indices(takatori::plan::broadcast const& broadcast) {
+    std::vector<std::size_t> ret{};
+    bool found = false;
+    auto&& columns = broadcast.columns();
+    for(auto&& process : broadcast.downstreams()) {
+        if(found) {
+            break;
+        }
+        takatori::relation::sort_from_upstream(process.operators(), [&](takatori::relation::expression const& op){
+            if(found || op.kind() != takatori::relation::expression_kind::join_find) {
+                return;
+            }
+            auto& jf = unsafe_downcast<takatori::relation::join_find const>(op);
+            auto xchg = yugawara::binding::extract_if<takatori::plan::exchange>(jf.source());
+            if(! xchg || std::addressof(*xchg) != std::addressof(broadcast)) {
+                return;
+            }
+            for(auto&& k : jf.keys()) {
+                auto it = std::find(columns.begin(), columns.end(), k.variable());
+                if(it == columns.end()) {
+                    throw_exception(std::logic_error{"join_find key is not found in broadcast columns"});
+                }
+                ret.emplace_back(static_cast<std::size_t>(std::distance(columns.begin(), it)));
+            }
+            found = true;
+        });
+    }
+    return ret;
+}
+
+executor::exchange::broadcast::step create(
+    takatori::plan::broadcast const& broadcast,
+    compiled_info const& info
+) {
+    meta::variable_order column_order{
+        meta::variable_ordering_enum_tag<meta::variable_ordering_kind::flat_record>,
+        broadcast.columns(),
+    };
+    std::vector<meta::field_type> fields{};
+    auto cnt = broadcast.columns().size();
+    fields.reserve(cnt);
+    for(auto&& c: broadcast.columns()) {
+        fields.emplace_back(utils::type_for(info, c));
+    }
+    auto meta = std::make_shared<meta::record_meta>(
+        std::move(fields),
+        boost::dynamic_bitset{cnt}.flip() // currently assuming all fields are nullable
+    );
+    return executor::exchange::broadcast::step{
+        std::make_shared<executor::exchange::broadcast::broadcast_info>(
+            std::move(meta),
+            find_broadcast_key_indices(broadcast)
+        ),
+        std::move(column_order)
+    };
+}
+
 executor::exchange::group::step create(
     takatori::plan::group const& group,
     compiled_info const& info
@@ -1164,20 +1248,23 @@ static void create_mirror_for_ddl(
     );
 }
 
-static void create_mirror_for_execute(
-    compiler_context& ctx,
-    maybe_shared_ptr<statement::statement> statement,
-    compiled_info info,
-    std::shared_ptr<mirror_container> const& mirrors,
-    parameter_set const* parameters
+/**
+ * @brief create the step graph template for the execute statement
+ * @details the prototype steps are created without host variables and the connectivity is recorded by step
+ * indices so that the template can be instantiated for each execution.
+ */
+static std::shared_ptr<execute_template const> create_execute_template(
+    takatori::statement::execute const& stmt,
+    compiled_info const& info,
+    std::shared_ptr<mirror_container> const& mirrors
 ) {
-    auto vars = create_host_variables(parameters, mirrors->host_variable_info());
     std::unordered_map<takatori::plan::step const*, executor::common::step*> steps{};
+    std::vector<takatori::plan::step const*> sources{};
     yugawara::binding::factory bindings{};
     auto mirror = std::make_shared<executor::common::graph>();
     takatori::plan::sort_from_upstream(
-        unsafe_downcast<takatori::statement::execute>(*statement).execution_plan(),
-        [&mirror, &info, &bindings, &steps, &vars, &mirrors](takatori::plan::step const& s){
+        stmt.execution_plan(),
+        [&mirror, &info, &bindings, &steps, &sources, &mirrors](takatori::plan::step const& s){
             switch(s.kind()) {
                 case takatori::plan::step_kind::forward: {
                     auto& forward = unsafe_downcast<takatori::plan::forward const>(s);  //NOLINT
@@ -1200,26 +1287,32 @@ static void create_mirror_for_execute(
                     steps[&agg] = step;
                     break;
                 }
-                case takatori::plan::step_kind::broadcast:
-                    // TODO implement
-                    throw_exception(std::logic_error{""});
+                case takatori::plan::step_kind::broadcast: {
+                    auto& broadcast = unsafe_downcast<takatori::plan::broadcast const>(s);  //NOLINT
+                    steps[&broadcast] = &mirror->emplace<executor::exchange::broadcast::step>(create(broadcast, info));
                     break;
+                }
                 case takatori::plan::step_kind::discard:
                     throw_exception(std::logic_error{""});
                     break;
                 case takatori::plan::step_kind::process: {
                     auto& process = unsafe_downcast<takatori::plan::process const>(s);  //NOLINT
-                    steps[&process] = &mirror->emplace<executor::process::step>(create(process, info, mirrors, vars.get()));
+                    steps[&process] = &mirror->emplace<executor::process::step>(create(process, info, mirrors, nullptr));
                     break;
                 }
                 default:
-                    break;
+                    return;
             }
+            sources.emplace_back(&s);
         }
     );
 
     using model::step_kind;
-    for(auto&& [s, step] : steps) {
+    std::vector<std::vector<execute_template::step_index>> upstreams(sources.size());
+    std::vector<execute_template::process_io> io(sources.size());
+    for(std::size_t i = 0, n = sources.size(); i < n; ++i) {
+        auto* s = sources[i];
+        auto* step = steps[s];
         auto map = std::make_shared<executor::process::io_exchange_map>();
         // For process steps, `relation_io_map` (built in `create()` above) is the single source
         // of truth for input/output indices. `io_exchange_map` is populated by looking up the
@@ -1235,12 +1328,20 @@ static void create_mirror_for_execute(
         if(takatori::plan::has_upstream(*s)) {
             takatori::plan::enumerate_upstream(
                 *s,
-                [step=step, &steps, &map, rmap, &bindings](takatori::plan::step const& up){
-                    *step << *steps[&up];
+                [step=step, i, &steps, &map, rmap, &bindings, &upstreams, &io](takatori::plan::step const& up){
+                    auto* upstream = steps[&up];
+                    if(upstream->kind() == step_kind::broadcast) {
+                        // broadcast is consumed by the pretask of the downstream
+                        upstream->connect_to_sub(*step);
+                    } else {
+                        *step << *upstream;
+                    }
+                    upstreams[i].emplace_back(upstream->id());
                     if(step->kind() == step_kind::process) {
                         auto& exchange = unsafe_downcast<takatori::plan::exchange const>(up);
                         auto idx = rmap->input_index(bindings(exchange));
-                        map->add_input(idx, unsafe_downcast<executor::exchange::step>(steps[&up]));
+                        map->add_input(idx, unsafe_downcast<executor::exchange::step>(upstream));
+                        io[i].inputs_.emplace_back(idx, upstream->id());
                     }
                 }
             );
@@ -1255,16 +1356,40 @@ static void create_mirror_for_execute(
             auto& process = unsafe_downcast<takatori::plan::process const>(*s);
             for(auto&& offer : enumerate_offers(process)) {
                 auto& exchange = yugawara::binding::extract<takatori::plan::exchange>(offer->destination());
+                auto* downstream = steps.at(&exchange);
                 auto idx = rmap->output_index(*offer);
-                map->add_output(idx, unsafe_downcast<executor::exchange::step>(steps.at(&exchange)));
+                map->add_output(idx, unsafe_downcast<executor::exchange::step>(downstream));
+                io[i].outputs_.emplace_back(idx, downstream->id());
             }
-            unsafe_downcast<executor::process::step>(step)->io_exchange_map(std::move(map));
+            auto* proc = unsafe_downcast<executor::process::step>(step);
+            proc->io_exchange_map(std::move(map));
+            // io_info only depends on the exchange metadata, so create it once and share across executions
+            proc->io_info(proc->create_io_info());
         }
     }
+    return std::make_shared<execute_template const>(std::move(mirror), std::move(upstreams), std::move(io));
+}
+
+static void create_mirror_for_execute(
+    compiler_context& ctx,
+    std::shared_ptr<plan::prepared_statement> const& prepared,
+    parameter_set const* parameters
+) {
+    auto& mirrors = prepared->mirrors();
+    auto tmpl = prepared->execute_template();
+    if(! tmpl) {
+        tmpl = create_execute_template(
+            unsafe_downcast<takatori::statement::execute>(*prepared->statement()),
+            prepared->compiled_info(),
+            mirrors
+        );
+        prepared->execute_template(tmpl);
+    }
+    auto vars = create_host_variables(parameters, mirrors->host_variable_info());
     ctx.executable_statement(std::make_shared<executable_statement>(
-        std::move(statement),
-        std::move(info),
-        std::make_shared<executor::common::execute>(mirror),
+        prepared->statement(),
+        prepared->compiled_info(),
+        std::make_shared<executor::common::execute>(tmpl->instantiate(vars.get())),
         mirrors->host_variable_info(),
         std::move(vars),
         mirrors,
@@ -1289,7 +1414,7 @@ static status create_executable_statement(compiler_context& ctx, parameter_set c
             create_mirror_for_write(ctx, p->statement(), p->compiled_info(), p->mirrors(), parameters);
             break;
         case statement_kind::execute:
-            create_mirror_for_execute(ctx, p->statement(), p->compiled_info(), p->mirrors(), parameters);
+            create_mirror_for_execute(ctx, p, parameters);
             break;
         case statement_kind::create_table:
             create_mirror_for_ddl(ctx, p->statement(), p->compiled_info(), p->mirrors(), parameters);
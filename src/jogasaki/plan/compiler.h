@@ -21,6 +21,7 @@
 #include <utility>
 
 #include <takatori/plan/aggregate.h>
+#include <takatori/plan/broadcast.h>
 #include <takatori/plan/forward.h>
 #include <takatori/plan/group.h>
 #include <takatori/plan/process.h>
@@ -31,6 +32,7 @@
 
 #include <jogasaki/error/error_info.h>
 #include <jogasaki/executor/exchange/aggregate/step.h>
+#include <jogasaki/executor/exchange/broadcast/step.h>
 #include <jogasaki/executor/exchange/forward/step.h>
 #include <jogasaki/executor/exchange/group/step.h>
 #include <jogasaki/executor/process/impl/variable_table.h>
@@ -73,6 +75,7 @@ void preprocess(
 [[nodiscard]] executor::exchange::forward::step create(takatori::plan::forward const& forward, compiled_info const& info);
 [[nodiscard]] executor::exchange::group::step create(takatori::plan::group const& group, compiled_info const& info);
 [[nodiscard]] executor::exchange::aggregate::step create(takatori::plan::aggregate const& agg, compiled_info const& info);
+[[nodiscard]] executor::exchange::broadcast::step create(takatori::plan::broadcast const& broadcast, compiled_info const& info);
 
 std::shared_ptr<executor::process::impl::variable_table_info> create_host_variable_info(
     std::shared_ptr<::yugawara::variable::configurable_provider> const& provider,
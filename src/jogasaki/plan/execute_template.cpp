@@ -0,0 +1,127 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "execute_template.h"
+
+#include <stdexcept>
+
+#include <takatori/util/downcast.h>
+#include <takatori/util/exception.h>
+
+#include <jogasaki/executor/exchange/aggregate/step.h>
+#include <jogasaki/executor/exchange/broadcast/step.h>
+#include <jogasaki/executor/exchange/forward/step.h>
+#include <jogasaki/executor/exchange/group/step.h>
+#include <jogasaki/executor/process/io_exchange_map.h>
+#include <jogasaki/executor/process/processor_info.h>
+#include <jogasaki/executor/process/step.h>
+#include <jogasaki/model/step_kind.h>
+
+namespace jogasaki::plan {
+
+using takatori::util::throw_exception;
+using takatori::util::unsafe_downcast;
+
+execute_template::execute_template(
+    std::shared_ptr<executor::common::graph> prototype,
+    std::vector<std::vector<step_index>> upstreams,
+    std::vector<process_io> io
+) noexcept :
+    prototype_(std::move(prototype)),
+    upstreams_(std::move(upstreams)),
+    io_(std::move(io))
+{}
+
+std::shared_ptr<executor::common::graph> execute_template::instantiate(
+    executor::process::impl::variable_table const* host_variables
+) const {
+    using model::step_kind;
+    auto ret = std::make_shared<executor::common::graph>();
+    auto protos = prototype_->steps();
+    ret->reserve(protos.size());
+    std::vector<executor::common::step*> steps{};
+    steps.reserve(protos.size());
+    for(auto&& p : protos) {
+        switch(unsafe_downcast<executor::common::step>(*p).kind()) {
+            case step_kind::forward: {
+                auto& s = unsafe_downcast<executor::exchange::forward::step>(*p);
+                steps.emplace_back(&ret->emplace<executor::exchange::forward::step>(s.info(), s.input_order()));
+                break;
+            }
+            case step_kind::group: {
+                auto& s = unsafe_downcast<executor::exchange::group::step>(*p);
+                steps.emplace_back(
+                    &ret->emplace<executor::exchange::group::step>(s.info(), s.input_order(), s.output_order())
+                );
+                break;
+            }
+            case step_kind::aggregate: {
+                auto& s = unsafe_downcast<executor::exchange::aggregate::step>(*p);
+                steps.emplace_back(
+                    &ret->emplace<executor::exchange::aggregate::step>(s.info(), s.input_order(), s.output_order())
+                );
+                break;
+            }
+            case step_kind::broadcast: {
+                auto& s = unsafe_downcast<executor::exchange::broadcast::step>(*p);
+                steps.emplace_back(&ret->emplace<executor::exchange::broadcast::step>(s.info(), s.input_order()));
+                break;
+            }
+            case step_kind::process: {
+                auto& s = unsafe_downcast<executor::process::step>(*p);
+                auto info = host_variables == nullptr ?
+                    s.info() :
+                    std::make_shared<executor::process::processor_info>(*s.info(), host_variables);
+                steps.emplace_back(
+                    &ret->emplace<executor::process::step>(std::move(info), s.relation_io_map(), s.io_info())
+                );
+                break;
+            }
+            default:
+                throw_exception(std::logic_error{""});
+        }
+    }
+    for(std::size_t i = 0, n = steps.size(); i < n; ++i) {
+        auto* step = steps[i];
+        for(auto up : upstreams_[i]) {
+            if(steps[up]->kind() == step_kind::broadcast) {
+                steps[up]->connect_to_sub(*step);
+                continue;
+            }
+            *step << *steps[up];
+        }
+        if(step->kind() != step_kind::process) {
+            continue;
+        }
+        auto& io = io_[i];
+        auto map = std::make_shared<executor::process::io_exchange_map>();
+        map->reserve_input(io.inputs_.size());
+        map->reserve_output(io.outputs_.size());
+        for(auto&& [idx, xchg] : io.inputs_) {
+            map->add_input(idx, unsafe_downcast<executor::exchange::step>(steps[xchg]));
+        }
+        for(auto&& [idx, xchg] : io.outputs_) {
+            map->add_output(idx, unsafe_downcast<executor::exchange::step>(steps[xchg]));
+        }
+        unsafe_downcast<executor::process::step>(step)->io_exchange_map(std::move(map));
+    }
+    return ret;
+}
+
+executor::common::graph const& execute_template::prototype() const noexcept {
+    return *prototype_;
+}
+
+}  // namespace jogasaki::plan
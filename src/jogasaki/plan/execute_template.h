@@ -0,0 +1,86 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <jogasaki/executor/common/graph.h>
+#include <jogasaki/executor/process/impl/variable_table.h>
+
+namespace jogasaki::plan {
+
+/**
+ * @brief reusable template of the step graph for the execute statement
+ * @details the template keeps a prototype step graph compiled from the execution plan without host variables,
+ * together with its connectivity. Instantiating the template creates new steps sharing the immutable compiled
+ * information (record metadata, processor information and input/output mappings) with the prototype, so that
+ * each execution of a prepared statement only binds the host variables instead of re-walking the plan.
+ * @note the template is immutable after construction and can be instantiated concurrently
+ */
+class execute_template {
+public:
+    using step_index = std::size_t;
+
+    /**
+     * @brief input/output exchange indices of a process step
+     * @details each element is the pair of the input/output index of the process and the index of the exchange step
+     */
+    struct process_io {
+        std::vector<std::pair<std::size_t, step_index>> inputs_{};
+        std::vector<std::pair<std::size_t, step_index>> outputs_{};
+    };
+
+    /**
+     * @brief create empty object
+     */
+    execute_template() = default;
+
+    /**
+     * @brief create new object
+     * @param prototype the step graph compiled without host variables. Steps are indexed by their ids.
+     * @param upstreams the indices of upstream steps for each step, in the order of connection
+     * @param io the input/output exchange indices for each step (empty for exchange steps)
+     */
+    execute_template(
+        std::shared_ptr<executor::common::graph> prototype,
+        std::vector<std::vector<step_index>> upstreams,
+        std::vector<process_io> io
+    ) noexcept;
+
+    /**
+     * @brief create new step graph from this template
+     * @param host_variables the host variables bound to the new graph (nullptr if there is no host variable)
+     * @return the new step graph
+     */
+    [[nodiscard]] std::shared_ptr<executor::common::graph> instantiate(
+        executor::process::impl::variable_table const* host_variables
+    ) const;
+
+    /**
+     * @brief accessor to the prototype step graph
+     */
+    [[nodiscard]] executor::common::graph const& prototype() const noexcept;
+
+private:
+    std::shared_ptr<executor::common::graph> prototype_{};
+    std::vector<std::vector<step_index>> upstreams_{};
+    std::vector<process_io> io_{};
+};
+
+}  // namespace jogasaki::plan
@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -31,6 +32,8 @@ namespace jogasaki::plan {
 
 using ::takatori::util::maybe_shared_ptr;
 
+class execute_template;
+
 /**
  * @brief prepared statement
  */
@@ -96,12 +99,30 @@ public:
     [[nodiscard]] std::shared_ptr<std::string> const& sql_text_shared() const noexcept {
         return sql_text_;
     }
+
+    /**
+     * @brief accessor to the step graph template cached for the execute statement
+     * @return nullptr if the template is not created yet
+     * @note this function is thread-safe
+     */
+    [[nodiscard]] std::shared_ptr<class execute_template const> execute_template() const noexcept {
+        return std::atomic_load(std::addressof(execute_template_));
+    }
+
+    /**
+     * @brief setter of the step graph template for the execute statement
+     * @note this function is thread-safe
+     */
+    void execute_template(std::shared_ptr<class execute_template const> arg) noexcept {
+        std::atomic_store(std::addressof(execute_template_), std::move(arg));
+    }
 private:
     maybe_shared_ptr<::takatori::statement::statement> statement_{};
     yugawara::compiled_info compiled_info_{};
     std::shared_ptr<yugawara::variable::configurable_provider> host_variables_{};
     std::shared_ptr<mirror_container> mirrors_{};
     std::shared_ptr<std::string> sql_text_{};
+    std::shared_ptr<class execute_template const> execute_template_{};
 };
 
 }
@@ -0,0 +1,118 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "prepared_statement_cache.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace jogasaki::plan {
+
+prepared_statement_cache::prepared_statement_cache(std::size_t capacity) noexcept :
+    capacity_(capacity)
+{}
+
+prepared_statement_cache::key_type prepared_statement_cache::create_key(
+    std::string_view sql,
+    std::unordered_map<std::string, api::field_type_kind> const& variables,
+    compile_option const& option
+) {
+    // only surrounding white spaces are trimmed - normalizing inside the text requires tokenizing literals and
+    // comments, and the clients sharing statements typically send the identical text
+    constexpr std::string_view spaces = " \t\r\n";
+    auto b = sql.find_first_not_of(spaces);
+    if(b == std::string_view::npos) {
+        sql = {};
+    } else {
+        sql = sql.substr(b, sql.find_last_not_of(spaces) - b + 1);
+    }
+    std::vector<std::pair<std::string_view, api::field_type_kind>> vars{variables.begin(), variables.end()};
+    std::sort(vars.begin(), vars.end());
+    key_type ret{};
+    ret.reserve(sql.size() + vars.size() * 8 + 2);
+    ret.append(sql);
+    ret.push_back('\0');
+    ret.push_back(option.explain_by_text_only() ? '1' : '0');
+    for(auto&& [n, t] : vars) {
+        ret.push_back('\0');
+        ret.append(n);
+        ret.push_back(':');
+        ret.append(std::to_string(static_cast<std::size_t>(t)));
+    }
+    return ret;
+}
+
+std::shared_ptr<prepared_statement> prepared_statement_cache::find(key_type const& key) {
+    if(! enabled()) {
+        return {};
+    }
+    std::lock_guard lk{mutex_};
+    auto it = index_.find(key);
+    if(it == index_.end()) {
+        return {};
+    }
+    entries_.splice(entries_.begin(), entries_, it->second);
+    ++hit_count_;
+    return it->second->second;
+}
+
+bool prepared_statement_cache::put(key_type key, std::shared_ptr<prepared_statement> statement, version_type version) {
+    if(! enabled()) {
+        return false;
+    }
+    std::lock_guard lk{mutex_};
+    if(version != version_.load()) {
+        // schema is changed during compilation
+        return false;
+    }
+    if(auto it = index_.find(key); it != index_.end()) {
+        // compiled concurrently by other session - keep the existing one
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return false;
+    }
+    entries_.emplace_front(std::move(key), std::move(statement));
+    index_.emplace(entries_.front().first, entries_.begin());
+    while(entries_.size() > capacity_) {
+        index_.erase(entries_.back().first);
+        entries_.pop_back();
+    }
+    return true;
+}
+
+prepared_statement_cache::version_type prepared_statement_cache::version() const noexcept {
+    return version_.load();
+}
+
+void prepared_statement_cache::invalidate() {
+    std::lock_guard lk{mutex_};
+    ++version_;
+    index_.clear();
+    entries_.clear();
+}
+
+bool prepared_statement_cache::enabled() const noexcept {
+    return capacity_ != 0;
+}
+
+std::size_t prepared_statement_cache::size() const {
+    std::lock_guard lk{mutex_};
+    return entries_.size();
+}
+
+std::size_t prepared_statement_cache::hit_count() const noexcept {
+    return hit_count_.load();
+}
+
+}  // namespace jogasaki::plan
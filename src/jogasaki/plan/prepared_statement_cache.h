@@ -0,0 +1,122 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include <jogasaki/api/field_type_kind.h>
+#include <jogasaki/plan/compile_option.h>
+#include <jogasaki/plan/prepared_statement.h>
+
+namespace jogasaki::plan {
+
+/**
+ * @brief cache of prepared statements shared across sessions
+ * @details the cache keeps the compiled statements keyed by the SQL text and placeholder types, so that preparing
+ * the same statement on many sessions compiles it only once. The entries are evicted in LRU order when the cache
+ * is full.
+ * The cache has a schema version which is incremented on DDL. Each entry is valid only for the version it is
+ * compiled with - callers capture the version before compilation and pass it on `put()` so that the statement
+ * compiled with the old schema is not cached after DDL.
+ * @note this object is thread-safe
+ */
+class prepared_statement_cache {
+public:
+    using key_type = std::string;
+    using version_type = std::size_t;
+
+    /**
+     * @brief create new object
+     * @param capacity the max number of entries. Pass 0 to disable caching.
+     */
+    explicit prepared_statement_cache(std::size_t capacity = 0) noexcept;
+
+    /**
+     * @brief create the cache key for the statement
+     * @param sql the SQL text. Leading and trailing white spaces are ignored.
+     * @param variables the placeholder names and types
+     * @param option the compile option
+     * @return the cache key
+     */
+    [[nodiscard]] static key_type create_key(
+        std::string_view sql,
+        std::unordered_map<std::string, api::field_type_kind> const& variables,
+        compile_option const& option
+    );
+
+    /**
+     * @brief find the cached statement
+     * @param key the cache key
+     * @return the cached statement, or nullptr if not found
+     */
+    [[nodiscard]] std::shared_ptr<prepared_statement> find(key_type const& key);
+
+    /**
+     * @brief add the statement to the cache
+     * @details the statement is not added if the schema version is changed from `version`
+     * @param key the cache key
+     * @param statement the statement to cache
+     * @param version the schema version captured before the statement is compiled
+     * @return true if the statement is added
+     */
+    bool put(key_type key, std::shared_ptr<prepared_statement> statement, version_type version);
+
+    /**
+     * @brief accessor to the current schema version
+     */
+    [[nodiscard]] version_type version() const noexcept;
+
+    /**
+     * @brief increment the schema version and drop all entries
+     * @details call this when the schema (tables, indices, sequences or privileges) is changed
+     */
+    void invalidate();
+
+    /**
+     * @brief returns whether caching is enabled
+     */
+    [[nodiscard]] bool enabled() const noexcept;
+
+    /**
+     * @brief returns the number of entries
+     */
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @brief returns the number of cache hits (for testing)
+     */
+    [[nodiscard]] std::size_t hit_count() const noexcept;
+
+private:
+    using entry_list = std::list<std::pair<key_type, std::shared_ptr<prepared_statement>>>;
+
+    std::size_t capacity_{};
+    mutable std::mutex mutex_{};
+    entry_list entries_{};  // most recently used first
+    std::unordered_map<key_type, entry_list::iterator> index_{};
+    std::atomic<version_type> version_{};
+    std::atomic_size_t hit_count_{};
+};
+
+}  // namespace jogasaki::plan
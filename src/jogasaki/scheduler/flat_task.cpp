@@ -32,9 +32,11 @@
 #include <jogasaki/executor/executor.h>
 #include <jogasaki/executor/file/loader.h>
 #include <jogasaki/logging.h>
+#include <jogasaki/memory/memory_tracker.h>
 #include <jogasaki/model/graph.h>
 #include <jogasaki/model/task.h>
 #include <jogasaki/request_logging.h>
+#include <jogasaki/scheduler/conditional_task.h>
 #include <jogasaki/scheduler/dag_controller.h>
 #include <jogasaki/scheduler/dag_controller_impl.h>
 #include <jogasaki/scheduler/job_context.h>
@@ -147,6 +149,25 @@ void flat_task::resubmit(request_context& req_context) {
     ts.schedule_task(flat_task{*this});
 }
 
+void flat_task::sleep(request_context& req_context) {
+    auto condition = origin_->release_wake_up_condition();
+    if(! condition) {
+        resubmit(req_context);
+        return;
+    }
+    // the worker is released and the task is resubmitted when the condition checked by the scheduler is met
+    auto& ts = *req_context.scheduler();
+    ts.schedule_conditional_task(
+        conditional_task{
+            std::addressof(req_context),
+            std::move(condition),
+            [task = flat_task{*this}, rctx = std::addressof(req_context)]() mutable {
+                task.resubmit(*rctx);
+            }
+        }
+    );
+}
+
 bool ready_to_finish(job_context& job, bool calling_from_task) {  //NOLINT(readability-make-member-function-const)
     // stop log_entry/log_exit since this function is called frequently as part of durability callback processing
     // log_entry << *this;
@@ -318,6 +339,16 @@ bool flat_task::execute_with_catch(tateyama::task_scheduler::context& ctx) {
     std::string message{};
     try {
         job_completes = execute(ctx);
+    } catch (memory::memory_limit_exceeded const& e) {
+        // not an internal error - the request consumed memory more than the limit
+        VLOG_LP(log_error) << e.what() << " job_id:" << utils::hex(job()->id());
+        set_error_context(
+            *req_context_,
+            error_code::sql_limit_reached_exception,
+            "memory usage of the request exceeds the limit",
+            status::err_resource_limit_reached
+        );
+        return true;
     } catch (boost::exception& e) {
         // currently find_trace() after catching std::exception doesn't work properly. So catch as boost exception. TODO
         internal_error = true;
@@ -362,6 +393,8 @@ void flat_task::operator()(tateyama::task_scheduler::context& ctx) {
     auto& tctx = req_context_->transaction();
     bool job_completes{};
     {
+        // let the resources created by this task charge the job's memory tracker
+        memory::memory_tracker_scope tracker_scope{job()->memory_tracker()};
         auto lk = (tctx && sticky_) ?
             std::unique_lock{tctx->mutex()} :
             std::unique_lock<transaction_context::mutex_type>{};
@@ -558,6 +591,10 @@ bool flat_task::execute_wrapped() {
         resubmit(*req_context_);
         return false;
     }
+    if(res == model::task_result::sleep) {
+        sleep(*req_context_);
+        return false;
+    }
     return res == model::task_result::complete_and_teardown;
 }
 
@@ -76,6 +76,14 @@ std::shared_ptr<request_detail> const &job_context::request() const noexcept {
     return request_detail_;
 }
 
+void job_context::memory_tracker(std::shared_ptr<memory::memory_tracker> arg) noexcept {
+    memory_tracker_ = std::move(arg);
+}
+
+std::shared_ptr<memory::memory_tracker> const& job_context::memory_tracker() const noexcept {
+    return memory_tracker_;
+}
+
 void job_context::completion_readiness(readiness_provider checker) noexcept {
     readiness_provider_ = std::move(checker);
 }
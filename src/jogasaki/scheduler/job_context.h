@@ -22,6 +22,7 @@
 
 #include <takatori/util/maybe_shared_ptr.h>
 
+#include <jogasaki/memory/memory_tracker.h>
 #include <jogasaki/scheduler/hybrid_execution_mode.h>
 #include <jogasaki/scheduler/request_detail.h>
 #include <jogasaki/utils/hex.h>
@@ -149,6 +150,18 @@ public:
      */
     [[nodiscard]] std::shared_ptr<request_detail> const& request() const noexcept;
 
+    /**
+     * @brief setter for memory tracker
+     * @details the tracker counts the pages held by the memory resources used for this job
+     */
+    void memory_tracker(std::shared_ptr<memory::memory_tracker> arg) noexcept;
+
+    /**
+     * @brief getter for memory tracker
+     * @return nullptr if the memory used by this job is not tracked
+     */
+    [[nodiscard]] std::shared_ptr<memory::memory_tracker> const& memory_tracker() const noexcept;
+
     /**
      * @brief accessor for hybrid execution mode
      * @details Hybrid scheduler uses this field to remember internal scheduler (serial or stealing) for the job.
@@ -183,6 +196,7 @@ private:
     job_completion_callback callback_{};
     readiness_provider readiness_provider_{};
     std::shared_ptr<request_detail> request_detail_{};
+    std::shared_ptr<memory::memory_tracker> memory_tracker_{};
     cache_align std::atomic<hybrid_execution_mode_kind> hybrid_execution_mode_{hybrid_execution_mode_kind::undefined};
     cache_align std::atomic_bool going_teardown_{false};
 
@@ -209,6 +209,10 @@ void stealing_task_scheduler::print_diagnostic(std::ostream &os) {
                 os << "    channel_name: " << diag->channel_name() << std::endl;
             }
             os << "    task_count: " << ctx->task_count() << std::endl;
+            if(auto& tracker = ctx->memory_tracker()) {
+                os << "    memory_usage: " << tracker->consumed() << std::endl;
+                os << "    memory_peak: " << tracker->peak() << std::endl;
+            }
         }
     }
     scheduler_.print_diagnostic(os);
@@ -0,0 +1,171 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+#include <jogasaki/utils/assert.h>
+#include <jogasaki/utils/interference_size.h>
+
+namespace jogasaki::storage::impl {
+
+/**
+ * @brief reader-writer try-lock whose reader count is distributed over cache-line aligned slots
+ * @details readers increment the counter of the slot assigned to the calling thread and then check the writer state,
+ * while the writer marks the state as trying and then checks all the slots. So readers on different threads do not
+ * touch the same cache line unless a writer exists.
+ * The writer fails immediately if any reader holds the lock. Otherwise, readers that see the writer trying wait
+ * until the attempt finishes (it only scans the slots, so the wait is short) instead of failing, so a failing
+ * writer never makes readers fail.
+ * @note shared lock must be released with the slot used to acquire it.
+ */
+class distributed_lock {
+public:
+    /**
+     * @brief the number of reader slots
+     */
+    static constexpr std::size_t slot_count = 32;
+
+    /**
+     * @brief create new object
+     */
+    distributed_lock() = default;
+
+    /**
+     * @brief returns the reader slot assigned to the current thread
+     * @details slots are assigned to threads in round-robin order on the first call on the thread
+     */
+    [[nodiscard]] static std::size_t current_slot() noexcept {
+        static std::atomic_size_t next{};
+        thread_local std::size_t slot = next.fetch_add(1) % slot_count;
+        return slot;
+    }
+
+    /**
+     * @brief try to acquire exclusive lock
+     * @return true if successful
+     * @return false if the lock is held by others
+     */
+    bool lock() {
+        if(reader_count() != 0) {
+            // fail before publishing the attempt so that readers are not blocked
+            return false;
+        }
+        auto expected = writer_state::none;
+        if(! writer_.value_.compare_exchange_strong(expected, writer_state::trying)) {
+            return false;
+        }
+        if(reader_count() != 0) {
+            writer_.value_.store(writer_state::none);
+            return false;
+        }
+        writer_.value_.store(writer_state::held);
+        return true;
+    }
+
+    /**
+     * @brief returns whether exclusive lock can be acquired at this point
+     */
+    [[nodiscard]] bool can_lock() const noexcept {
+        return writer_.value_.load() == writer_state::none && reader_count() == 0;
+    }
+
+    /**
+     * @brief release exclusive lock
+     * @throws std::logic_error if the lock is not held
+     */
+    void release() {
+        auto prev = writer_.value_.exchange(writer_state::none);
+        assert_with_exception(prev == writer_state::held, static_cast<int>(prev));
+    }
+
+    /**
+     * @brief try to acquire shared lock
+     * @details if a writer is trying to lock, this waits until the attempt finishes
+     * @param slot the reader slot to count the lock
+     * @return true if successful
+     * @return false if the exclusive lock is held by others
+     */
+    bool lock_shared(std::size_t slot) noexcept {
+        auto& s = slots_[slot % slot_count].value_;  //NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        s.fetch_add(1);
+        auto st = writer_.value_.load();
+        while(st == writer_state::trying) {
+            // the writer sees this reader and gives up, or it has completed the check before this reader came
+            std::this_thread::yield();
+            st = writer_.value_.load();
+        }
+        if(st == writer_state::held) {
+            s.fetch_sub(1);
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief returns whether shared lock can be acquired at this point
+     */
+    [[nodiscard]] bool can_lock_shared() const noexcept {
+        return writer_.value_.load() != writer_state::held;
+    }
+
+    /**
+     * @brief release shared lock
+     * @param slot the reader slot used to acquire the lock
+     * @throws std::logic_error if the shared lock is not held on the slot
+     */
+    void release_shared(std::size_t slot) {
+        auto& s = slots_[slot % slot_count].value_;  //NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        auto prev = s.fetch_sub(1);
+        if(prev <= 0) {
+            s.fetch_add(1);
+        }
+        assert_with_exception(prev > 0, prev);
+    }
+
+    /**
+     * @brief returns the number of readers (including ones failing to acquire the lock transiently)
+     */
+    [[nodiscard]] std::int64_t reader_count() const noexcept {
+        std::int64_t ret{};
+        for(auto&& s : slots_) {
+            ret += s.value_.load();
+        }
+        return ret;
+    }
+
+private:
+    enum class writer_state : std::uint8_t {
+        none,
+        trying,
+        held,
+    };
+    struct cache_align reader_slot {
+        std::atomic<std::int64_t> value_{};
+    };
+    struct cache_align writer_flag {
+        std::atomic<writer_state> value_{writer_state::none};
+    };
+
+    std::array<reader_slot, slot_count> slots_{};
+    writer_flag writer_{};
+};
+
+}  // namespace jogasaki::storage::impl
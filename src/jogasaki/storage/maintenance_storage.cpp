@@ -22,6 +22,7 @@
 
 #include <sharksfin/StorageOptions.h>
 
+#include <jogasaki/dist/key_histogram_store.h>
 #include <jogasaki/executor/global.h>
 #include <jogasaki/logging.h>
 #include <jogasaki/logging_helper.h>
@@ -75,6 +76,7 @@ std::vector<std::string> maintenance_storage(std::atomic_bool const* stop_reques
                 continue;
             }
         }
+        global::key_histogram_store().remove(ctrl->derived_storage_key());
         auto name = std::string{ctrl->original_name()};
         auto raw_key = ctrl->derived_storage_key();
         std::stringstream key_ss{};
@@ -33,7 +33,7 @@ shared_lock::~shared_lock() noexcept {
         try {
             auto s = manager_->find_entry(e);
             if (s) {
-                s->release_shared();
+                s->release_shared(slot_);
             }
         } catch (...) {
             LOG_LP(ERROR) << "unexpected exception occurred while releasing storage:" << e;
@@ -41,9 +41,10 @@ shared_lock::~shared_lock() noexcept {
     }
 }
 
-shared_lock::shared_lock(storage_manager& manager, storage_list storages) :
+shared_lock::shared_lock(storage_manager& manager, storage_list storages, std::size_t slot) :
     manager_(std::addressof(manager)),
-    storages_(std::move(storages))
+    storages_(std::move(storages)),
+    slot_(slot)
 {}
 
 storage_list_view shared_lock::storage() {
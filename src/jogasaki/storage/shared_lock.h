@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -43,13 +44,20 @@ public:
     shared_lock(shared_lock&& other) noexcept = delete;
     shared_lock& operator=(shared_lock&& other) noexcept = delete;
 
-    shared_lock(storage_manager& manager, storage_list storages);
+    /**
+     * @brief create new object holding the shared locks
+     * @param manager the storage manager owning the storages
+     * @param storages the storages whose shared locks are held by this object
+     * @param slot the reader slot used to acquire the shared locks
+     */
+    shared_lock(storage_manager& manager, storage_list storages, std::size_t slot = 0);
 
     storage_list_view storage();
 
 private:
     storage_manager* manager_{};
     storage_list storages_{};
+    std::size_t slot_{};
 };
 
 };
@@ -144,9 +144,10 @@ template<class T>
 struct lock_holder {
     lock_holder() = default;
 
-    lock_holder(T owner, bool shared) :
+    lock_holder(T owner, bool shared, std::size_t slot) :
         owner_(std::move(owner)),
-        shared_(shared)
+        shared_(shared),
+        slot_(slot)
     {}
 
     lock_holder(lock_holder const& other) = default;
@@ -158,7 +159,7 @@ struct lock_holder {
         try {
             if (holding_) {
                 if (shared_) {
-                    owner_->release_shared();
+                    owner_->release_shared(slot_);
                     return;
                 }
                 owner_->release();
@@ -173,9 +174,15 @@ struct lock_holder {
     T owner_{};  //NOLINT
     bool holding_ = true;  //NOLINT
     bool shared_ = false;  //NOLINT
+    std::size_t slot_{};  //NOLINT
 };
 
-std::pair<bool, storage_list> storage_manager::lock_internal(bool shared, storage_list_view storages, unique_lock* lock) {
+std::pair<bool, storage_list> storage_manager::lock_internal(
+    bool shared,
+    storage_list_view storages,
+    unique_lock* lock,
+    std::size_t slot
+) {
     // holder holds in-flight locks until the end of this function.
     std::vector<storage_entry> locked_storages{};
     std::vector<lock_holder<std::shared_ptr<impl::storage_control>>> holders{};
@@ -186,12 +193,12 @@ std::pair<bool, storage_list> storage_manager::lock_internal(bool shared, storag
             continue;
         }
         auto s = find_entry(e);
-        if(! s || (shared && ! s->lock_shared()) || (! shared && ! s->lock())) {
+        if(! s || (shared && ! s->lock_shared(slot)) || (! shared && ! s->lock())) {
             // failed to lock. In-flight lock will be released by holder.
             return {false, {}};
         }
         holders.reserve(max_held);
-        holders.emplace_back(std::move(s), shared);
+        holders.emplace_back(std::move(s), shared, slot);
         locked_storages.reserve(max_held);
         locked_storages.emplace_back(e);
     }
@@ -221,11 +228,13 @@ bool storage_manager::add_locked_storages(storage_list_view storages, unique_loc
 }
 
 std::unique_ptr<shared_lock> storage_manager::create_shared_lock(storage_list_view storages, unique_lock* parent) {
-    auto [success, list] = lock_internal(true, storages, parent);
+    // the shared lock can be released on other thread, so remember the slot used to acquire it
+    auto slot = impl::distributed_lock::current_slot();
+    auto [success, list] = lock_internal(true, storages, parent, slot);
     if (! success) {
         return {};
     }
-    return std::make_unique<shared_lock>(*this, std::move(list));
+    return std::make_unique<shared_lock>(*this, std::move(list), slot);
 }
 
 std::shared_ptr<impl::storage_control> storage_manager::find_entry(storage_entry entry) {
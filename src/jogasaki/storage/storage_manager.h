@@ -31,6 +31,7 @@
 #include <jogasaki/auth/action_set.h>
 #include <jogasaki/auth/authorized_users_action_set.h>
 #include <jogasaki/request_context.h>
+#include <jogasaki/storage/distributed_lock.h>
 #include <jogasaki/storage/shared_lock.h>
 #include <jogasaki/storage/storage_list.h>
 #include <jogasaki/storage/unique_lock.h>
@@ -46,13 +47,6 @@ inline std::atomic_size_t index_id_src = 100;  //NOLINT(cppcoreguidelines-avoid-
 
 namespace impl {
 
-struct lock_state {
-    bool write_locked:1;
-    std::size_t read_lock_count:63;
-};
-
-static_assert(sizeof(lock_state) == 8);
-
 class cache_align storage_control {
 public:
 
@@ -122,58 +116,58 @@ public:
         return is_primary_;
     }
 
+    /**
+     * @brief try to acquire exclusive lock
+     * @return true if successful
+     * @return false if the lock is held by others
+     */
     bool lock() {
-        auto cur = state_.load();
-        if(cur.read_lock_count != 0 || cur.write_locked) {
-            return false;
-        }
-        auto desired = cur;
-        desired.write_locked = true;
-        return state_.compare_exchange_strong(cur, desired);
+        return lock_.lock();
     }
 
     bool can_lock() {
-        auto cur = state_.load();
-        return cur.read_lock_count == 0 && ! cur.write_locked;
+        return lock_.can_lock();
     }
 
+    /**
+     * @brief try to acquire shared lock counted on the reader slot of the current thread
+     * @return true if successful
+     * @return false if the exclusive lock is held
+     */
     bool lock_shared() {
-        auto cur = state_.load();
-        lock_state desired{};
-        do {
-            if(cur.write_locked) {
-                return false;
-            }
-            desired = cur;
-            ++desired.read_lock_count;
-        } while(! state_.compare_exchange_weak(cur, desired));
-        return true;
+        return lock_.lock_shared(distributed_lock::current_slot());
+    }
+
+    /**
+     * @brief try to acquire shared lock counted on the given reader slot
+     * @param slot the reader slot, which must be passed on release
+     * @return true if successful
+     * @return false if the exclusive lock is held
+     */
+    bool lock_shared(std::size_t slot) {
+        return lock_.lock_shared(slot);
     }
 
     bool can_lock_shared() {
-        return ! state_.load().write_locked;
+        return lock_.can_lock_shared();
     }
 
     void release() {
-        auto cur = state_.load();
-        lock_state desired{};
-        do {
-            assert_with_exception(cur.write_locked, static_cast<bool>(cur.write_locked));
-            assert_with_exception(cur.read_lock_count == 0, static_cast<std::size_t>(cur.read_lock_count));
-            desired = cur;
-            desired.write_locked = false;
-        } while(! state_.compare_exchange_weak(cur, desired));
+        lock_.release();
     }
 
+    /**
+     * @brief release shared lock acquired on the current thread by `lock_shared()`
+     */
     void release_shared() {
-        auto cur = state_.load();
-        lock_state desired{};
-        do {
-            assert_with_exception(! cur.write_locked, static_cast<bool>(cur.write_locked));
-            assert_with_exception(cur.read_lock_count > 0, static_cast<std::size_t>(cur.read_lock_count));
-            desired = cur;
-            --desired.read_lock_count;
-        } while(! state_.compare_exchange_weak(cur, desired));
+        lock_.release_shared(distributed_lock::current_slot());
+    }
+
+    /**
+     * @brief release shared lock acquired on the given reader slot
+     */
+    void release_shared(std::size_t slot) {
+        lock_.release_shared(slot);
     }
 
     /**
@@ -286,7 +280,7 @@ public:
     }
 
 private:
-    std::atomic<lock_state> state_{};
+    distributed_lock lock_{};
     std::optional<std::string> name_{};
     std::string original_name_{};
     std::optional<std::string> storage_key_{};
@@ -459,7 +453,12 @@ private:
     tbb::concurrent_queue<storage_entry> candidate_entries_{};
     std::atomic<std::uint64_t> next_surrogate_id_{1000};
 
-    std::pair<bool, storage_list> lock_internal(bool shared, storage_list_view storages, unique_lock* lock);
+    std::pair<bool, storage_list> lock_internal(
+        bool shared,
+        storage_list_view storages,
+        unique_lock* lock,
+        std::size_t slot = 0
+    );
 };
 
 };
@@ -282,6 +282,11 @@ base_stream::status_type udf_any_sequence_stream::next(
     return status_type::error;
 }
 
+bool udf_any_sequence_stream::ready() {
+    if (!udf_stream_) { return true; }
+    return udf_stream_->ready();
+}
+
 void udf_any_sequence_stream::close() {
     if (udf_stream_) { udf_stream_->close(); }
 }
@@ -70,6 +70,12 @@ class udf_any_sequence_stream : public ::jogasaki::data::any_sequence_stream {
     [[nodiscard]] status_type next(
         any_sequence& seq, std::optional<std::chrono::milliseconds> timeout) override;
 
+    /**
+     * @brief returns whether the next try_next() is expected to return other than not_ready
+     * @details this delegates to the underlying stream, which returns true if it cannot tell the readiness.
+     */
+    [[nodiscard]] bool ready() override;
+
     /**
      * @brief closes the stream and releases associated resources.
      */
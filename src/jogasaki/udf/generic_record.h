@@ -226,6 +226,14 @@ class generic_record_stream {
      */
     [[nodiscard]] virtual status_type next(
         generic_record& record, std::optional<std::chrono::milliseconds> timeout) = 0;
+    /**
+     * @brief returns whether the next try_next() is expected to return other than status_type::not_ready
+     * @details this function can be called from a thread other than the one calling try_next().
+     * The default implementation returns true, which makes the caller fall back to polling try_next().
+     * @return true if the next record, end of stream or error is available, or the stream cannot tell it
+     * @return false if the next record is not yet available
+     */
+    [[nodiscard]] virtual bool ready() { return true; }
     /**
      * @brief closes the stream and releases associated resources.
      */
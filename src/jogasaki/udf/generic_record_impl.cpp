@@ -17,6 +17,8 @@
 #include "generic_record_impl.h"
 
 #include <chrono>
+#include <cstdint>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <memory>
@@ -155,6 +157,55 @@ plugin::udf::runtime_type_kind to_runtime_type_kind(plugin::udf::value_type cons
     }
     return plugin::udf::runtime_type_kind::clob_reference;
 }
+template <class T> void append_raw(std::string& out, T const& value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    char buf[sizeof(T)];  //NOLINT
+    std::memcpy(buf, &value, sizeof(T));
+    out.append(buf, sizeof(T));
+}
+
+void append_bytes(std::string& out, std::string const& value) {
+    append_raw(out, static_cast<std::uint64_t>(value.size()));
+    out.append(value);
+}
+
+void serialize_value(std::string&, std::monostate const&) {}
+void serialize_value(std::string& out, std::string const& v) { append_bytes(out, v); }
+void serialize_value(std::string& out, plugin::udf::bytes_value const& v) { append_bytes(out, v.value); }
+void serialize_value(std::string& out, plugin::udf::decimal_value const& v) {
+    append_bytes(out, v.unscaled_value);
+    append_raw(out, v.exponent);
+}
+void serialize_value(std::string& out, plugin::udf::date_value const& v) { append_raw(out, v.days); }
+void serialize_value(std::string& out, plugin::udf::local_time_value const& v) {
+    append_raw(out, v.nanos);
+}
+void serialize_value(std::string& out, plugin::udf::local_datetime_value const& v) {
+    append_raw(out, v.offset_seconds);
+    append_raw(out, v.nano_adjustment);
+}
+void serialize_value(std::string& out, plugin::udf::offset_datetime_value const& v) {
+    append_raw(out, v.offset_seconds);
+    append_raw(out, v.nano_adjustment);
+    append_raw(out, v.time_zone_offset);
+}
+template <class Ref> void serialize_lob_reference(std::string& out, Ref const& v) {
+    append_raw(out, v.storage_id);
+    append_raw(out, v.object_id);
+    append_raw(out, v.tag);
+    append_raw(out, v.provisioned);
+}
+void serialize_value(std::string& out, plugin::udf::blob_reference_value const& v) {
+    serialize_lob_reference(out, v);
+}
+void serialize_value(std::string& out, plugin::udf::clob_reference_value const& v) {
+    serialize_lob_reference(out, v);
+}
+template <class T, class = std::enable_if_t<std::is_arithmetic_v<T>>>
+void serialize_value(std::string& out, T v) {
+    append_raw(out, v);
+}
+
 } // namespace
 
 namespace plugin::udf {
@@ -246,6 +297,14 @@ std::string generic_record_impl::debug_string() const {
 
 void generic_record_impl::dump(std::ostream& os) const { os << debug_string(); }
 
+void generic_record_impl::serialize_values(std::string& out) const {
+    for (auto const& v : values_) {
+        // the alternative index distinguishes values of different types with the same representation
+        out.push_back(static_cast<char>(v.index()));
+        std::visit([&out](auto const& x) { serialize_value(out, x); }, v);
+    }
+}
+
 std::ostream& operator<<(std::ostream& os, generic_record_impl const& record) {
     return os << record.debug_string();
 }
@@ -421,6 +480,11 @@ generic_record_stream::status_type generic_record_stream_impl::try_next(generic_
     return status_type::not_ready;
 }
 
+bool generic_record_stream_impl::ready() {
+    std::lock_guard lk(mutex_);
+    return !queue_.empty() || eos_;
+}
+
 generic_record_stream::status_type generic_record_stream_impl::next(
     generic_record& record, std::optional<std::chrono::milliseconds> timeout) {
     std::unique_lock lk(mutex_);
@@ -73,6 +73,12 @@ class generic_record_impl : public generic_record {
     void assign_from(generic_record_impl&& other) noexcept;
     [[nodiscard]] std::string debug_string() const;
     void dump(std::ostream& os) const;
+    /**
+     * @brief appends the binary representation of the values to the output
+     * @details the representation is unique for each sequence of typed values, so it can be used as a cache key.
+     * The error information is not included.
+     */
+    void serialize_values(std::string& out) const;
 
   private:
     std::vector<value_type> values_;
@@ -129,6 +135,10 @@ class generic_record_stream_impl final : public generic_record_stream {
     status_type try_next(generic_record& record) override;
     status_type next(
         generic_record& record, std::optional<std::chrono::milliseconds> timeout) override;
+    /**
+     * @brief returns whether the next try_next() returns other than not_ready
+     */
+    [[nodiscard]] bool ready() override;
     [[nodiscard]] std::string debug_string() const;
     friend std::ostream& operator<<(std::ostream& os, generic_record_impl const& record);
 
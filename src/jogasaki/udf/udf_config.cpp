@@ -15,15 +15,20 @@
  */
 #include "udf_config.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 namespace plugin::udf {
 udf_config::udf_config(bool enabled, std::string endpoint, std::string transport, bool secure,
-    std::optional<std::string> grpc_server_endpoint, std::optional<std::size_t> timeout)
+    std::optional<std::string> grpc_server_endpoint, std::optional<std::size_t> timeout,
+    std::vector<std::string> memoized_functions, std::size_t memoize_cache_size)
     : _enabled(enabled), _endpoint(std::move(endpoint)), _transport(std::move(transport)),
-      _secure(secure), _grpc_server_endpoint(std::move(grpc_server_endpoint)), _timeout(timeout) {}
+      _secure(secure), _grpc_server_endpoint(std::move(grpc_server_endpoint)), _timeout(timeout),
+      _memoized_functions(std::move(memoized_functions)), _memoize_cache_size(memoize_cache_size) {}
 
 bool udf_config::enabled() const noexcept { return _enabled; }
 
@@ -38,4 +43,15 @@ bool udf_config::secure() const noexcept { return _secure; }
 
 std::optional<std::size_t> const& udf_config::timeout() const noexcept { return _timeout; }
 
+std::vector<std::string> const& udf_config::memoized_functions() const noexcept {
+    return _memoized_functions;
+}
+
+bool udf_config::memoized(std::string_view function_name) const noexcept {
+    return std::find(_memoized_functions.begin(), _memoized_functions.end(), function_name) !=
+           _memoized_functions.end();
+}
+
+std::size_t udf_config::memoize_cache_size() const noexcept { return _memoize_cache_size; }
+
 } // namespace plugin::udf
@@ -18,17 +18,23 @@
 #include <cstddef>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace plugin::udf {
 
 class udf_config {
   public:
+    static constexpr std::size_t default_memoize_cache_size = 1024;
+
     udf_config() = default;
     udf_config(udf_config const&) = default;
     udf_config(udf_config&&) noexcept = default;
     udf_config(bool enabled, std::string endpoint, std::string transport, bool secure,
         std::optional<std::string> grpc_server_endpoint = std::nullopt,
-        std::optional<std::size_t> timeout = std::nullopt);
+        std::optional<std::size_t> timeout = std::nullopt,
+        std::vector<std::string> memoized_functions = {},
+        std::size_t memoize_cache_size = default_memoize_cache_size);
     udf_config& operator=(udf_config const&) = default;
     udf_config& operator=(udf_config&&) noexcept = default;
     ~udf_config() = default;
@@ -40,6 +46,19 @@ class udf_config {
     [[nodiscard]] bool secure() const noexcept;
     [[nodiscard]] std::optional<std::string> const& grpc_server_endpoint() const noexcept;
     [[nodiscard]] std::optional<std::size_t> const& timeout() const noexcept;
+    /**
+     * @brief returns the names (lower case) of the functions whose results are memoized
+     */
+    [[nodiscard]] std::vector<std::string> const& memoized_functions() const noexcept;
+    /**
+     * @brief returns whether the results of the function are memoized
+     * @param function_name the function name in lower case
+     */
+    [[nodiscard]] bool memoized(std::string_view function_name) const noexcept;
+    /**
+     * @brief returns the maximum number of memoized results for each function
+     */
+    [[nodiscard]] std::size_t memoize_cache_size() const noexcept;
 
   private:
     bool _enabled{true};
@@ -48,6 +67,8 @@ class udf_config {
     bool _secure{false};
     std::optional<std::string> _grpc_server_endpoint{};
     std::optional<std::size_t> _timeout{std::nullopt};
+    std::vector<std::string> _memoized_functions{};
+    std::size_t _memoize_cache_size{default_memoize_cache_size};
 };
 
 } // namespace plugin::udf
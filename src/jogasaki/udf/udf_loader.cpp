@@ -316,8 +316,26 @@ std::optional<udf_config> udf_loader::parse_ini(
         }
         std::optional<std::size_t> timeout{};
         if (auto opt = pt.get_optional<std::size_t>("udf.timeout")) { timeout = *opt; }
+        // comma separated names of the deterministic functions whose results can be memoized
+        std::vector<std::string> memoized_functions{};
+        if (auto opt = pt.get_optional<std::string>("udf.memoize")) {
+            std::istringstream iss{*opt};
+            std::string name{};
+            while (std::getline(iss, name, ',')) {
+                name.erase(0, name.find_first_not_of(" \t"));
+                name.erase(name.find_last_not_of(" \t") + 1);
+                if (name.empty()) { continue; }
+                std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+                memoized_functions.emplace_back(std::move(name));
+            }
+        }
+        std::size_t memoize_cache_size = udf_config::default_memoize_cache_size;
+        if (auto opt = pt.get_optional<std::size_t>("udf.memoize_cache_size")) {
+            memoize_cache_size = *opt;
+        }
         return udf_config(enabled, std::move(endpoint), std::move(transport), secure,
-            std::move(grpc_server_endpoint), timeout);
+            std::move(grpc_server_endpoint), timeout, std::move(memoized_functions),
+            memoize_cache_size);
 
     } catch (std::exception const& e) {
         results.emplace_back(load_status::ini_invalid, ini_path.string(), e.what());
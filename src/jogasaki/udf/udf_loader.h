@@ -112,6 +112,15 @@ class udf_loader : public plugin_loader {
      * @return Reference to a vector of plugin entries.
      */
     [[nodiscard]] std::vector<plugin_entry>& get_plugins() noexcept override;
+    /**
+     * @brief Parses the plugin configuration ini file.
+     *
+     * @param ini_path Path to the ini file accompanying the plugin.
+     * @param results Receives the `ini_invalid` result if the file is invalid.
+     * @return The configuration, or `std::nullopt` if the file is invalid.
+     */
+    [[nodiscard]] static std::optional<udf_config> parse_ini(
+        std::filesystem::path const& ini_path, std::vector<load_result>& results);
 
   private:
     void load_one_plugin(std::filesystem::path const& ini_path,
@@ -121,8 +130,6 @@ class udf_loader : public plugin_loader {
     /** List of raw `dlopen()` handles for loaded plugins. */
     [[nodiscard]] load_result create_api_from_handle(
         void* handle, std::string const& full_path, std::shared_ptr<const udf_config> cfg);
-    [[nodiscard]] std::optional<udf_config> parse_ini(
-        std::filesystem::path const& ini_path, std::vector<load_result>& results);
     /** List of loaded plugin API/client pairs. */
     std::vector<plugin_entry> plugins_;
     std::vector<void*> handles_;
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "udf_result_cache.h"
+
+#include <utility>
+#include <glog/logging.h>
+
+#include <jogasaki/logging.h>
+#include <jogasaki/logging_helper.h>
+#include <jogasaki/udf/log/logging_prefix.h>
+
+namespace plugin::udf {
+
+using jogasaki::location_prefix;
+
+udf_result_cache::udf_result_cache(std::string function_name, std::size_t capacity)
+    : function_name_(std::move(function_name)), capacity_(capacity) {}
+
+udf_result_cache::~udf_result_cache() { report(); }
+
+udf_result_cache::value_type udf_result_cache::find(std::string_view key) {
+    value_type ret{};
+    bool report_now = false;
+    {
+        std::lock_guard lk(mutex_);
+        if (auto it = index_.find(key); it != index_.end()) {
+            // move to the front as the most recently used
+            entries_.splice(entries_.begin(), entries_, it->second);
+            ++hits_;
+            ret = it->second->value_;
+        } else {
+            ++misses_;
+        }
+        // the counters are updated only under the lock, so exactly one lookup reaches each interval
+        report_now = (hits() + misses()) % report_interval == 0;
+    }
+    if (report_now) { report(); }
+    return ret;
+}
+
+void udf_result_cache::report() const {
+    VLOG_LP(jogasaki::log_info) << jogasaki::udf::log::prefix << "memoization of '" << function_name_
+                                << "' hits=" << hits() << ", misses=" << misses();
+}
+
+void udf_result_cache::put(std::string_view key, value_type value) {
+    if (capacity_ == 0) { return; }
+    std::lock_guard lk(mutex_);
+    if (auto it = index_.find(key); it != index_.end()) {
+        // another thread put the same key concurrently
+        it->second->value_ = std::move(value);
+        return;
+    }
+    if (entries_.size() >= capacity_) {
+        index_.erase(entries_.back().key_);
+        entries_.pop_back();
+    }
+    entries_.push_front(entry{std::string{key}, std::move(value)});
+    index_.emplace(entries_.front().key_, entries_.begin());
+}
+
+std::size_t udf_result_cache::hits() const noexcept { return hits_.load(); }
+
+std::size_t udf_result_cache::misses() const noexcept { return misses_.load(); }
+
+std::size_t udf_result_cache::size() const {
+    std::lock_guard lk(mutex_);
+    return entries_.size();
+}
+
+} // namespace plugin::udf
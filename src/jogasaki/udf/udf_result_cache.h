@@ -0,0 +1,108 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "generic_record_impl.h"
+
+namespace plugin::udf {
+
+/**
+ * @brief bounded cache of scalar UDF responses keyed by the serialized request
+ * @details this is used to memoize the calls of the deterministic functions declared in the UDF configuration.
+ * The least recently used entry is evicted when the cache is full. Only successful responses are cached.
+ * The hit/miss counts are logged every `report_interval` lookups and on destruction.
+ * @note this object is thread-safe
+ */
+class udf_result_cache {
+  public:
+    using value_type = std::shared_ptr<generic_record_impl const>;
+
+    /**
+     * @brief the number of lookups between the logs of the hit/miss counts
+     */
+    static constexpr std::size_t report_interval = 100'000;
+
+    /**
+     * @brief create new object
+     * @param function_name the function name used for logging
+     * @param capacity the maximum number of entries
+     */
+    udf_result_cache(std::string function_name, std::size_t capacity);
+
+    ~udf_result_cache();
+
+    udf_result_cache(udf_result_cache const&) = delete;
+    udf_result_cache& operator=(udf_result_cache const&) = delete;
+    udf_result_cache(udf_result_cache&&) = delete;
+    udf_result_cache& operator=(udf_result_cache&&) = delete;
+
+    /**
+     * @brief find the cached response
+     * @param key the serialized request
+     * @return the response, or nullptr if not cached
+     */
+    [[nodiscard]] value_type find(std::string_view key);
+
+    /**
+     * @brief put the response into the cache
+     * @param key the serialized request
+     * @param value the response
+     */
+    void put(std::string_view key, value_type value);
+
+    /**
+     * @brief accessor to the number of cache hits
+     */
+    [[nodiscard]] std::size_t hits() const noexcept;
+
+    /**
+     * @brief accessor to the number of cache misses
+     */
+    [[nodiscard]] std::size_t misses() const noexcept;
+
+    /**
+     * @brief accessor to the number of cached entries
+     */
+    [[nodiscard]] std::size_t size() const;
+
+  private:
+    void report() const;
+
+    struct entry {
+        std::string key_{};
+        value_type value_{};
+    };
+
+    std::string function_name_{};
+    std::size_t capacity_{};
+    std::list<entry> entries_{};
+    // keys refer to the strings in entries_, whose addresses are stable
+    std::unordered_map<std::string_view, std::list<entry>::iterator> index_{};
+    mutable std::mutex mutex_{};
+    std::atomic_size_t hits_{};
+    std::atomic_size_t misses_{};
+};
+
+} // namespace plugin::udf
@@ -17,9 +17,13 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <initializer_list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include <tateyama/framework/boot_mode.h>
@@ -32,12 +36,25 @@
 #include <tateyama/proto/kvs/request.pb.h>
 #include <tateyama/proto/kvs/response.pb.h>
 #include <tateyama/proto/kvs/transaction.pb.h>
+#include <sharksfin/StatusCode.h>
+#include <sharksfin/TransactionOptions.h>
+#include <sharksfin/api.h>
 
+#include <jogasaki/api/kvsservice/put_option.h>
+#include <jogasaki/api/kvsservice/remove_option.h>
 #include <jogasaki/api/kvsservice/resource.h>
 #include <jogasaki/api/kvsservice/service.h>
+#include <jogasaki/api/kvsservice/scan_bound.h>
+#include <jogasaki/api/kvsservice/status.h>
+#include <jogasaki/api/kvsservice/transaction.h>
 #include <jogasaki/api/resource/bridge.h>
 #include <jogasaki/api/service/bridge.h>
+#include <jogasaki/kvs/database.h>
+#include <jogasaki/meta/field_type_kind.h>
+#include <jogasaki/mock/basic_record.h>
+#include <jogasaki/test_utils/secondary_index.h>
 
+#include "../api_test_base.h"
 #include "test_utils.h"
 
 namespace jogasaki::api::kvsservice {
@@ -225,4 +242,310 @@ TEST_F(kvx_tx_test, DISABLED_tx_check) {
     EXPECT_NE(tx(loopback), 0);
     EXPECT_TRUE(sv.shutdown());
 }
+
+using record = tateyama::proto::kvs::data::Record;
+using kind = meta::field_type_kind;
+using jogasaki::api::impl::get_impl;
+
+/**
+ * @brief test kvsservice::transaction directly on the database, verifying the results with SQL
+ */
+class kvs_transaction_test :
+    public ::testing::Test,
+    public jogasaki::testing::api_test_base {
+public:
+    void SetUp() override {
+        auto cfg = std::make_shared<configuration>();
+        db_setup(cfg);
+        execute_statement("CREATE TABLE T (C0 BIGINT, C1 BIGINT, C2 BIGINT, PRIMARY KEY(C0, C1))");
+    }
+
+    void TearDown() override {
+        db_teardown();
+    }
+
+    std::unique_ptr<transaction> begin() {
+        sharksfin::TransactionControlHandle handle{};
+        sharksfin::TransactionOptions options{sharksfin::TransactionOptions::TransactionType::SHORT, {}};
+        auto code = sharksfin::transaction_begin(db_impl()->kvs_db()->handle(), options, &handle);
+        EXPECT_EQ(sharksfin::StatusCode::OK, code);
+        return std::make_unique<transaction>(db_.get(), handle);
+    }
+
+    void commit(transaction& tx) {
+        ASSERT_EQ(status::ok, tx.commit());
+        ASSERT_EQ(status::ok, tx.dispose());
+    }
+
+    void put_records(std::vector<record> const& recs, std::string_view table = "T") {
+        google::protobuf::RepeatedPtrField<record> records{recs.begin(), recs.end()};
+        auto tx = begin();
+        std::size_t written{};
+        ASSERT_EQ(status::ok, tx->put(table, records, put_option::create_or_update, written));
+        ASSERT_EQ(recs.size(), written);
+        commit(*tx);
+    }
+
+    std::vector<std::int64_t> scan_keys(
+        transaction& tx,
+        record const& lower_key,
+        scan_bound lower_bound,
+        record const& upper_key,
+        scan_bound upper_bound,
+        bool reverse = false
+    ) {
+        std::vector<std::int64_t> ret{};
+        auto s = tx.scan("T", lower_key, lower_bound, upper_key, upper_bound, [&](record& r) {
+            ret.emplace_back(value_of(r, "C0") * 10 + value_of(r, "C1"));
+            return status::ok;
+        }, reverse);
+        EXPECT_EQ(status::ok, s);
+        return ret;
+    }
+
+    void remove_records(std::vector<record> const& keys, std::string_view table = "T") {
+        google::protobuf::RepeatedPtrField<record> primary_keys{keys.begin(), keys.end()};
+        auto tx = begin();
+        std::size_t removed{};
+        ASSERT_EQ(status::ok, tx->remove(table, primary_keys, remove_option::counting, removed));
+        ASSERT_EQ(keys.size(), removed);
+        commit(*tx);
+    }
+
+    void create_table_with_secondary() {
+        execute_statement("CREATE TABLE S (C0 BIGINT PRIMARY KEY, C1 BIGINT, C2 BIGINT)");
+        execute_statement("CREATE INDEX I ON S(C1)");
+    }
+
+    // returns pairs of the secondary key (C1) and the primary key (C0) stored on the secondary index I
+    std::vector<std::pair<mock::basic_record, mock::basic_record>> secondary_entries() {
+        return utils::get_secondary_entries(
+            *get_impl(*db_).kvs_db(),
+            *get_impl(*db_).tables()->find_index("S"),
+            *get_impl(*db_).tables()->find_index("I"),
+            mock::create_nullable_record<kind::int8>(),
+            mock::create_nullable_record<kind::int8>()
+        );
+    }
+
+    // read through the secondary index
+    std::vector<mock::basic_record> find_by_c1(std::int64_t c1) {
+        std::vector<mock::basic_record> result{};
+        execute_query("SELECT C0, C1, C2 FROM S WHERE C1 = " + std::to_string(c1) + " ORDER BY C0", result);
+        return result;
+    }
+
+    static std::int64_t value_of(record const& r, std::string_view name) {
+        for(int i=0; i < r.names_size(); ++i) {
+            if(r.names(i) == name) {
+                return r.values(i).int8_value();
+            }
+        }
+        ADD_FAILURE() << "column not found:" << name;
+        return -1;
+    }
+};
+
+record create_record(std::initializer_list<std::pair<std::string_view, std::int64_t>> columns) {
+    record ret{};
+    for(auto&& [name, value] : columns) {
+        ret.add_names(std::string{name});
+        ret.add_values()->set_int8_value(value);
+    }
+    return ret;
+}
+
+record create_key(std::int64_t c0, std::int64_t c1) {
+    return create_record({{"C0", c0}, {"C1", c1}});
+}
+
+record create_row(std::int64_t c0, std::int64_t c1, std::int64_t c2) {
+    return create_record({{"C0", c0}, {"C1", c1}, {"C2", c2}});
+}
+
+TEST_F(kvs_transaction_test, put_get_remove_multiple_records) {
+    put_records({create_row(1, 1, 100), create_row(1, 2, 200), create_row(2, 1, 300)});
+    {
+        std::vector<mock::basic_record> result{};
+        execute_query("SELECT C0, C1, C2 FROM T ORDER BY C0, C1", result);
+        ASSERT_EQ(3, result.size());
+        EXPECT_EQ((mock::create_nullable_record<kind::int8, kind::int8, kind::int8>(1, 1, 100)), result[0]);
+        EXPECT_EQ((mock::create_nullable_record<kind::int8, kind::int8, kind::int8>(1, 2, 200)), result[1]);
+        EXPECT_EQ((mock::create_nullable_record<kind::int8, kind::int8, kind::int8>(2, 1, 300)), result[2]);
+    }
+    {
+        // missing keys are omitted, and the others are returned in the key order of the request
+        std::vector<record> keys{create_key(2, 1), create_key(9, 9), create_key(1, 1)};
+        google::protobuf::RepeatedPtrField<record> primary_keys{keys.begin(), keys.end()};
+        google::protobuf::RepeatedPtrField<record> records{};
+        auto tx = begin();
+        ASSERT_EQ(status::ok, tx->get("T", primary_keys, records));
+        ASSERT_EQ(2, records.size());
+        EXPECT_EQ(300, value_of(records.Get(0), "C2"));
+        EXPECT_EQ(100, value_of(records.Get(1), "C2"));
+        commit(*tx);
+    }
+    {
+        // existing record is skipped with put_option::create and not counted
+        std::vector<record> recs{create_row(1, 1, 999), create_row(3, 1, 400)};
+        google::protobuf::RepeatedPtrField<record> records{recs.begin(), recs.end()};
+        auto tx = begin();
+        std::size_t written{};
+        ASSERT_EQ(status::ok, tx->put("T", records, put_option::create, written));
+        EXPECT_EQ(1, written);
+        commit(*tx);
+    }
+    {
+        std::vector<record> keys{create_key(1, 2), create_key(9, 9), create_key(3, 1)};
+        google::protobuf::RepeatedPtrField<record> primary_keys{keys.begin(), keys.end()};
+        auto tx = begin();
+        std::size_t removed{};
+        ASSERT_EQ(status::ok, tx->remove("T", primary_keys, remove_option::counting, removed));
+        EXPECT_EQ(2, removed);
+        commit(*tx);
+    }
+    {
+        std::vector<mock::basic_record> result{};
+        execute_query("SELECT C0, C1, C2 FROM T ORDER BY C0, C1", result);
+        ASSERT_EQ(2, result.size());
+        EXPECT_EQ((mock::create_nullable_record<kind::int8, kind::int8, kind::int8>(1, 1, 100)), result[0]);
+        EXPECT_EQ((mock::create_nullable_record<kind::int8, kind::int8, kind::int8>(2, 1, 300)), result[1]);
+    }
+}
+
+TEST_F(kvs_transaction_test, put_fails_in_the_middle_of_batch) {
+    // the record missing C2 fails after the first one is written, and the transaction is aborted
+    std::vector<record> recs{create_row(1, 1, 100), create_record({{"C0", 2}, {"C1", 1}}), create_row(3, 1, 300)};
+    google::protobuf::RepeatedPtrField<record> records{recs.begin(), recs.end()};
+    auto tx = begin();
+    std::size_t written{};
+    EXPECT_EQ(status::err_incomplete_columns, tx->put("T", records, put_option::create_or_update, written));
+    EXPECT_EQ(1, written);
+    record out{};
+    EXPECT_EQ(status::err_inactive_transaction, tx->get("T", create_key(1, 1), out));
+    EXPECT_EQ(status::err_inactive_transaction, tx->commit());
+    ASSERT_EQ(status::ok, tx->dispose());
+
+    std::vector<mock::basic_record> result{};
+    execute_query("SELECT C0, C1, C2 FROM T", result);
+    EXPECT_EQ(0, result.size());
+}
+
+TEST_F(kvs_transaction_test, remove_fails_in_the_middle_of_batch) {
+    put_records({create_row(1, 1, 100), create_row(2, 1, 200)});
+    // the key missing C1 fails after the first one is removed, and the transaction is aborted
+    std::vector<record> keys{create_key(1, 1), create_record({{"C0", 2}})};
+    google::protobuf::RepeatedPtrField<record> primary_keys{keys.begin(), keys.end()};
+    auto tx = begin();
+    std::size_t removed{};
+    EXPECT_EQ(status::err_mismatch_key, tx->remove("T", primary_keys, remove_option::counting, removed));
+    EXPECT_EQ(1, removed);
+    EXPECT_EQ(status::err_inactive_transaction, tx->commit());
+    ASSERT_EQ(status::ok, tx->dispose());
+
+    std::vector<mock::basic_record> result{};
+    execute_query("SELECT C0, C1, C2 FROM T", result);
+    EXPECT_EQ(2, result.size());
+}
+
+TEST_F(kvs_transaction_test, scan_bounds) {
+    put_records({
+        create_row(1, 1, 0), create_row(1, 2, 0), create_row(2, 1, 0), create_row(2, 2, 0), create_row(3, 1, 0)
+    });
+    auto tx = begin();
+    record none{};
+    using v = std::vector<std::int64_t>;
+    EXPECT_EQ((v{11, 12, 21, 22, 31}), scan_keys(*tx, none, scan_bound::unbound, none, scan_bound::unbound));
+    EXPECT_EQ((v{31, 22, 21, 12, 11}), scan_keys(*tx, none, scan_bound::unbound, none, scan_bound::unbound, true));
+    EXPECT_EQ((v{12, 21, 22}), scan_keys(*tx,
+        create_key(1, 2), scan_bound::inclusive, create_record({{"C0", 3}}), scan_bound::exclusive));
+    EXPECT_EQ((v{21}), scan_keys(*tx,
+        create_key(1, 2), scan_bound::exclusive, create_key(2, 2), scan_bound::exclusive));
+    // the key prefix covers all entries with the same leading columns
+    EXPECT_EQ((v{21, 22}), scan_keys(*tx,
+        create_record({{"C0", 1}}), scan_bound::exclusive, create_record({{"C0", 2}}), scan_bound::inclusive));
+    EXPECT_EQ((v{22, 21}), scan_keys(*tx,
+        create_record({{"C0", 2}}), scan_bound::inclusive, create_record({{"C0", 2}}), scan_bound::inclusive, true));
+    EXPECT_EQ((v{}), scan_keys(*tx,
+        create_record({{"C0", 4}}), scan_bound::inclusive, none, scan_bound::unbound));
+    commit(*tx);
+}
+
+TEST_F(kvs_transaction_test, scan_stopped_by_consumer) {
+    put_records({create_row(1, 1, 0), create_row(2, 1, 0), create_row(3, 1, 0)});
+    auto tx = begin();
+    record none{};
+    std::size_t count{};
+    auto s = tx->scan("T", none, scan_bound::unbound, none, scan_bound::unbound, [&](record&) {
+        // the transaction mutex is not held while the consumer runs
+        std::unique_lock<std::mutex> lock{tx->transaction_mutex(), std::try_to_lock};
+        EXPECT_TRUE(lock.owns_lock());
+        return ++count < 2 ? status::ok : status::err_resource_limit_reached;
+    });
+    EXPECT_EQ(status::err_resource_limit_reached, s);
+    EXPECT_EQ(2, count);
+    commit(*tx);
+}
+
+TEST_F(kvs_transaction_test, scan_invalid_end_point) {
+    // the end point key must be a leading part of the primary key
+    auto tx = begin();
+    record none{};
+    auto s = tx->scan("T", create_record({{"C1", 1}}), scan_bound::inclusive, none, scan_bound::unbound, [](record&) {
+        return status::ok;
+    });
+    EXPECT_EQ(status::err_invalid_argument, s);
+    commit(*tx);
+}
+
+TEST_F(kvs_transaction_test, put_creates_secondary_entries) {
+    create_table_with_secondary();
+    put_records({
+        create_record({{"C0", 1}, {"C1", 10}, {"C2", 100}}),
+        create_record({{"C0", 2}, {"C1", 20}, {"C2", 200}})
+    }, "S");
+    {
+        auto result = find_by_c1(10);
+        ASSERT_EQ(1, result.size());
+        EXPECT_EQ((mock::create_nullable_record<kind::int8, kind::int8, kind::int8>(1, 10, 100)), result[0]);
+    }
+    auto entries = secondary_entries();
+    ASSERT_EQ(2, entries.size());
+    EXPECT_EQ((mock::create_nullable_record<kind::int8>(10)), entries[0].first);
+    EXPECT_EQ((mock::create_nullable_record<kind::int8>(1)), entries[0].second);
+    EXPECT_EQ((mock::create_nullable_record<kind::int8>(20)), entries[1].first);
+    EXPECT_EQ((mock::create_nullable_record<kind::int8>(2)), entries[1].second);
+}
+
+TEST_F(kvs_transaction_test, replace_moves_secondary_entry) {
+    // overwriting the record with the different index key removes the old secondary entry and creates new one
+    create_table_with_secondary();
+    put_records({create_record({{"C0", 1}, {"C1", 10}, {"C2", 100}})}, "S");
+    put_records({create_record({{"C0", 1}, {"C1", 11}, {"C2", 101}})}, "S");
+    EXPECT_EQ(0, find_by_c1(10).size());
+    {
+        auto result = find_by_c1(11);
+        ASSERT_EQ(1, result.size());
+        EXPECT_EQ((mock::create_nullable_record<kind::int8, kind::int8, kind::int8>(1, 11, 101)), result[0]);
+    }
+    auto entries = secondary_entries();
+    ASSERT_EQ(1, entries.size());
+    EXPECT_EQ((mock::create_nullable_record<kind::int8>(11)), entries[0].first);
+    EXPECT_EQ((mock::create_nullable_record<kind::int8>(1)), entries[0].second);
+}
+
+TEST_F(kvs_transaction_test, remove_deletes_secondary_entry) {
+    create_table_with_secondary();
+    put_records({
+        create_record({{"C0", 1}, {"C1", 10}, {"C2", 100}}),
+        create_record({{"C0", 2}, {"C1", 20}, {"C2", 200}})
+    }, "S");
+    remove_records({create_record({{"C0", 1}})}, "S");
+    EXPECT_EQ(0, find_by_c1(10).size());
+    EXPECT_EQ(1, find_by_c1(20).size());
+    auto entries = secondary_entries();
+    ASSERT_EQ(1, entries.size());
+    EXPECT_EQ((mock::create_nullable_record<kind::int8>(20)), entries[0].first);
+    EXPECT_EQ((mock::create_nullable_record<kind::int8>(2)), entries[0].second);
+}
 }
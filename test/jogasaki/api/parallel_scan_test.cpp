@@ -254,4 +254,57 @@ TEST_F(parallel_scan_test, count_rtx_parallel_pivot_3) {
     EXPECT_EQ((create_nullable_record<kind::int8>(1000)), result[0]) << "Failed query: " << query2;
     ASSERT_EQ(status::ok, tx->commit());
 }
+TEST_F(parallel_scan_test, split_range_at_runtime) {
+    // uniform pivots place almost all records in the first range, which is split and handed to the other tasks
+    execute_statement("CREATE TABLE t (c0 int primary key)");
+    std::ostringstream query;
+    query << "insert into t values ";
+    for (int i = 1; i <= 1000; ++i) {
+        if (i > 1) { query << ", "; }
+        query << "(" << i << ")";
+    }
+    query << ", (1000000000)";
+    execute_statement(query.str());
+    auto cfg = std::make_shared<configuration>();
+    cfg->scan_default_parallel(4);
+    cfg->key_distribution(key_distribution_kind::uniform);
+    cfg->enable_scan_range_split(true);
+    cfg->scan_block_size(1);
+    cfg->scan_yield_interval(0);
+    global::config_pool(cfg);
+    auto tx = utils::create_transaction(*db_, true, false);
+    std::vector<mock::basic_record> result{};
+    execute_query("SELECT COUNT(c0) FROM t", *tx, result);
+    ASSERT_EQ(1, result.size());
+    EXPECT_EQ((create_nullable_record<kind::int8>(1001)), result[0]);
+    ASSERT_EQ(status::ok, tx->commit());
+}
+
+TEST_F(parallel_scan_test, split_range_rows) {
+    // verify each row is read exactly once by the tasks splitting and taking the ranges
+    execute_statement("CREATE TABLE t (c0 int primary key)");
+    std::ostringstream query;
+    query << "insert into t values ";
+    for (int i = 1; i <= 1000; ++i) {
+        if (i > 1) { query << ", "; }
+        query << "(" << i << ")";
+    }
+    query << ", (1000000000)";
+    execute_statement(query.str());
+    auto cfg = std::make_shared<configuration>();
+    cfg->scan_default_parallel(4);
+    cfg->key_distribution(key_distribution_kind::uniform);
+    cfg->enable_scan_range_split(true);
+    cfg->scan_block_size(1);
+    cfg->scan_yield_interval(0);
+    global::config_pool(cfg);
+    auto tx = utils::create_transaction(*db_, true, false);
+    std::vector<mock::basic_record> result{};
+    execute_query("SELECT c0 FROM t", *tx, result);
+    ASSERT_EQ(1001, result.size());
+    std::sort(result.begin(), result.end());
+    EXPECT_EQ((create_nullable_record<kind::int4>(1)), result[0]);
+    EXPECT_EQ((create_nullable_record<kind::int4>(1000000000)), result[1000]);
+    ASSERT_EQ(status::ok, tx->commit());
+}
 } // namespace jogasaki::testing
@@ -100,6 +100,12 @@ public:
     }
 
     std::unordered_set<std::int32_t> get_secondary_entries(std::string_view index_name, std::optional<std::int32_t> c1);
+
+    // returns the int4 column covered by the secondary index, for each entry in the secondary key order
+    std::vector<std::optional<std::int32_t>> get_covered_values(std::string_view index_name);
+
+    // overwrite the values of all the secondary index entries with empty value
+    void clear_secondary_values(std::string_view index_name);
 };
 
 
@@ -341,6 +347,46 @@ TEST_F(secondary_index_dml_test, insert_or_skip_wont_update_secondary_index_on_d
     }
 }
 
+TEST_F(secondary_index_dml_test, covering_index_update_covered_column) {
+    execute_statement("CREATE TABLE T (C0 INT NOT NULL PRIMARY KEY, C1 INT, C2 INT)");
+    // DDL has no syntax for covered columns, so create the index storing C2 directly
+    utils::create_secondary_index(*db_impl(), "I", "T", {1}, {2});
+    execute_statement("INSERT INTO T VALUES(1,10,100)");
+    execute_statement("INSERT INTO T VALUES(2,20,200)");
+    EXPECT_EQ((std::vector<std::optional<std::int32_t>>{100, 200}), get_covered_values("I"));
+
+    execute_statement("UPDATE T SET C2=300 WHERE C0=1");
+    execute_statement("UPDATE T SET C2=NULL WHERE C0=2");
+    EXPECT_EQ((std::vector<std::optional<std::int32_t>>{300, std::nullopt}), get_covered_values("I"));
+    {
+        std::vector<mock::basic_record> result{};
+        execute_query("SELECT C0, C1, C2 FROM T WHERE C1=10", result);
+        ASSERT_EQ(1, result.size());
+        EXPECT_EQ((create_nullable_record<kind::int4, kind::int4, kind::int4>(1, 10, 300)), result[0]);
+    }
+    {
+        std::vector<mock::basic_record> result{};
+        execute_query("SELECT C0, C1, C2 FROM T WHERE C1=20", result);
+        ASSERT_EQ(1, result.size());
+        EXPECT_EQ((create_nullable_record<kind::int4, kind::int4, kind::int4>(2, 20, std::nullopt)), result[0]);
+    }
+}
+
+TEST_F(secondary_index_dml_test, covering_index_empty_value_falls_back_to_primary) {
+    // entries written without covered columns are read through the primary index
+    execute_statement("CREATE TABLE T (C0 INT NOT NULL PRIMARY KEY, C1 INT, C2 INT)");
+    utils::create_secondary_index(*db_impl(), "I", "T", {1}, {2});
+    execute_statement("INSERT INTO T VALUES(1,10,100)");
+    execute_statement("INSERT INTO T VALUES(2,20,200)");
+    clear_secondary_values("I");
+    EXPECT_EQ((std::vector<std::optional<std::int32_t>>{}), get_covered_values("I"));
+
+    std::vector<mock::basic_record> result{};
+    execute_query("SELECT C0, C1, C2 FROM T WHERE C1=10", result);
+    ASSERT_EQ(1, result.size());
+    EXPECT_EQ((create_nullable_record<kind::int4, kind::int4, kind::int4>(1, 10, 100)), result[0]);
+}
+
 std::unordered_set<std::int32_t> secondary_index_dml_test::get_secondary_entries(std::string_view index_name, std::optional<std::int32_t> secondary_key) {
     auto table = utils::get_storage_by_index_name("T");
     auto index = utils::get_storage_by_index_name(index_name);
@@ -432,4 +478,62 @@ std::unordered_set<std::int32_t> secondary_index_dml_test::get_secondary_entries
     }
 }
 
+std::vector<std::optional<std::int32_t>> secondary_index_dml_test::get_covered_values(std::string_view index_name) {
+    auto index = utils::get_storage_by_index_name(index_name);
+    std::vector<std::optional<std::int32_t>> ret{};
+    auto tx = wrap(get_impl(*db_).kvs_db()->create_transaction());
+    std::unique_ptr<kvs::iterator> it{};
+    if(status::ok != index->content_scan(*tx->object(), "", end_point_kind::unbound, "", end_point_kind::unbound, it)) {
+        fail();
+    }
+    while(status::ok == it->next()) {
+        std::string_view value{};
+        if(status::ok != it->read_value(value)) {
+            fail();
+        }
+        if(value.empty()) {
+            continue;
+        }
+        kvs::readable_stream stream{value.data(), value.size()};
+        kvs::coding_context ctx{};
+        data::any out{};
+        if(status::ok != kvs::decode_nullable(stream, meta::int4_type(), kvs::spec_value, ctx, out)) {
+            fail();
+        }
+        ret.emplace_back(out.empty() ? std::nullopt : std::optional<std::int32_t>{out.to<std::int32_t>()});
+    }
+    it.reset();
+    if(status::ok != tx->commit()) {
+        fail();
+    }
+    return ret;
+}
+
+void secondary_index_dml_test::clear_secondary_values(std::string_view index_name) {
+    auto index = utils::get_storage_by_index_name(index_name);
+    auto tx = wrap(get_impl(*db_).kvs_db()->create_transaction());
+    std::vector<std::string> keys{};
+    {
+        std::unique_ptr<kvs::iterator> it{};
+        if(status::ok != index->content_scan(*tx->object(), "", end_point_kind::unbound, "", end_point_kind::unbound, it)) {
+            fail();
+        }
+        while(status::ok == it->next()) {
+            std::string_view key{};
+            if(status::ok != it->read_key(key)) {
+                fail();
+            }
+            keys.emplace_back(key);
+        }
+    }
+    for(auto&& key : keys) {
+        if(status::ok != index->content_put(*tx->object(), key, "")) {
+            fail();
+        }
+    }
+    if(status::ok != tx->commit()) {
+        fail();
+    }
+}
+
 }
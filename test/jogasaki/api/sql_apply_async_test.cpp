@@ -370,4 +370,85 @@ TEST_F(sql_apply_async_test, double_apply_with_not_ready) {
     EXPECT_EQ((create_nullable_record<kind::int4, kind::int4, kind::int4>(1, 2, 2)), result[3]);
 }
 
+/**
+ * @brief verify that the apply operator parks the task until the stream reports readiness.
+ * @details the stream returns not_ready until ready() returns true, which happens on its 3rd call:
+ *   - 1st ready() call is by the apply operator, which then parks the task with the wake-up condition.
+ *   - 2nd and 3rd calls are by the scheduler checking the condition, and the task is resumed after the 3rd.
+ *
+ * try_next is called 3 times: row 1, not_ready, and end_of_stream after the task is resumed.
+ */
+TEST_F(sql_apply_async_test, wake_up_on_ready) {
+    execute_statement("CREATE TABLE T (C0 INT PRIMARY KEY)");
+    execute_statement("INSERT INTO T VALUES (1)");
+
+    auto try_next_count = std::make_shared<std::atomic_int>(0);
+    auto ready_count = std::make_shared<std::atomic_int>(0);
+    auto data_arrived = std::make_shared<std::atomic_bool>(false);
+
+    constexpr std::size_t tvf_id = 12203;
+
+    auto decl = global::regular_function_provider()->add(
+        std::make_shared<yugawara::function::declaration>(
+            tvf_id,
+            "tvf_wake_up",
+            std::make_shared<t::table>(std::initializer_list<t::table::column_type>{
+                {"c1", std::make_shared<t::int4>()},
+            }),
+            std::vector<std::shared_ptr<takatori::type::data const>>{
+                std::make_shared<t::int4>(),
+            },
+            yugawara::function::declaration::feature_set_type{
+                yugawara::function::function_feature::table_valued_function
+            }
+        )
+    );
+    registered_decls_.emplace_back(decl);
+
+    global::table_valued_function_repository().add(
+        tvf_id,
+        std::make_shared<table_valued_function_info>(
+            table_valued_function_kind::builtin,
+            [try_next_count, ready_count, data_arrived](
+                evaluator_context& /* ctx */,
+                sequence_view<data::any> /* args */
+            ) -> std::unique_ptr<data::any_sequence_stream> {
+                return std::make_unique<custom_any_sequence_stream>(
+                    [try_next_count, data_arrived](data::any_sequence& seq)
+                        -> data::any_sequence_stream::status_type {
+                        if (try_next_count->fetch_add(1) == 0) {
+                            seq = data::any_sequence{data::any_sequence::storage_type{
+                                data::any{std::in_place_type<std::int32_t>, std::int32_t{1}}
+                            }};
+                            return data::any_sequence_stream::status_type::ok;
+                        }
+                        if (! data_arrived->load()) {
+                            return data::any_sequence_stream::status_type::not_ready;
+                        }
+                        return data::any_sequence_stream::status_type::end_of_stream;
+                    },
+                    [ready_count, data_arrived]() {
+                        if (ready_count->fetch_add(1) + 1 >= 3) {
+                            data_arrived->store(true);
+                        }
+                        return data_arrived->load();
+                    }
+                );
+            },
+            1,
+            table_valued_function_info::columns_type{
+                table_valued_function_column{"c1"}
+            }
+        )
+    );
+
+    std::vector<mock::basic_record> result{};
+    execute_query("SELECT R.c1 FROM T CROSS APPLY tvf_wake_up(T.C0) AS R(c1)", result);
+
+    EXPECT_EQ(3, ready_count->load());
+    EXPECT_EQ(3, try_next_count->load());
+    ASSERT_EQ(1, result.size());
+    EXPECT_EQ((create_nullable_record<kind::int4>(1)), result[0]);
+}
+
 }  // namespace jogasaki::testing
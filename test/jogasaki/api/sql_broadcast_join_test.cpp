@@ -0,0 +1,139 @@
+/*
+ * Copyright 2018-2025 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <jogasaki/configuration.h>
+#include <jogasaki/meta/field_type_kind.h>
+#include <jogasaki/mock/basic_record.h>
+
+#include "api_test_base.h"
+
+namespace jogasaki::testing {
+
+using namespace std::literals::string_literals;
+using namespace std::string_view_literals;
+using namespace jogasaki;
+using namespace jogasaki::meta;
+using namespace jogasaki::mock;
+
+using kind = meta::field_type_kind;
+
+/**
+ * @brief compare the join results with broadcast join enabled and disabled
+ * @details the join keys are non-key columns so that the join without broadcast is done by cogroup,
+ * not by join_find on the index
+ */
+class sql_broadcast_join_test :
+    public ::testing::Test,
+    public api_test_base {
+
+public:
+    // change this flag to debug with explain
+    bool to_explain() override {
+        return false;
+    }
+
+    void SetUp() override {}
+
+    void TearDown() override {}
+
+    /**
+     * @brief set up the database, run the statements and the query, and return the sorted result
+     */
+    std::vector<mock::basic_record> run(
+        bool broadcast,
+        std::vector<std::string> const& statements,
+        std::string_view query
+    );
+};
+
+std::vector<mock::basic_record> sql_broadcast_join_test::run(
+    bool broadcast,
+    std::vector<std::string> const& statements,
+    std::string_view query
+) {
+    auto cfg = std::make_shared<configuration>();
+    cfg->enable_broadcast_join(broadcast);
+    db_setup(cfg);
+    for(auto&& s : statements) {
+        execute_statement(s);
+    }
+    std::string plan{};
+    explain_statement(query, plan);
+    EXPECT_EQ(broadcast, plan.find("broadcast") != std::string::npos) << plan;
+    std::vector<mock::basic_record> result{};
+    execute_query(query, result);
+    db_teardown();
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+std::vector<std::string> const statements{  //NOLINT
+    "CREATE TABLE t0 (c0 INT PRIMARY KEY, c1 INT)",
+    "INSERT INTO t0 VALUES (1,10),(2,20),(3,NULL),(4,40)",
+    "CREATE TABLE t1 (c0 INT PRIMARY KEY, c1 INT)",
+    "INSERT INTO t1 VALUES (1,10),(2,10),(3,20),(4,NULL)",
+};
+
+TEST_F(sql_broadcast_join_test, inner_join_with_duplicate_keys) {
+    auto query = "SELECT t0.c0, t1.c0 FROM t0 JOIN t1 ON t0.c1=t1.c1"sv;
+    auto on = run(true, statements, query);
+    auto off = run(false, statements, query);
+    ASSERT_EQ(3, on.size());
+    EXPECT_EQ((create_nullable_record<kind::int4, kind::int4>(1, 1)), on[0]);
+    EXPECT_EQ((create_nullable_record<kind::int4, kind::int4>(1, 2)), on[1]);
+    EXPECT_EQ((create_nullable_record<kind::int4, kind::int4>(2, 3)), on[2]);
+    EXPECT_EQ(off, on);
+}
+
+TEST_F(sql_broadcast_join_test, no_matches) {
+    auto query = "SELECT t0.c0, t1.c0 FROM t0 JOIN t1 ON t0.c1=t1.c1 WHERE t0.c0=4"sv;
+    auto on = run(true, statements, query);
+    auto off = run(false, statements, query);
+    EXPECT_TRUE(on.empty());
+    EXPECT_EQ(off, on);
+}
+
+TEST_F(sql_broadcast_join_test, null_keys) {
+    // null in the join key matches nothing, including null on the other side
+    auto query = "SELECT t0.c0, t1.c0 FROM t0 JOIN t1 ON t0.c1=t1.c1 WHERE t0.c0=3 OR t1.c0=4"sv;
+    auto on = run(true, statements, query);
+    auto off = run(false, statements, query);
+    EXPECT_TRUE(on.empty());
+    EXPECT_EQ(off, on);
+}
+
+TEST_F(sql_broadcast_join_test, left_outer_join) {
+    auto query = "SELECT t0.c0, t1.c0 FROM t0 LEFT OUTER JOIN t1 ON t0.c1=t1.c1"sv;
+    auto on = run(true, statements, query);
+    auto off = run(false, statements, query);
+    ASSERT_EQ(5, on.size());
+    EXPECT_EQ((create_nullable_record<kind::int4, kind::int4>(1, 1)), on[0]);
+    EXPECT_EQ((create_nullable_record<kind::int4, kind::int4>(1, 2)), on[1]);
+    EXPECT_EQ((create_nullable_record<kind::int4, kind::int4>(2, 3)), on[2]);
+    EXPECT_EQ((create_nullable_record<kind::int4, kind::int4>(3, std::nullopt)), on[3]);
+    EXPECT_EQ((create_nullable_record<kind::int4, kind::int4>(4, std::nullopt)), on[4]);
+    EXPECT_EQ(off, on);
+}
+
+}  // namespace jogasaki::testing
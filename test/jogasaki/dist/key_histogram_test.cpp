@@ -0,0 +1,161 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <jogasaki/dist/key_histogram.h>
+#include <jogasaki/dist/key_histogram_store.h>
+#include <jogasaki/dist/key_range.h>
+#include <jogasaki/test_root.h>
+
+namespace jogasaki::dist {
+
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+
+class key_histogram_test : public test_root {
+public:
+    // skewed samples - most keys share the prefix "b"
+    key_histogram skewed() {
+        std::vector<std::string> samples{};
+        samples.emplace_back("a");
+        for(char c = '0'; c <= '9'; ++c) {
+            samples.emplace_back("b"s + c);
+        }
+        samples.emplace_back("c");
+        return key_histogram{samples, 1200, 2400, 12000};
+    }
+};
+
+TEST_F(key_histogram_test, estimate) {
+    auto h = skewed();
+    EXPECT_EQ(1200, h.entry_count());
+    EXPECT_DOUBLE_EQ(2.0, h.average_key_size());
+    EXPECT_DOUBLE_EQ(10.0, h.average_value_size());
+    EXPECT_DOUBLE_EQ(1200.0, h.estimate_count(key_range{}));
+    EXPECT_DOUBLE_EQ(1000.0, h.estimate_count(
+        key_range{"b"sv, kvs::end_point_kind::prefixed_inclusive, "b"sv, kvs::end_point_kind::prefixed_inclusive}
+    ));
+    EXPECT_DOUBLE_EQ(100.0, h.estimate_count(
+        key_range{"a"sv, kvs::end_point_kind::inclusive, "b"sv, kvs::end_point_kind::exclusive}
+    ));
+    EXPECT_DOUBLE_EQ(100.0, h.estimate_count(
+        key_range{"b"sv, kvs::end_point_kind::prefixed_exclusive, ""sv, kvs::end_point_kind::unbound}
+    ));
+}
+
+TEST_F(key_histogram_test, pivots_follow_skew) {
+    auto h = skewed();
+    auto pivots = h.compute_pivots(3, key_range{});
+    // pivots are concentrated on the dense prefix rather than spread between "a" and "c"
+    ASSERT_EQ(3, pivots.size());
+    EXPECT_EQ("b2", pivots[0]);
+    EXPECT_EQ("b5", pivots[1]);
+    EXPECT_EQ("b8", pivots[2]);
+}
+
+TEST_F(key_histogram_test, pivots_within_range) {
+    auto h = skewed();
+    key_range r{"b3"sv, kvs::end_point_kind::inclusive, "b6"sv, kvs::end_point_kind::inclusive};
+    auto pivots = h.compute_pivots(10, r);
+    // begin key is excluded as it makes an empty part
+    EXPECT_EQ((std::vector<std::string>{"b4", "b5", "b6"}), pivots);
+    key_range out_of_samples{"x"sv, kvs::end_point_kind::inclusive, ""sv, kvs::end_point_kind::unbound};
+    EXPECT_TRUE(h.compute_pivots(10, out_of_samples).empty());
+}
+
+TEST_F(key_histogram_test, empty) {
+    key_histogram h{{}, 0, 0, 0};
+    EXPECT_DOUBLE_EQ(0.0, h.estimate_count(key_range{}));
+    EXPECT_DOUBLE_EQ(0.0, h.average_key_size());
+    EXPECT_TRUE(h.compute_pivots(3, key_range{}).empty());
+}
+
+TEST_F(key_histogram_test, store) {
+    key_histogram_store store{};
+    EXPECT_FALSE(store.find("t"));
+    store.put("t", std::make_shared<key_histogram const>(skewed()));
+    ASSERT_TRUE(store.find("t"));
+    EXPECT_EQ(1200, store.find("t")->entry_count());
+    EXPECT_EQ(1, store.size());
+    store.remove("t");
+    EXPECT_FALSE(store.find("t"));
+    EXPECT_EQ(0, store.size());
+}
+
+TEST_F(key_histogram_test, find_or_build_single_flight) {
+    // concurrent callers share one build, and the built histogram is reused until it gets stale
+    key_histogram_store store{};
+    std::atomic_size_t builds{};
+    std::promise<void> release{};
+    auto released = release.get_future().share();
+    key_histogram_store::builder_type build = [&](std::shared_ptr<key_histogram const>& out) {
+        ++builds;
+        released.wait();
+        out = std::make_shared<key_histogram const>(skewed());
+        return status::ok;
+    };
+    auto find = [&]() {
+        std::shared_ptr<key_histogram const> h{};
+        auto res = store.find_or_build("t", std::chrono::milliseconds{60000}, build, h);
+        return res == status::ok && h && h->entry_count() == 1200;
+    };
+    auto f0 = std::async(std::launch::async, find);
+    auto f1 = std::async(std::launch::async, find);
+    while(builds == 0) {
+        std::this_thread::yield();
+    }
+    release.set_value();
+    EXPECT_TRUE(f0.get());
+    EXPECT_TRUE(f1.get());
+    EXPECT_TRUE(find());
+    EXPECT_EQ(1, builds);
+    EXPECT_EQ(1, store.size());
+}
+
+TEST_F(key_histogram_test, find_or_build_refresh_and_failure) {
+    key_histogram_store store{};
+    std::size_t builds{};
+    status result = status::err_io_error;
+    key_histogram_store::builder_type build = [&](std::shared_ptr<key_histogram const>& out) {
+        ++builds;
+        if(result == status::ok) {
+            out = std::make_shared<key_histogram const>(skewed());
+        }
+        return result;
+    };
+    std::shared_ptr<key_histogram const> h{};
+    // failed build stores nothing, and the next call tries again
+    EXPECT_EQ(status::err_io_error, store.find_or_build("t", std::chrono::milliseconds{0}, build, h));
+    EXPECT_FALSE(h);
+    EXPECT_EQ(0, store.size());
+    result = status::ok;
+    EXPECT_EQ(status::ok, store.find_or_build("t", std::chrono::milliseconds{0}, build, h));
+    EXPECT_TRUE(h);
+    EXPECT_EQ(2, builds);
+    // the histogram older than the refresh interval is rebuilt
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    EXPECT_EQ(status::ok, store.find_or_build("t", std::chrono::milliseconds{0}, build, h));
+    EXPECT_EQ(3, builds);
+}
+
+}  // namespace jogasaki::dist
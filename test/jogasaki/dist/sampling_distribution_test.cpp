@@ -0,0 +1,109 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <chrono>
+#include <string>
+#include <gtest/gtest.h>
+
+#include <jogasaki/api/api_test_base.h>
+#include <jogasaki/api/impl/database.h>
+#include <jogasaki/api/transaction_handle_internal.h>
+#include <jogasaki/dist/key_histogram_store.h>
+#include <jogasaki/dist/key_range.h>
+#include <jogasaki/dist/sampling_key_distribution.h>
+#include <jogasaki/dist/uniform_key_distribution.h>
+#include <jogasaki/kvs/id.h>
+#include <jogasaki/kvs_test_utils.h>
+#include <jogasaki/utils/create_tx.h>
+#include <jogasaki/utils/get_storage_by_index_name.h>
+
+namespace jogasaki::dist {
+
+using namespace std::chrono_literals;
+
+class sampling_distribution_test :
+    public ::testing::Test,
+    public kvs_test_utils,
+    public testing::api_test_base {
+
+public:
+    // change this flag to debug with explain
+    bool to_explain() override {
+        return false;
+    }
+
+    void SetUp() override {
+        auto cfg = std::make_shared<configuration>();
+        db_setup(cfg);
+    }
+
+    void TearDown() override {
+        db_teardown();
+    }
+
+};
+
+TEST_F(sampling_distribution_test, basic) {
+    execute_statement("create table t (c0 int primary key)");
+    for(std::size_t i=0; i < 100; ++i) {
+        execute_statement("insert into t values (" + std::to_string(i) + ")");
+    }
+    auto stg = utils::get_storage_by_index_name("t");
+    auto tx = utils::create_transaction(*db_, true, false);
+    auto tctx = get_transaction_context(*tx);
+
+    key_histogram_store store{};
+    sampling_key_distribution dist{*stg, *tctx->object(), "t", store, 10, 0, 1h};
+    std::shared_ptr<key_histogram const> h{};
+    ASSERT_EQ(status::ok, dist.histogram(h));
+    EXPECT_TRUE(h->complete());
+    EXPECT_EQ(100, h->entry_count());
+    EXPECT_EQ(10, h->samples().size());
+
+    key_range range{};
+    EXPECT_EQ(3, dist.compute_pivots(3, range).size());
+    ASSERT_EQ(status::ok, tx->abort());
+}
+
+TEST_F(sampling_distribution_test, fallback_to_uniform_over_max_scan_entries) {
+    if (jogasaki::kvs::implementation_id() == "memory") {
+        GTEST_SKIP() << "jogasaki-memory doesn't support uniform key distribution yet";
+    }
+    execute_statement("create table t (c0 int primary key)");
+    for(std::size_t i=0; i < 100; ++i) {
+        execute_statement("insert into t values (" + std::to_string(i) + ")");
+    }
+    auto stg = utils::get_storage_by_index_name("t");
+    auto tx = utils::create_transaction(*db_, true, false);
+    auto tctx = get_transaction_context(*tx);
+
+    key_histogram_store store{};
+    sampling_key_distribution dist{*stg, *tctx->object(), "t", store, 10, 20, 1h};
+    std::shared_ptr<key_histogram const> h{};
+    ASSERT_EQ(status::ok, dist.histogram(h));
+    EXPECT_FALSE(h->complete());
+    EXPECT_EQ(20, h->entry_count());
+    EXPECT_TRUE(h->samples().empty());
+
+    // the incomplete histogram is kept so that the scan is not repeated
+    EXPECT_EQ(h, store.find("t"));
+
+    key_range range{};
+    uniform_key_distribution uniform{*stg, *tctx->object()};
+    EXPECT_EQ(uniform.compute_pivots(3, range), dist.compute_pivots(3, range));
+    ASSERT_EQ(status::ok, tx->abort());
+}
+
+}  // namespace jogasaki::dist
@@ -38,6 +38,7 @@
 #include <jogasaki/executor/function/incremental/aggregate_function_info.h>
 #include <jogasaki/executor/function/incremental/aggregate_function_kind.h>
 #include <jogasaki/executor/io/group_reader.h>
+#include <jogasaki/memory/memory_tracker.h>
 #include <jogasaki/memory/paged_memory_resource.h>
 #include <jogasaki/meta/field_type.h>
 #include <jogasaki/meta/field_type_kind.h>
@@ -334,5 +335,69 @@ TEST_F(incremental_aggregate_reader_test, avg_avg) {
     ASSERT_FALSE(r.next_member());
     ASSERT_FALSE(r.next_group());
 }
+TEST_F(incremental_aggregate_reader_test, spilled_runs) {
+    std::vector<std::unique_ptr<input_partition>> partitions{};
+    partitions.reserve(10); // avoid relocation when using references into vector
+    auto& p1 = partitions.emplace_back(std::make_unique<input_partition>(sum_info));
+    auto& p2 = partitions.emplace_back(std::make_unique<input_partition>(sum_info));
+    p1->enable_spill(1, "");  // spill on every new key
+    p2->enable_spill(1, "");
+
+    for(std::int64_t i=0; i < 20; ++i) {
+        auto rec = create_rec(i % 4, 1.0);
+        (i % 3 == 0 ? p1 : p2)->write(rec.ref());
+    }
+    p1->flush();
+    p2->flush();
+    ASSERT_LT(0, p1->runs_count());
+    ASSERT_LT(0, p2->runs_count());
+
+    reader r{sum_info, partitions};
+    for(std::int64_t key=0; key < 4; ++key) {
+        ASSERT_TRUE(r.next_group());
+        EXPECT_EQ(key, get_key(r));
+        ASSERT_TRUE(r.next_member());
+        EXPECT_DOUBLE_EQ(5.0, get_value(r));
+        ASSERT_FALSE(r.next_member());
+    }
+    ASSERT_FALSE(r.next_group());
+}
+
+TEST_F(incremental_aggregate_reader_test, spill_on_memory_pressure) {
+    // pre-aggregated records are spilled on flush when the tracker nears its limit even below the threshold
+    std::vector<std::unique_ptr<input_partition>> partitions{};
+    auto& p1 = partitions.emplace_back(std::make_unique<input_partition>(sum_info));
+    auto tracker = std::make_shared<memory_tracker>(nullptr, 100);
+    {
+        memory_tracker_scope scope{tracker};
+        p1->enable_spill(1UL << 30U, "", 80);
+    }
+    for(std::int64_t i=0; i < 4; ++i) {
+        auto rec = create_rec(i % 2, 1.0);
+        p1->write(rec.ref());
+    }
+    p1->flush();
+    EXPECT_EQ(0, p1->runs_count());
+
+    tracker->consume(80);
+    for(std::int64_t i=0; i < 4; ++i) {
+        auto rec = create_rec(i % 2, 1.0);
+        p1->write(rec.ref());
+    }
+    p1->flush();
+    EXPECT_EQ(1, p1->runs_count());
+    tracker->release(80);
+
+    reader r{sum_info, partitions};
+    for(std::int64_t key=0; key < 2; ++key) {
+        ASSERT_TRUE(r.next_group());
+        EXPECT_EQ(key, get_key(r));
+        ASSERT_TRUE(r.next_member());
+        EXPECT_DOUBLE_EQ(4.0, get_value(r));
+        ASSERT_FALSE(r.next_member());
+    }
+    ASSERT_FALSE(r.next_group());
+}
+
 }
 
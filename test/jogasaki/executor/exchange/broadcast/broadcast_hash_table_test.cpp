@@ -0,0 +1,88 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <jogasaki/executor/exchange/broadcast/broadcast_info.h>
+#include <jogasaki/executor/exchange/broadcast/hash_table.h>
+#include <jogasaki/kvs/coder.h>
+#include <jogasaki/kvs/writable_stream.h>
+#include <jogasaki/mock/basic_record.h>
+#include <jogasaki/test_root.h>
+
+namespace jogasaki::executor::exchange::broadcast {
+
+using kind = meta::field_type_kind;
+using namespace jogasaki::mock;
+
+class broadcast_hash_table_test : public test_root {
+public:
+    // encode the key in the same way as the table does for the given key record
+    std::string encode(basic_record const& key) {
+        std::string buf(100, '\0');
+        kvs::writable_stream s{buf.data(), buf.size()};
+        auto& meta = *key.record_meta();
+        for(std::size_t i = 0, n = meta.field_count(); i < n; ++i) {
+            kvs::coding_context ctx{};
+            EXPECT_EQ(
+                status::ok,
+                kvs::encode(key.ref(), meta.value_offset(i), meta.at(i), kvs::spec_key_ascending, ctx, s)
+            );
+        }
+        buf.resize(s.size());
+        return buf;
+    }
+};
+
+TEST_F(broadcast_hash_table_test, basic) {
+    auto r1 = create_nullable_record<kind::int8, kind::float8>(1, 10.0);
+    auto r2 = create_nullable_record<kind::int8, kind::float8>(2, 20.0);
+    auto r3 = create_nullable_record<kind::int8, kind::float8>(1, 30.0);
+    auto info = std::make_shared<broadcast_info>(r1.record_meta(), std::vector<std::size_t>{0});
+    hash_table table{info};
+    ASSERT_EQ(status::ok, table.insert(r1.ref()));
+    ASSERT_EQ(status::ok, table.insert(r2.ref()));
+    ASSERT_EQ(status::ok, table.insert(r3.ref()));
+    EXPECT_EQ(3, table.size());
+
+    auto [b1, e1] = table.find(encode(create_nullable_record<kind::int8>(1)));
+    EXPECT_EQ(2, std::distance(b1, e1));
+    auto [b2, e2] = table.find(encode(create_nullable_record<kind::int8>(2)));
+    ASSERT_EQ(1, std::distance(b2, e2));
+    EXPECT_EQ(r2.ref().data(), b2->second);
+    auto [b3, e3] = table.find(encode(create_nullable_record<kind::int8>(3)));
+    EXPECT_EQ(b3, e3);
+}
+
+TEST_F(broadcast_hash_table_test, null_key_is_skipped) {
+    auto r1 = create_nullable_record<kind::int8, kind::int4>(1, 10);
+    auto r2 = create_nullable_record<kind::int8, kind::int4>(2, std::nullopt);
+    auto info = std::make_shared<broadcast_info>(r1.record_meta(), std::vector<std::size_t>{1, 0});
+    hash_table table{info};
+    ASSERT_EQ(status::ok, table.insert(r1.ref()));
+    ASSERT_EQ(status::ok, table.insert(r2.ref()));
+    EXPECT_EQ(1, table.size());
+
+    auto [b, e] = table.find(encode(create_nullable_record<kind::int4, kind::int8>(10, 1)));
+    ASSERT_EQ(1, std::distance(b, e));
+    EXPECT_EQ(r1.ref().data(), b->second);
+}
+
+}  // namespace jogasaki::executor::exchange::broadcast
@@ -30,6 +30,7 @@
 #include <jogasaki/api/statement_handle.h>
 #include <jogasaki/api/transaction_handle.h>
 #include <jogasaki/configuration.h>
+#include <jogasaki/data/any.h>
 #include <jogasaki/executor/file/loader.h>
 #include <jogasaki/executor/file/parquet_writer.h>
 #include <jogasaki/executor/tables.h>
@@ -79,7 +80,7 @@ public:
 
     test::temporary_folder temporary_{};  //NOLINT
 
-    void test_load(std::vector<std::string> const& files, std::shared_ptr<loader>& ldr, std::size_t bulk_size = 10000, bool expect_error = false, std::unique_ptr<api::parameter_set> ps = nullptr) {
+    void test_load(std::vector<std::string> const& files, std::shared_ptr<loader>& ldr, std::size_t bulk_size = 10000, bool expect_error = false, std::unique_ptr<api::parameter_set> ps = nullptr, std::optional<column_value_range> range = {}) {
         auto* impl = db_impl();
         api::statement_handle prepared{};
         std::unordered_map<std::string, api::field_type_kind> variables{
@@ -104,7 +105,8 @@ public:
             std::shared_ptr{std::move(ps)},
             tx,
             *d,
-            bulk_size
+            bulk_size,
+            std::move(range)
         );
 
         loader_result res{};
@@ -123,9 +125,10 @@ public:
     }
 };
 
-void create_test_file(boost::filesystem::path const& p, std::size_t record_count, std::size_t file_index) {
+void create_test_file(boost::filesystem::path const& p, std::size_t record_count, std::size_t file_index, std::int64_t record_batch_size = 0) {
     auto rec = mock::create_nullable_record<kind::int8, kind::float8>();
     parquet_writer_option opt{};
+    opt.record_batch_size(record_batch_size);
     auto writer = parquet_writer::open(
         std::make_shared<meta::external_record_meta>(
             rec.record_meta(),
@@ -191,6 +194,111 @@ TEST_F(loader_test, multiple_read) {
     EXPECT_EQ(10, ldr->records_loaded());
 }
 
+TEST_F(loader_test, multiple_row_groups) {
+    boost::filesystem::path p{path()};
+    p = p / "multiple_row_groups.parquet";
+    create_test_file(p, 30, 0, 10);
+    std::shared_ptr<loader> ldr{};
+    test_load(std::vector<std::string>{p.string()}, ldr);
+    {
+        std::vector<mock::basic_record> result{};
+        execute_query("SELECT * FROM T0", result);
+        ASSERT_EQ(30, result.size());
+    }
+    EXPECT_EQ(30, ldr->records_loaded());
+    EXPECT_EQ(0, ldr->row_groups_skipped());
+}
+
+TEST_F(loader_test, skip_row_groups_by_range) {
+    // row groups have C0 values 0-90, 100-190 and 200-290 respectively
+    boost::filesystem::path p{path()};
+    p = p / "skip_row_groups_by_range.parquet";
+    create_test_file(p, 30, 0, 10);
+    std::shared_ptr<loader> ldr{};
+    column_value_range range{
+        "C0",
+        data::any{std::in_place_type<std::int64_t>, 120},
+        data::any{std::in_place_type<std::int64_t>, 150}
+    };
+    test_load(std::vector<std::string>{p.string()}, ldr, 10000, false, nullptr, range);
+    {
+        std::vector<mock::basic_record> result{};
+        execute_query("SELECT * FROM T0", result);
+        ASSERT_EQ(10, result.size());
+        EXPECT_EQ((mock::create_nullable_record<kind::int8, kind::float8>(100,1000.0)), result[0]);
+    }
+    EXPECT_EQ(10, ldr->records_loaded());
+    EXPECT_EQ(2, ldr->row_groups_skipped());
+}
+
+TEST_F(loader_test, statement_for_each_record) {
+    // verify the path executing statement for each record, which is used when direct load is disabled (default)
+    db_impl()->configuration()->direct_load(false);
+    boost::filesystem::path p{path()};
+    p = p / "statement_for_each_record.parquet";
+    create_test_file(p, 10, 0);
+    std::shared_ptr<loader> ldr{};
+    test_load(std::vector<std::string>{p.string()}, ldr, 3);
+    {
+        std::vector<mock::basic_record> result{};
+        execute_query("SELECT * FROM T0", result);
+        ASSERT_EQ(10, result.size());
+        EXPECT_EQ((mock::create_nullable_record<kind::int8, kind::float8>(0,1000.0)), result[0]);
+        EXPECT_EQ((mock::create_nullable_record<kind::int8, kind::float8>(90,1000.0)), result[9]);
+    }
+    EXPECT_EQ(10, ldr->records_loaded());
+}
+
+TEST_F(loader_test, direct_load) {
+    db_impl()->configuration()->direct_load(true);
+    boost::filesystem::path p{path()};
+    p = p / "direct_load.parquet";
+    create_test_file(p, 10, 0);
+    std::shared_ptr<loader> ldr{};
+    test_load(std::vector<std::string>{p.string()}, ldr, 3);
+    {
+        std::vector<mock::basic_record> result{};
+        execute_query("SELECT * FROM T0", result);
+        ASSERT_EQ(10, result.size());
+        EXPECT_EQ((mock::create_nullable_record<kind::int8, kind::float8>(0,1000.0)), result[0]);
+        EXPECT_EQ((mock::create_nullable_record<kind::int8, kind::float8>(90,1000.0)), result[9]);
+    }
+    EXPECT_EQ(10, ldr->records_loaded());
+}
+
+TEST_F(loader_test, direct_load_duplicate_key) {
+    db_impl()->configuration()->direct_load(true);
+    boost::filesystem::path p{path()};
+    p = p / "direct_load_duplicate_key.parquet";
+    create_test_file(p, 2, 0);
+    execute_statement("INSERT INTO T0(C0, C1) VALUES (10, 1.0)");
+    std::shared_ptr<loader> ldr{};
+    test_load(std::vector<std::string>{p.string()}, ldr, 3, true);
+    EXPECT_EQ(status::err_aborted, ldr->error_info().first);
+    {
+        std::vector<mock::basic_record> result{};
+        execute_query("SELECT * FROM T0", result);
+        ASSERT_EQ(1, result.size());
+        EXPECT_EQ((mock::create_nullable_record<kind::int8, kind::float8>(10,1.0)), result[0]);
+    }
+}
+
+TEST_F(loader_test, duplicate_key) {
+    boost::filesystem::path p{path()};
+    p = p / "duplicate_key.parquet";
+    create_test_file(p, 2, 0);
+    execute_statement("INSERT INTO T0(C0, C1) VALUES (10, 1.0)");
+    std::shared_ptr<loader> ldr{};
+    test_load(std::vector<std::string>{p.string()}, ldr, 3, true);
+    EXPECT_EQ(status::err_aborted, ldr->error_info().first);
+    {
+        std::vector<mock::basic_record> result{};
+        execute_query("SELECT * FROM T0", result);
+        ASSERT_EQ(1, result.size());
+        EXPECT_EQ((mock::create_nullable_record<kind::int8, kind::float8>(10,1.0)), result[0]);
+    }
+}
+
 TEST_F(loader_test, dummy_file) {
     std::shared_ptr<loader> ldr{};
     test_load(std::vector<std::string>{"dummy.parquet"}, ldr, 3, true);
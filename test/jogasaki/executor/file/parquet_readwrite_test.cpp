@@ -25,14 +25,19 @@
 #include <vector>
 #include <boost/filesystem/operations.hpp>
 #include <boost/filesystem/path.hpp>
+#include <arrow/io/file.h>
 #include <boost/move/utility_core.hpp>
 #include <gtest/gtest.h>
+#include <parquet/api/writer.h>
+#include <parquet/exception.h>
+#include <parquet/schema.h>
 
 #include <takatori/util/maybe_shared_ptr.h>
 
 #include <jogasaki/accessor/record_printer.h>
 #include <jogasaki/accessor/record_ref.h>
 #include <jogasaki/accessor/text.h>
+#include <jogasaki/data/any.h>
 #include <jogasaki/executor/file/parquet_reader.h>
 #include <jogasaki/executor/file/parquet_writer.h>
 #include <jogasaki/meta/decimal_field_option.h>
@@ -367,6 +372,116 @@ TEST_F(parquet_readwrite_test, nulls) {
     EXPECT_TRUE(reader->close());
 }
 
+TEST_F(parquet_readwrite_test, rows_exceeding_batch) {
+    // write/read more rows than the column batch size so that the batches are flushed/refilled multiple times
+    boost::filesystem::path p{path()};
+    p = p / "rows_exceeding_batch.parquet";
+    constexpr std::size_t row_count = 3000;
+    auto create = [](std::size_t i) {
+        if(i % 7 == 0) {
+            return mock::create_nullable_record<kind::int8, kind::float8, kind::character>(
+                std::nullopt, std::nullopt, std::nullopt
+            );
+        }
+        auto s = std::string(i % 20, 'a') + std::to_string(i);
+        return mock::create_nullable_record<kind::int8, kind::float8, kind::character>(
+            static_cast<std::int64_t>(i), static_cast<double>(i) * 10.0, accessor::text{s}
+        );
+    };
+    parquet_writer_option opt{};
+    auto writer = parquet_writer::open(
+        std::make_shared<meta::external_record_meta>(
+            create(1).record_meta(),
+            std::vector<std::optional<std::string>>{"C0", "C1", "C2"}
+        ), p.string(), opt);
+    ASSERT_TRUE(writer);
+    for(std::size_t i=0; i < row_count; ++i) {
+        auto rec = create(i);
+        ASSERT_TRUE(writer->write(rec.ref()));
+    }
+    writer->close();
+    EXPECT_EQ(row_count, writer->write_count());
+
+    auto reader = parquet_reader::open(p.string());
+    ASSERT_TRUE(reader);
+    auto meta = reader->meta();
+    ASSERT_EQ(3, meta->field_count());
+    for(std::size_t i=0; i < row_count; ++i) {
+        accessor::record_ref ref{};
+        ASSERT_TRUE(reader->next(ref));
+        EXPECT_EQ(create(i), mock::basic_record(ref, meta->origin()));
+    }
+    {
+        accessor::record_ref ref{};
+        ASSERT_FALSE(reader->next(ref));
+    }
+    EXPECT_EQ(row_count, reader->read_count());
+    EXPECT_TRUE(reader->close());
+}
+
+TEST_F(parquet_readwrite_test, required_column) {
+    // parquet_writer emits only OPTIONAL columns, so write the file with parquet api directly
+    boost::filesystem::path p{path()};
+    p = p / "required_column.parquet";
+    constexpr std::size_t row_count = 3000;
+    {
+        using parquet::schema::PrimitiveNode;
+        parquet::schema::NodeVector fields{};
+        fields.push_back(PrimitiveNode::Make(
+            "C0", parquet::Repetition::REQUIRED, parquet::LogicalType::Int(64, true), parquet::Type::INT64
+        ));
+        fields.push_back(PrimitiveNode::Make(
+            "C1", parquet::Repetition::OPTIONAL, parquet::Type::DOUBLE, parquet::ConvertedType::NONE
+        ));
+        auto schema = std::static_pointer_cast<parquet::schema::GroupNode>(
+            parquet::schema::GroupNode::Make("schema", parquet::Repetition::REQUIRED, fields)
+        );
+        std::shared_ptr<::arrow::io::FileOutputStream> fs{};
+        PARQUET_ASSIGN_OR_THROW(fs, ::arrow::io::FileOutputStream::Open(p.string()));
+        auto writer = parquet::ParquetFileWriter::Open(fs, schema);
+        auto* rg = writer->AppendRowGroup();
+        std::vector<std::int64_t> c0{};
+        std::vector<double> c1{};
+        std::vector<std::int16_t> c1_levels{};
+        for(std::size_t i=0; i < row_count; ++i) {
+            c0.emplace_back(static_cast<std::int64_t>(i));
+            if(i % 7 == 0) {
+                c1_levels.emplace_back(0);
+                continue;
+            }
+            c1_levels.emplace_back(1);
+            c1.emplace_back(static_cast<double>(i) * 10.0);
+        }
+        auto* w0 = static_cast<parquet::Int64Writer*>(rg->NextColumn());
+        w0->WriteBatch(static_cast<std::int64_t>(row_count), nullptr, nullptr, c0.data());
+        auto* w1 = static_cast<parquet::DoubleWriter*>(rg->NextColumn());
+        w1->WriteBatch(static_cast<std::int64_t>(row_count), c1_levels.data(), nullptr, c1.data());
+        rg->Close();
+        writer->Close();
+        PARQUET_THROW_NOT_OK(fs->Close());
+    }
+
+    auto reader = parquet_reader::open(p.string());
+    ASSERT_TRUE(reader);
+    auto meta = reader->meta();
+    ASSERT_EQ(2, meta->field_count());
+    for(std::size_t i=0; i < row_count; ++i) {
+        accessor::record_ref ref{};
+        ASSERT_TRUE(reader->next(ref));
+        auto c0 = static_cast<std::int64_t>(i);
+        auto exp = i % 7 == 0 ?
+            mock::create_nullable_record<kind::int8, kind::float8>(c0, std::nullopt) :
+            mock::create_nullable_record<kind::int8, kind::float8>(c0, static_cast<double>(i) * 10.0);
+        ASSERT_EQ(exp, mock::basic_record(ref, meta->origin())) << "row " << i;
+    }
+    {
+        accessor::record_ref ref{};
+        ASSERT_FALSE(reader->next(ref));
+    }
+    EXPECT_EQ(row_count, reader->read_count());
+    EXPECT_TRUE(reader->close());
+}
+
 TEST_F(parquet_readwrite_test, generate_decimal_sample) {
     auto fm0 = meta::decimal_type(6, 3);
     auto fm1 = meta::decimal_type(4, 1);
@@ -529,6 +644,75 @@ TEST_F(parquet_readwrite_test, multi_row_groups) {
     }
 }
 
+TEST_F(parquet_readwrite_test, row_group_statistics) {
+    // verify row groups are split by record_batch_size and skipped by the range using min/max statistics
+    boost::filesystem::path p{path()};
+    p = p / "row_group_statistics.parquet";
+    parquet_writer_option opt{};
+    opt.record_batch_size(10);
+    auto writer = parquet_writer::open(
+        std::make_shared<meta::external_record_meta>(
+            mock::create_nullable_record<kind::int8, kind::character>(0, accessor::text{""}).record_meta(),
+            std::vector<std::optional<std::string>>{"C0", "C1"}
+        ), p.string(), opt);
+    ASSERT_TRUE(writer);
+    EXPECT_EQ(10, writer->row_group_max_records());
+    for(std::int64_t i=0; i < 30; ++i) {
+        auto s = std::string{"k"} + std::to_string(100 + i);
+        auto rec = mock::create_nullable_record<kind::int8, kind::character>(i, accessor::text{s});
+        ASSERT_TRUE(writer->write(rec.ref()));
+    }
+    writer->close();
+
+    auto reader = parquet_reader::open(p.string());
+    ASSERT_TRUE(reader);
+    ASSERT_EQ(3, reader->row_group_count());
+
+    auto i8 = [](std::int64_t v) { return data::any{std::in_place_type<std::int64_t>, v}; };
+    {
+        column_value_range r{"C0", i8(12), i8(15)};
+        EXPECT_FALSE(reader->row_group_in_range(0, r));
+        EXPECT_TRUE(reader->row_group_in_range(1, r));
+        EXPECT_FALSE(reader->row_group_in_range(2, r));
+    }
+    {
+        column_value_range r{"C0", i8(9), i8(20)};
+        EXPECT_TRUE(reader->row_group_in_range(0, r));
+        EXPECT_TRUE(reader->row_group_in_range(1, r));
+        EXPECT_TRUE(reader->row_group_in_range(2, r));
+    }
+    {
+        column_value_range r{"C0", i8(25), {}};
+        EXPECT_FALSE(reader->row_group_in_range(0, r));
+        EXPECT_FALSE(reader->row_group_in_range(1, r));
+        EXPECT_TRUE(reader->row_group_in_range(2, r));
+    }
+    {
+        column_value_range r{"C1", {}, data::any{std::in_place_type<accessor::text>, accessor::text{"k105"}}};
+        EXPECT_TRUE(reader->row_group_in_range(0, r));
+        EXPECT_FALSE(reader->row_group_in_range(1, r));
+        EXPECT_FALSE(reader->row_group_in_range(2, r));
+    }
+    {
+        // unknown column or unmatched bound type does not skip row groups
+        column_value_range r0{"XX", i8(100), i8(200)};
+        EXPECT_TRUE(reader->row_group_in_range(0, r0));
+        column_value_range r1{"C0", data::any{std::in_place_type<double>, 100.0}, {}};
+        EXPECT_TRUE(reader->row_group_in_range(0, r1));
+    }
+    EXPECT_TRUE(reader->close());
+    {
+        column_value_range r{"C0", i8(12), i8(25)};
+        std::vector<std::size_t> groups{};
+        std::size_t count{};
+        ASSERT_TRUE(parquet_reader::find_row_groups(p.string(), std::addressof(r), groups, count));
+        EXPECT_EQ(3, count);
+        EXPECT_EQ((std::vector<std::size_t>{1, 2}), groups);
+        ASSERT_TRUE(parquet_reader::find_row_groups(p.string(), nullptr, groups, count));
+        EXPECT_EQ((std::vector<std::size_t>{0, 1, 2}), groups);
+    }
+}
+
 TEST_F(parquet_readwrite_test, char) {
     // verify writing char columns data as STRING
     boost::filesystem::path p{path()};
@@ -0,0 +1,128 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <string>
+#include <string_view>
+#include <gtest/gtest.h>
+
+#include <jogasaki/executor/expr/like_pattern.h>
+#include <jogasaki/test_root.h>
+
+namespace jogasaki::executor::expr {
+
+using namespace std::string_view_literals;
+
+using compile_result = like_pattern::compile_result;
+using shape = like_pattern::shape;
+
+class like_pattern_test : public test_root {};
+
+TEST_F(like_pattern_test, shapes) {
+    like_pattern p{};
+    ASSERT_EQ(compile_result::ok, p.compile(""sv, ""sv));
+    EXPECT_EQ(shape::empty, p.kind());
+    EXPECT_TRUE(p.match(""sv));
+    EXPECT_FALSE(p.match("a"sv));
+
+    ASSERT_EQ(compile_result::ok, p.compile("%%"sv, ""sv));
+    EXPECT_EQ(shape::any, p.kind());
+    EXPECT_TRUE(p.match(""sv));
+    EXPECT_TRUE(p.match("abc"sv));
+
+    ASSERT_EQ(compile_result::ok, p.compile("abc"sv, ""sv));
+    EXPECT_EQ(shape::exact, p.kind());
+    EXPECT_EQ("abc"sv, p.literal_prefix());
+    EXPECT_TRUE(p.match("abc"sv));
+    EXPECT_FALSE(p.match("abcd"sv));
+
+    ASSERT_EQ(compile_result::ok, p.compile("ab%"sv, ""sv));
+    EXPECT_EQ(shape::prefix, p.kind());
+    EXPECT_EQ("ab"sv, p.literal_prefix());
+    EXPECT_TRUE(p.match("ab"sv));
+    EXPECT_TRUE(p.match("abc"sv));
+    EXPECT_FALSE(p.match("xab"sv));
+
+    ASSERT_EQ(compile_result::ok, p.compile("%bc"sv, ""sv));
+    EXPECT_EQ(shape::suffix, p.kind());
+    EXPECT_EQ(""sv, p.literal_prefix());
+    EXPECT_TRUE(p.match("abc"sv));
+    EXPECT_FALSE(p.match("bca"sv));
+
+    ASSERT_EQ(compile_result::ok, p.compile("%b\\%%"sv, "\\"sv));
+    EXPECT_EQ(shape::contains, p.kind());
+    EXPECT_TRUE(p.match("ab%c"sv));
+    EXPECT_FALSE(p.match("abc"sv));
+
+    ASSERT_EQ(compile_result::ok, p.compile("a_c%"sv, ""sv));
+    EXPECT_EQ(shape::general, p.kind());
+    EXPECT_EQ("a"sv, p.literal_prefix());
+    EXPECT_TRUE(p.match("abcd"sv));
+    EXPECT_TRUE(p.match("a\xE3\x81\x82" "c"sv));
+    EXPECT_FALSE(p.match("ac"sv));
+}
+
+TEST_F(like_pattern_test, general_backtracking) {
+    like_pattern p{};
+    ASSERT_EQ(compile_result::ok, p.compile("a%de%"sv, ""sv));
+    EXPECT_EQ(shape::general, p.kind());
+    EXPECT_TRUE(p.match("abcde"sv));
+    EXPECT_TRUE(p.match("adxdex"sv));
+    EXPECT_FALSE(p.match("abcd"sv));
+}
+
+TEST_F(like_pattern_test, invalid_patterns) {
+    like_pattern p{};
+    EXPECT_EQ(compile_result::invalid_input_value, p.compile("abc"sv, "ab"sv));
+    EXPECT_EQ(compile_result::invalid_input_value, p.compile("\\"sv, "\\"sv));
+    EXPECT_EQ(compile_result::invalid_input_value, p.compile("abc\\"sv, "\\"sv));
+    EXPECT_EQ(compile_result::ok, p.compile("abc\\\\"sv, "\\"sv));
+    EXPECT_EQ(compile_result::null_result, p.compile("\xFF"sv, ""sv));
+}
+
+TEST_F(like_pattern_test, contains_literal) {
+    EXPECT_TRUE(contains_literal("abc"sv, ""sv));
+    EXPECT_TRUE(contains_literal("abc"sv, "abc"sv));
+    EXPECT_TRUE(contains_literal("aababc"sv, "abc"sv));
+    EXPECT_FALSE(contains_literal("aababd"sv, "abc"sv));
+    EXPECT_FALSE(contains_literal("ab"sv, "abc"sv));
+    std::string longer(1000, 'x');
+    longer += "needle";
+    EXPECT_TRUE(contains_literal(longer, "needle"sv));
+    EXPECT_FALSE(contains_literal(longer, "needles"sv));
+}
+
+TEST_F(like_pattern_test, cache) {
+    like_pattern_cache cache{};
+    int k0{};
+    int k1{};
+    auto& e0 = cache.get(&k0, "ab%"sv, ""sv);
+    EXPECT_EQ(compile_result::ok, e0.result_);
+    EXPECT_EQ(shape::prefix, e0.compiled_.kind());
+    EXPECT_EQ(1, cache.compile_count());
+    (void) cache.get(&k0, "ab%"sv, ""sv);
+    EXPECT_EQ(1, cache.compile_count());
+    (void) cache.get(&k1, "ab%"sv, ""sv);
+    EXPECT_EQ(2, cache.compile_count());
+
+    // different pattern for the same expression re-compiles the entry
+    auto& e1 = cache.get(&k0, "%ab%"sv, ""sv);
+    EXPECT_EQ(3, cache.compile_count());
+    EXPECT_EQ(shape::contains, e1.compiled_.kind());
+    auto& e2 = cache.get(&k0, "ab\\"sv, "\\"sv);
+    EXPECT_EQ(compile_result::invalid_input_value, e2.result_);
+    EXPECT_EQ(4, cache.compile_count());
+}
+
+}  // namespace jogasaki::executor::expr
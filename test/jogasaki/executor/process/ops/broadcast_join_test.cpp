@@ -0,0 +1,411 @@
+/*
+ * Copyright 2018-2025 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <takatori/descriptor/variable.h>
+#include <takatori/plan/broadcast.h>
+#include <takatori/relation/join_find.h>
+#include <takatori/relation/join_kind.h>
+#include <takatori/scalar/compare.h>
+#include <takatori/scalar/comparison_operator.h>
+#include <takatori/scalar/immediate.h>
+#include <takatori/scalar/variable_reference.h>
+#include <takatori/type/primitive.h>
+#include <takatori/util/clonable.h>
+#include <takatori/value/primitive.h>
+
+#include <jogasaki/executor/exchange/broadcast/broadcast_info.h>
+#include <jogasaki/executor/exchange/broadcast/hash_table.h>
+#include <jogasaki/executor/expr/evaluator.h>
+#include <jogasaki/executor/process/impl/ops/broadcast_join.h>
+#include <jogasaki/executor/process/impl/ops/broadcast_join_context.h>
+#include <jogasaki/executor/process/impl/ops/details/search_key_field_info.h>
+#include <jogasaki/executor/process/impl/variable_table.h>
+#include <jogasaki/executor/process/impl/variable_table_info.h>
+#include <jogasaki/executor/process/impl/variables_view.h>
+#include <jogasaki/executor/process/impl/work_context.h>
+#include <jogasaki/executor/process/mock/task_context.h>
+#include <jogasaki/kvs/coder.h>
+#include <jogasaki/memory/lifo_paged_memory_resource.h>
+#include <jogasaki/meta/field_type_kind.h>
+#include <jogasaki/meta/variable_order.h>
+#include <jogasaki/mock/basic_record.h>
+#include <jogasaki/operator_test_utils.h>
+#include <jogasaki/request_context.h>
+#include <jogasaki/status.h>
+#include <jogasaki/test_root.h>
+#include <jogasaki/test_utils.h>
+
+#include "verifier.h"
+
+namespace jogasaki::executor::process::impl::ops {
+
+using namespace meta;
+using namespace testing;
+using namespace executor;
+using namespace accessor;
+using namespace takatori::util;
+using namespace jogasaki::mock;
+
+namespace relation = ::takatori::relation;
+namespace scalar = ::takatori::scalar;
+namespace value = ::takatori::value;
+
+using kind = field_type_kind;
+using compare = scalar::compare;
+using comparison_operator = scalar::comparison_operator;
+using immediate = scalar::immediate;
+using varref = scalar::variable_reference;
+using join_kind = relation::join_kind;
+
+/**
+ * @brief Bundle of runtime objects needed to invoke the broadcast_join operator.
+ * @details the hash table is owned by the test instead of the broadcast exchange flow and
+ *     passed to the context directly. ctx_ holds references into variables_list_ and task_ctx_,
+ *     so the struct must not be copied or moved. Always create via make_broadcast_join_executor().
+ */
+struct broadcast_join_executor {
+    broadcast_join op_;
+    variable_table_list variables_list_;
+    mock::task_context task_ctx_;
+    broadcast_join_context ctx_;
+
+    broadcast_join_executor(
+        broadcast_join op_arg,
+        variable_table_info const& block_info,
+        exchange::broadcast::hash_table const* table,
+        memory::lifo_paged_memory_resource* res,
+        memory::lifo_paged_memory_resource* varlen_res,
+        request_context* req_ctx
+    ) :
+        op_{std::move(op_arg)},
+        variables_list_{},
+        task_ctx_{{}, {}, {}, {}},
+        ctx_{&task_ctx_, variables_view{variables_list_, 0}, res, varlen_res, table}
+    {
+        variables_list_.emplace_back(block_info);
+        ctx_.task_context().work_context(std::make_unique<impl::work_context>(
+            req_ctx, 0, op_.block_index(), nullptr, nullptr, nullptr, nullptr, false, false
+        ));
+    }
+
+    broadcast_join_executor(broadcast_join_executor const&) = delete;
+    broadcast_join_executor& operator=(broadcast_join_executor const&) = delete;
+    broadcast_join_executor(broadcast_join_executor&&) = delete;
+    broadcast_join_executor& operator=(broadcast_join_executor&&) = delete;
+};
+
+class broadcast_join_test : public test_root, public operator_test_utils {
+public:
+    /**
+     * @brief Insert a join_find node reading the broadcast exchange (K, V) into the process graph.
+     * @details the broadcast columns are mapped to fresh stream variables and the first broadcast
+     *     column is joined with @p key_source. All variables are int8.
+     * @param jk join kind
+     * @param key_source upstream stream variable supplying the key value
+     * @param with_condition if true, the join condition `V > 100` is added
+     * @return reference to the newly inserted node
+     */
+    relation::join_find& add_broadcast_join_node(
+        join_kind jk,
+        descriptor::variable const& key_source,
+        bool with_condition = false
+    ) {
+        std::vector<descriptor::variable> xch_columns{bindings_.exchange_column(), bindings_.exchange_column()};
+        broadcast_ = std::addressof(plan_.insert(std::make_unique<takatori::plan::broadcast>(std::move(xch_columns))));
+        std::vector<relation::join_find::column> cols{};
+        for(auto&& c : broadcast_->columns()) {
+            cols.emplace_back(c, bindings_.stream_variable());
+        }
+        std::vector<relation::join_find::key> keys{};
+        keys.emplace_back(broadcast_->columns()[0], varref{key_source});
+        std::unique_ptr<scalar::expression> condition{};
+        if(with_condition) {
+            condition = std::make_unique<compare>(
+                comparison_operator::greater,
+                varref{cols[1].destination()},
+                immediate{value::int8{100}, t::int8{}}
+            );
+        }
+        auto& target = emplace_operator<relation::join_find>(
+            jk,
+            bindings_.exchange(*broadcast_),
+            std::move(cols),
+            std::move(keys),
+            std::move(condition)
+        );
+        for(auto&& c : target.columns()) {
+            yugawara::analyzer::variable_resolution r{clone_shared(t::int8{})};
+            variable_map_->bind(c.source(), r, true);
+            variable_map_->bind(c.destination(), r, true);
+        }
+        expression_map_->bind(target.keys()[0].value(), t::int8{});
+        if(target.condition()) {
+            auto& cmp = static_cast<compare&>(*target.condition());
+            expression_map_->bind(cmp, t::boolean{});
+            expression_map_->bind(cmp.left(), t::int8{});
+            expression_map_->bind(cmp.right(), t::int8{});
+        }
+        return target;
+    }
+
+    /**
+     * @brief Build the hash table from the broadcast records, keyed by the first field.
+     * @details the records are kept in records_ so that the table entries stay valid.
+     */
+    void build_table(std::vector<basic_record> records) {
+        records_ = std::move(records);
+        meta_ = records_.front().record_meta();
+        table_ = std::make_unique<exchange::broadcast::hash_table>(
+            std::make_shared<exchange::broadcast::broadcast_info>(
+                meta_,
+                std::vector<exchange::broadcast::broadcast_info::field_index_type>{0}
+            )
+        );
+        for(auto&& r : records_) {
+            ASSERT_EQ(status::ok, table_->insert(r.ref()));
+        }
+    }
+
+    /**
+     * @brief Wire the process graph, build processor_info, construct the broadcast_join
+     *     operator, and return a broadcast_join_executor.
+     */
+    broadcast_join_executor make_broadcast_join_executor(
+        relation::step::take_flat& up,
+        relation::join_find& target,
+        record_verifier_sink& down
+    ) {
+        up.output() >> target.left();
+        target.output() >> down.input();
+        create_processor_info();
+        std::vector<descriptor::variable> columns{broadcast_->columns().begin(), broadcast_->columns().end()};
+        meta::variable_order order{
+            variable_ordering_enum_tag<variable_ordering_kind::flat_record>,
+            columns
+        };
+        std::vector<details::search_key_field_info> search_key_fields{};
+        search_key_fields.emplace_back(
+            meta::field_type{field_enum_tag<kind::int8>},
+            false,
+            kvs::spec_key_ascending,
+            expr::evaluator{target.keys()[0].value(), processor_info_->compiled_info(), processor_info_->host_variables()}
+        );
+        broadcast_join op{
+            target.operator_kind(),
+            0,
+            *processor_info_,
+            0,
+            nullptr,
+            order,
+            meta_,
+            target.columns(),
+            std::move(search_key_fields),
+            target.condition(),
+            down.take()
+        };
+        auto const idx = op.block_index();
+        return broadcast_join_executor{
+            std::move(op),
+            processor_info_->vars_info_list()[idx],
+            table_.get(),
+            &resource_,
+            &varlen_resource_,
+            &request_context_
+        };
+    }
+
+    /**
+     * @brief Run the join for the given input record and return the output columns sorted.
+     */
+    std::vector<basic_record> run(
+        broadcast_join_executor& ex,
+        record_verifier_sink& down,
+        input_definition const& in,
+        relation::join_find& target,
+        basic_record input
+    ) {
+        std::vector<basic_record> result{};
+        down.set_body([&]() {
+            result.emplace_back(get_variables(ex.variables_list_[0], destinations(target.columns())));
+        });
+        set_variables(ex.variables_list_[0], in, input.ref());
+        EXPECT_TRUE(static_cast<bool>(ex.op_(ex.ctx_)));
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    takatori::plan::broadcast* broadcast_{};  //NOLINT
+    std::vector<basic_record> records_{};  //NOLINT
+    maybe_shared_ptr<meta::record_meta> meta_{};  //NOLINT
+    std::unique_ptr<exchange::broadcast::hash_table> table_{};  //NOLINT
+};
+
+TEST_F(broadcast_join_test, inner_with_duplicate_keys) {
+    build_table({
+        create_nullable_record<kind::int8, kind::int8>(1, 100),
+        create_nullable_record<kind::int8, kind::int8>(1, 101),
+        create_nullable_record<kind::int8, kind::int8>(2, 200),
+    });
+    auto input = create_nullable_record<kind::int8, kind::int8>(1, 10);
+    auto [up, in] = add_upstream_record_provider(input.record_meta());
+    auto& target = add_broadcast_join_node(join_kind::inner, in[0]);
+    auto down = add_downstream_record_verifier(destinations(target.columns()));
+    auto ex = make_broadcast_join_executor(up, target, down);
+
+    auto result = run(ex, down, in, target, input);
+    ASSERT_EQ(2, result.size());
+    EXPECT_EQ((create_nullable_record<kind::int8, kind::int8>(1, 100)), result[0]);
+    EXPECT_EQ((create_nullable_record<kind::int8, kind::int8>(1, 101)), result[1]);
+
+    result = run(ex, down, in, target, create_nullable_record<kind::int8, kind::int8>(2, 20));
+    ASSERT_EQ(1, result.size());
+    EXPECT_EQ((create_nullable_record<kind::int8, kind::int8>(2, 200)), result[0]);
+    ex.ctx_.release();
+}
+
+TEST_F(broadcast_join_test, inner_no_match) {
+    build_table({
+        create_nullable_record<kind::int8, kind::int8>(1, 100),
+    });
+    auto input = create_nullable_record<kind::int8, kind::int8>(3, 30);
+    auto [up, in] = add_upstream_record_provider(input.record_meta());
+    auto& target = add_broadcast_join_node(join_kind::inner, in[0]);
+    auto down = add_downstream_record_verifier(destinations(target.columns()));
+    auto ex = make_broadcast_join_executor(up, target, down);
+
+    auto result = run(ex, down, in, target, input);
+    EXPECT_TRUE(result.empty());
+    ex.ctx_.release();
+}
+
+TEST_F(broadcast_join_test, null_keys) {
+    // the broadcast record with null key is not added to the table, and the null input key matches nothing
+    build_table({
+        create_nullable_record<kind::int8, kind::int8>(1, 100),
+        create_nullable_record<kind::int8, kind::int8>(std::optional<std::int64_t>{}, std::optional<std::int64_t>{300}),
+    });
+    EXPECT_EQ(1, table_->size());
+    auto input = create_nullable_record<kind::int8, kind::int8>(
+        std::optional<std::int64_t>{},
+        std::optional<std::int64_t>{10}
+    );
+    auto [up, in] = add_upstream_record_provider(input.record_meta());
+    auto& target = add_broadcast_join_node(join_kind::inner, in[0]);
+    auto down = add_downstream_record_verifier(destinations(target.columns()));
+    auto ex = make_broadcast_join_executor(up, target, down);
+
+    auto result = run(ex, down, in, target, input);
+    EXPECT_TRUE(result.empty());
+    ex.ctx_.release();
+}
+
+TEST_F(broadcast_join_test, left_outer) {
+    build_table({
+        create_nullable_record<kind::int8, kind::int8>(1, 100),
+    });
+    auto input = create_nullable_record<kind::int8, kind::int8>(3, 30);
+    auto [up, in] = add_upstream_record_provider(input.record_meta());
+    auto& target = add_broadcast_join_node(join_kind::left_outer, in[0]);
+    auto down = add_downstream_record_verifier(destinations(target.columns()));
+    auto ex = make_broadcast_join_executor(up, target, down);
+
+    auto result = run(ex, down, in, target, input);
+    ASSERT_EQ(1, result.size());
+    EXPECT_EQ((create_nullable_record<kind::int8, kind::int8>(
+        std::optional<std::int64_t>{},
+        std::optional<std::int64_t>{}
+    )), result[0]);
+
+    result = run(ex, down, in, target, create_nullable_record<kind::int8, kind::int8>(1, 10));
+    ASSERT_EQ(1, result.size());
+    EXPECT_EQ((create_nullable_record<kind::int8, kind::int8>(1, 100)), result[0]);
+    ex.ctx_.release();
+}
+
+TEST_F(broadcast_join_test, condition) {
+    build_table({
+        create_nullable_record<kind::int8, kind::int8>(1, 100),
+        create_nullable_record<kind::int8, kind::int8>(1, 101),
+    });
+    auto input = create_nullable_record<kind::int8, kind::int8>(1, 10);
+    auto [up, in] = add_upstream_record_provider(input.record_meta());
+    auto& target = add_broadcast_join_node(join_kind::inner, in[0], true);
+    auto down = add_downstream_record_verifier(destinations(target.columns()));
+    auto ex = make_broadcast_join_executor(up, target, down);
+
+    auto result = run(ex, down, in, target, input);
+    ASSERT_EQ(1, result.size());
+    EXPECT_EQ((create_nullable_record<kind::int8, kind::int8>(1, 101)), result[0]);
+    ex.ctx_.release();
+}
+
+TEST_F(broadcast_join_test, semi) {
+    build_table({
+        create_nullable_record<kind::int8, kind::int8>(1, 100),
+        create_nullable_record<kind::int8, kind::int8>(1, 101),
+    });
+    auto input = create_nullable_record<kind::int8, kind::int8>(1, 10);
+    auto [up, in] = add_upstream_record_provider(input.record_meta());
+    auto& target = add_broadcast_join_node(join_kind::semi, in[0]);
+    auto down = add_downstream_record_verifier(in.vars_);
+    auto ex = make_broadcast_join_executor(up, target, down);
+
+    // semi join emits the left row once even if multiple records match
+    std::size_t count = 0;
+    down.set_body([&]() { ++count; });
+    set_variables(ex.variables_list_[0], in, input.ref());
+    ASSERT_TRUE(static_cast<bool>(ex.op_(ex.ctx_)));
+    EXPECT_EQ(1, count);
+
+    count = 0;
+    set_variables(ex.variables_list_[0], in, create_nullable_record<kind::int8, kind::int8>(2, 20).ref());
+    ASSERT_TRUE(static_cast<bool>(ex.op_(ex.ctx_)));
+    EXPECT_EQ(0, count);
+    ex.ctx_.release();
+}
+
+TEST_F(broadcast_join_test, anti) {
+    build_table({
+        create_nullable_record<kind::int8, kind::int8>(1, 100),
+    });
+    auto input = create_nullable_record<kind::int8, kind::int8>(2, 20);
+    auto [up, in] = add_upstream_record_provider(input.record_meta());
+    auto& target = add_broadcast_join_node(join_kind::anti, in[0]);
+    auto down = add_downstream_record_verifier(in.vars_);
+    auto ex = make_broadcast_join_executor(up, target, down);
+
+    std::size_t count = 0;
+    down.set_body([&]() { ++count; });
+    set_variables(ex.variables_list_[0], in, input.ref());
+    ASSERT_TRUE(static_cast<bool>(ex.op_(ex.ctx_)));
+    EXPECT_EQ(1, count);
+
+    count = 0;
+    set_variables(ex.variables_list_[0], in, create_nullable_record<kind::int8, kind::int8>(1, 10).ref());
+    ASSERT_TRUE(static_cast<bool>(ex.op_(ex.ctx_)));
+    EXPECT_EQ(0, count);
+    ex.ctx_.release();
+}
+
+}  // namespace jogasaki::executor::process::impl::ops
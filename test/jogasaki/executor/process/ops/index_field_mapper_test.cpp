@@ -231,5 +231,202 @@ TEST_F(index_field_mapper_test, without_secondary) {
     }
 }
 
+TEST_F(index_field_mapper_test, covering_secondary) {
+    // secondary value holds the covered column, so the primary entry is not fetched
+    auto t1 = db_->create_storage("T1");
+    auto i2 = db_->create_storage("I2");
+    memory::page_pool pool{};
+    lifo_paged_memory_resource resource{&pool};
+    {
+        {
+            // secondary index(i2) int4,int4 -> int8 with value int4
+            // primary index(t1) is empty
+            std::string src(100, 0);
+            std::string src_v(100, 0);
+            kvs::writable_stream s{src};
+            kvs::writable_stream s_v{src_v};
+
+            basic_record secondary_rec{create_nullable_record<k::int4, k::int4, k::int8, k::int4>(1, 1, 10, 100)};
+            auto secondary_rec_meta = secondary_rec.record_meta();
+            coding_context ctx{};
+            encode_nullable(secondary_rec.ref(), secondary_rec_meta->value_offset(0), secondary_rec_meta->nullity_offset(0), secondary_rec_meta->at(0), spec_asc, ctx, s);
+            encode_nullable(secondary_rec.ref(), secondary_rec_meta->value_offset(1), secondary_rec_meta->nullity_offset(1), secondary_rec_meta->at(1), spec_asc, ctx, s);
+            encode_nullable(secondary_rec.ref(), secondary_rec_meta->value_offset(2), secondary_rec_meta->nullity_offset(2), secondary_rec_meta->at(2), spec_asc, ctx, s);
+            encode_nullable(secondary_rec.ref(), secondary_rec_meta->value_offset(3), secondary_rec_meta->nullity_offset(3), secondary_rec_meta->at(3), spec_value, ctx, s_v);
+
+            auto tx = db_->create_transaction();
+            ASSERT_EQ(status::ok, i2->content_put(*tx, {s.data(), s.size()}, {s_v.data(), s_v.size()}));
+            ASSERT_EQ(status::ok, tx->commit());
+        }
+        {
+            basic_record result{create_nullable_record<k::int8, k::int4>(0, 0)};
+            index_field_mapper mapper{
+                true,
+                {
+                    {
+                        meta::int8_type(),
+                        true,
+                        result.record_meta()->value_offset(0),
+                        result.record_meta()->nullity_offset(0),
+                        true,
+                        kvs::spec_key_ascending
+                    },
+                },
+                {
+                    {
+                        meta::int4_type(),
+                        true,
+                        result.record_meta()->value_offset(1),
+                        result.record_meta()->nullity_offset(1),
+                        true,
+                        kvs::spec_value
+                    },
+                },
+                {
+                    {
+                        meta::int4_type(),
+                        true,
+                        kvs::spec_key_ascending
+                    },
+                    {
+                        meta::int4_type(),
+                        true,
+                        kvs::spec_key_ascending
+                    },
+                },
+                {
+                    {
+                        meta::int4_type(),
+                        true,
+                        result.record_meta()->value_offset(1),
+                        result.record_meta()->nullity_offset(1),
+                        true,
+                        kvs::spec_value
+                    },
+                },
+            };
+            ASSERT_TRUE(mapper.covering());
+            {
+                auto tx = wrap(db_->create_transaction());
+                std::unique_ptr<iterator> it{};
+                ASSERT_EQ(status::ok, i2->content_scan(*tx->object(), "", end_point_kind::unbound, "", end_point_kind::unbound, it));
+                ASSERT_EQ(status::ok, it->next());
+
+                std::string_view key{};
+                std::string_view value{};
+                ASSERT_EQ(status::ok, it->read_key(key));
+                ASSERT_EQ(status::ok, it->read_value(value));
+                request_context req_context{};  // to receive error info
+                ASSERT_EQ(status::ok, mapper.process(key, value, result.ref(), *t1, *tx->object(), &resource, req_context));
+                it.reset();
+                ASSERT_EQ(status::ok, tx->commit());
+                ASSERT_EQ((create_nullable_record<k::int8, k::int4>(10, 100)), result);
+            }
+        }
+    }
 }
 
+TEST_F(index_field_mapper_test, covering_secondary_empty_value) {
+    // secondary entry written without covered columns falls back to the primary entry
+    auto t1 = db_->create_storage("T1");
+    auto i2 = db_->create_storage("I2");
+    memory::page_pool pool{};
+    lifo_paged_memory_resource resource{&pool};
+    {
+        {
+            // secondary index(i2) int4,int4 -> int8 with empty value
+            // primary index(t1)   int8, int4
+            std::string src(100, 0);
+            std::string tgt_k(100, 0);
+            std::string tgt_v(100, 0);
+            kvs::writable_stream s{src};
+            kvs::writable_stream t_k{tgt_k};
+            kvs::writable_stream t_v{tgt_v};
+
+            basic_record secondary_rec{create_nullable_record<k::int4, k::int4, k::int8>(1, 1, 10)};
+            auto secondary_rec_meta = secondary_rec.record_meta();
+            coding_context ctx{};
+            encode_nullable(secondary_rec.ref(), secondary_rec_meta->value_offset(0), secondary_rec_meta->nullity_offset(0), secondary_rec_meta->at(0), spec_asc, ctx, s);
+            encode_nullable(secondary_rec.ref(), secondary_rec_meta->value_offset(1), secondary_rec_meta->nullity_offset(1), secondary_rec_meta->at(1), spec_asc, ctx, s);
+            encode_nullable(secondary_rec.ref(), secondary_rec_meta->value_offset(2), secondary_rec_meta->nullity_offset(2), secondary_rec_meta->at(2), spec_asc, ctx, s);
+
+            basic_record primary_rec{create_nullable_record<k::int8, k::int4>(10, 200)};
+            auto primary_rec_meta = primary_rec.record_meta();
+            encode_nullable(primary_rec.ref(), primary_rec_meta->value_offset(0), primary_rec_meta->nullity_offset(0), primary_rec_meta->at(0), spec_asc, ctx, t_k);
+            encode_nullable(primary_rec.ref(), primary_rec_meta->value_offset(1), primary_rec_meta->nullity_offset(1), primary_rec_meta->at(1), spec_value, ctx, t_v);
+
+            auto tx = db_->create_transaction();
+            ASSERT_EQ(status::ok, i2->content_put(*tx, {s.data(), s.size()}, ""));
+            ASSERT_EQ(status::ok, t1->content_put(*tx, {t_k.data(), t_k.size()}, {t_v.data(), t_v.size()}));
+            ASSERT_EQ(status::ok, tx->commit());
+        }
+        {
+            basic_record result{create_nullable_record<k::int8, k::int4>(0, 0)};
+            index_field_mapper mapper{
+                true,
+                {
+                    {
+                        meta::int8_type(),
+                        true,
+                        result.record_meta()->value_offset(0),
+                        result.record_meta()->nullity_offset(0),
+                        true,
+                        kvs::spec_key_ascending
+                    },
+                },
+                {
+                    {
+                        meta::int4_type(),
+                        true,
+                        result.record_meta()->value_offset(1),
+                        result.record_meta()->nullity_offset(1),
+                        true,
+                        kvs::spec_value
+                    },
+                },
+                {
+                    {
+                        meta::int4_type(),
+                        true,
+                        kvs::spec_key_ascending
+                    },
+                    {
+                        meta::int4_type(),
+                        true,
+                        kvs::spec_key_ascending
+                    },
+                },
+                {
+                    {
+                        meta::int4_type(),
+                        true,
+                        result.record_meta()->value_offset(1),
+                        result.record_meta()->nullity_offset(1),
+                        true,
+                        kvs::spec_value
+                    },
+                },
+            };
+            ASSERT_TRUE(mapper.covering());
+            {
+                auto tx = wrap(db_->create_transaction());
+                std::unique_ptr<iterator> it{};
+                ASSERT_EQ(status::ok, i2->content_scan(*tx->object(), "", end_point_kind::unbound, "", end_point_kind::unbound, it));
+                ASSERT_EQ(status::ok, it->next());
+
+                std::string_view key{};
+                std::string_view value{};
+                ASSERT_EQ(status::ok, it->read_key(key));
+                ASSERT_EQ(status::ok, it->read_value(value));
+                ASSERT_TRUE(value.empty());
+                request_context req_context{};  // to receive error info
+                ASSERT_EQ(status::ok, mapper.process(key, value, result.ref(), *t1, *tx->object(), &resource, req_context));
+                it.reset();
+                ASSERT_EQ(status::ok, tx->commit());
+                ASSERT_EQ((create_nullable_record<k::int8, k::int4>(10, 200)), result);
+            }
+        }
+    }
+}
+
+}
@@ -101,6 +101,7 @@ struct join_find_executor {
     variable_table_list variables_list_;
     mock::task_context task_ctx_;
     std::optional<join_find_context> ctx_;
+    join_find_matcher* matcher_{};
 
     join_find_executor(
         processor_info const& pinfo,
@@ -117,7 +118,8 @@ struct join_find_executor {
         std::shared_ptr<transaction_context> tx_shared,
         memory::lifo_paged_memory_resource* res,
         memory::lifo_paged_memory_resource* varlen_res,
-        request_context* req_ctx
+        request_context* req_ctx,
+        std::size_t probe_cache_size = 0
     ) :
         op_{kind, 0, pinfo, 0, primary_idx, columns, keys,
             condition, secondary_idx, std::move(downstream)},
@@ -127,14 +129,16 @@ struct join_find_executor {
         task_ctx_{{}, {}, {}, {}}
     {
         variables_list_.emplace_back(pinfo.vars_info_list()[op_.block_index()]);
+        auto matcher = std::make_unique<join_find_matcher>(
+            secondary_idx != nullptr, match_info_, op_.key_columns(), op_.value_columns(), probe_cache_size);
+        matcher_ = matcher.get();
         ctx_.emplace(
             &task_ctx_,
             variables_view{variables_list_, 0},
             std::move(primary_stg),
             std::move(secondary_stg),
             tx_raw,
-            std::make_unique<join_find_matcher>(
-                secondary_idx != nullptr, match_info_, op_.key_columns(), op_.value_columns()),
+            std::move(matcher),
             res,
             varlen_res,
             nullptr
@@ -272,6 +276,7 @@ public:
      * @param host_vars    optional host variable table for prepared-statement
      *                     parameters used in condition expressions
      * @param jk           join kind; defaults to inner
+     * @param probe_cache_size max entries of the matcher probe cache; defaults to 0 (disabled)
      * @return newly constructed join_find_executor
      */
     join_find_executor make_join_find_executor(
@@ -284,7 +289,8 @@ public:
         std::unique_ptr<kvs::storage> secondary_stg,
         std::shared_ptr<transaction_context> tx,
         variable_table* host_vars = nullptr,
-        relation::join_kind jk = relation::join_kind::inner
+        relation::join_kind jk = relation::join_kind::inner,
+        std::size_t probe_cache_size = 0
     ) {
         up.output() >> target.left();
         target.output() >> down.input();
@@ -305,7 +311,8 @@ public:
             tx,
             &resource_,
             &varlen_resource_,
-            &request_context_
+            &request_context_,
+            probe_cache_size
         };
     }
 
@@ -423,6 +430,54 @@ TEST_F(join_find_test, simple) {
     ASSERT_EQ(status::ok, tx->commit());
 }
 
+TEST_F(join_find_test, probe_cache) {
+    auto setup = prepare_indices(
+        {"T1", {
+            {"C0", t::int4(), nullity{false}},
+            {"C1", t::int4(), nullity{false}},
+        }},
+        {0}, {}
+    );
+    auto input = create_nullable_record<kind::int4>(1);
+    auto [up, in] = add_upstream_record_provider(input.record_meta());
+    auto& target = add_join_find_node(setup, {0}, {in[0]});
+    auto verifier_vars = in.vars_;
+    auto out_vars = destinations(target.columns());
+    verifier_vars.insert(verifier_vars.end(), out_vars.begin(), out_vars.end());
+    auto down = add_downstream_record_verifier(std::move(verifier_vars));
+
+    put_row(setup, create_nullable_record<kind::int4, kind::int4>(1, 100), *db_);
+    put_row(setup, create_nullable_record<kind::int4, kind::int4>(2, 200), *db_);
+
+    auto tx = wrap(db_->create_transaction());
+    auto ex = make_join_find_executor(
+        up, target, *setup.primary_idx, nullptr, down,
+        get_storage(*db_, setup.primary_idx->simple_name()), nullptr, tx,
+        nullptr, relation::join_kind::inner, 2
+    );
+
+    std::vector<basic_record> result{};
+    down.set_body([&]() {
+        result.emplace_back(get_variables(ex.variables_list_[0], destinations(target.columns())));
+    });
+
+    for(std::int32_t k : {1, 2, 1, 2, 3, 3, 1}) {
+        auto rec = create_nullable_record<kind::int4>(k);
+        set_variables(ex.variables_list_[0], in, rec.ref());
+        ASSERT_TRUE(static_cast<bool>(ex.op_(*ex.ctx_)));
+    }
+    ex.ctx_->release();
+    ASSERT_EQ(5, result.size());
+    EXPECT_EQ((create_nullable_record<kind::int4, kind::int4>(1, 100)), result[0]);
+    EXPECT_EQ((create_nullable_record<kind::int4, kind::int4>(2, 200)), result[1]);
+    EXPECT_EQ((create_nullable_record<kind::int4, kind::int4>(1, 100)), result[2]);
+    EXPECT_EQ((create_nullable_record<kind::int4, kind::int4>(2, 200)), result[3]);
+    EXPECT_EQ((create_nullable_record<kind::int4, kind::int4>(1, 100)), result[4]);
+    // key 1 and 2 hit once each, then the full cache is cleared for key 3 (missing entry), which hits on 2nd probe
+    EXPECT_EQ(3, ex.matcher_->probe_cache_hits());
+    ASSERT_EQ(status::ok, tx->commit());
+}
+
 TEST_F(join_find_test, secondary_index) {
     auto setup = prepare_indices(
         {"T1", {
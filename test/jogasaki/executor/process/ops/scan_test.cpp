@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -898,4 +899,41 @@ TEST_F(scan_test, reversed_bounds) {
     ASSERT_EQ(status::ok, tx->commit());
 }
 
+TEST_F(scan_test, split_range_for_waiting_task) {
+    // another task waits on the pool, so the scan donates the latter half of its range at the yield points and takes
+    // the donated range back after finishing its own part
+    auto cfg = std::make_shared<configuration>();
+    cfg->scan_block_size(1);
+    cfg->scan_yield_interval(0);
+    global::config_pool(cfg);
+
+    auto setup = prepare_single_col_pk_table();
+    for(std::int32_t i = 1; i <= 100; ++i) {
+        put_row(setup, create_nullable_record<kind::int4, kind::int4>(i * 10, i), *db_);
+    }
+    auto pool = std::make_shared<impl::scan_range_pool>();
+    pool->wait();
+
+    auto& target = add_scan_node(setup);
+    auto down = add_downstream_record_verifier(destinations(target.columns()));
+    auto tx = wrap(db_->create_transaction());
+    auto ex = make_scan_executor(target, setup, false, down, tx, nullptr, pool);
+    std::vector<basic_record> result{};
+    down.set_body([&]() {
+        result.emplace_back(get_variables(ex.variables_list_[0], destinations(target.columns())));
+    });
+    operation_status st{};
+    while((st = ex.op_(ex.ctx_)).kind() == operation_status_kind::yield) {}
+    ASSERT_TRUE(static_cast<bool>(st));
+    ex.ctx_.release();
+    EXPECT_LT(0, pool->donated_count());
+    EXPECT_FALSE(pool->has_active());
+    ASSERT_EQ(100, result.size());
+    std::sort(result.begin(), result.end());
+    for(std::int32_t i = 1; i <= 100; ++i) {
+        EXPECT_EQ((create_nullable_record<kind::int4, kind::int4>(i * 10, i)), result[i - 1]);
+    }
+    ASSERT_EQ(status::ok, tx->commit());
+}
+
 }  // namespace jogasaki::executor::process::impl::ops
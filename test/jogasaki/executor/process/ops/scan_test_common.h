@@ -53,6 +53,7 @@
 #include <jogasaki/executor/process/impl/ops/scan.h>
 #include <jogasaki/executor/process/impl/ops/scan_context.h>
 #include <jogasaki/executor/process/impl/scan_range.h>
+#include <jogasaki/executor/process/impl/scan_range_pool.h>
 #include <jogasaki/executor/process/impl/variable_table.h>
 #include <jogasaki/executor/process/impl/variables_view.h>
 #include <jogasaki/executor/process/io_exchange_map.h>
@@ -228,6 +229,7 @@ public:
      * @param secondary_stg KVS storage for the secondary index, or nullptr
      * @param tx            active transaction (used for scan_context)
      * @param host_vars     optional host variable table (passed to create_processor_info)
+     * @param pool          optional pool attached to the scan range to split it at runtime
      * @return newly constructed scan_executor
      */
     scan_executor make_scan_executor(
@@ -238,7 +240,8 @@ public:
         std::unique_ptr<kvs::storage> primary_stg,
         std::unique_ptr<kvs::storage> secondary_stg,
         std::shared_ptr<transaction_context> tx,
-        variable_table* host_vars = nullptr
+        variable_table* host_vars = nullptr,
+        std::shared_ptr<impl::scan_range_pool> pool = {}
     ) {
         target.output() >> down.input();
         create_processor_info(host_vars);
@@ -248,6 +251,9 @@ public:
         io_exchange_map exchange_map{};
         operator_builder builder{processor_info_, {}, {}, exchange_map, &request_context_};
         auto range = (builder.create_scan_ranges(target))[0];
+        if(pool) {
+            range->pool(std::move(pool));
+        }
         return scan_executor{
             range,
             *processor_info_,
@@ -272,6 +278,7 @@ public:
      * @param down          downstream verifier sink
      * @param tx            active transaction
      * @param host_vars     optional host variable table
+     * @param pool          optional pool attached to the scan range to split it at runtime
      * @return newly constructed scan_executor
      */
     scan_executor make_scan_executor(
@@ -280,7 +287,8 @@ public:
         bool use_secondary,
         record_verifier_sink& down,
         std::shared_ptr<transaction_context> tx,
-        variable_table* host_vars = nullptr
+        variable_table* host_vars = nullptr,
+        std::shared_ptr<impl::scan_range_pool> pool = {}
     ) {
         return make_scan_executor(
             target,
@@ -290,7 +298,8 @@ public:
             get_storage(*db_, setup.primary_idx->simple_name()),
             use_secondary ? get_storage(*db_, setup.secondary_idx->simple_name()) : nullptr,
             std::move(tx),
-            host_vars
+            host_vars,
+            std::move(pool)
         );
     }
 
@@ -0,0 +1,63 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <memory>
+#include <gtest/gtest.h>
+
+#include <jogasaki/executor/process/impl/scan_range.h>
+#include <jogasaki/executor/process/impl/scan_range_pool.h>
+#include <jogasaki/test_root.h>
+
+namespace jogasaki::executor::process::impl {
+
+class scan_range_pool_test : public test_root {};
+
+TEST_F(scan_range_pool_test, basic) {
+    scan_range_pool pool{};
+    pool.activate();
+    pool.activate();
+    EXPECT_FALSE(pool.wanted());
+
+    // one task finished its range
+    pool.deactivate();
+    pool.wait();
+    EXPECT_TRUE(pool.wanted());
+    EXPECT_FALSE(pool.take());
+    EXPECT_TRUE(pool.has_active());
+
+    EXPECT_EQ(0, pool.donated_count());
+    pool.donate(std::make_shared<scan_range>());
+    EXPECT_EQ(1, pool.donated_count());
+    EXPECT_FALSE(pool.wanted());
+    auto r = pool.take();
+    ASSERT_TRUE(r);
+    EXPECT_FALSE(pool.wanted());
+    EXPECT_FALSE(pool.take());
+
+    pool.deactivate();
+    pool.deactivate();
+    EXPECT_FALSE(pool.has_active());
+}
+
+TEST_F(scan_range_pool_test, give_up) {
+    scan_range_pool pool{};
+    pool.wait();
+    EXPECT_TRUE(pool.wanted());
+    EXPECT_FALSE(pool.has_active());
+    pool.give_up();
+    EXPECT_FALSE(pool.wanted());
+}
+
+}  // namespace jogasaki::executor::process::impl
@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstdint>
@@ -582,6 +583,70 @@ TEST_F(sequence_manager_test, save_and_recover) {
     }
 }
 
+TEST_F(sequence_manager_test, cached_values) {
+    manager mgr{*db_, {}, 4};
+    EXPECT_EQ(0, mgr.load_id_map());
+    mgr.register_sequence(nullptr, 1, "SEQ1", 0, 2, 0, 9, true);
+    auto* s = mgr.find_sequence(1);
+    ASSERT_TRUE(s);
+    EXPECT_EQ(4, s->cache_size());
+
+    auto tx = db_->create_transaction();
+    EXPECT_EQ(0, s->next(*tx).value());
+    {
+        // the shared value is the high-water mark of the reserved block
+        auto vv = s->get();
+        EXPECT_EQ(2, vv.version_);
+        EXPECT_EQ(6, vv.value_);
+    }
+    EXPECT_EQ(2, s->next(*tx).value());
+    EXPECT_EQ(4, s->next(*tx).value());
+    EXPECT_EQ(6, s->next(*tx).value());
+    EXPECT_EQ(2, s->get().version_);
+
+    // the block stops at the maximum value and the next one cycles
+    EXPECT_EQ(8, s->next(*tx).value());
+    EXPECT_EQ(8, s->get().value_);
+    EXPECT_EQ(0, s->next(*tx).value());
+    EXPECT_EQ(6, s->get().value_);
+    EXPECT_TRUE(mgr.notify_updates(*tx));
+    ASSERT_EQ(status::ok, tx->commit());
+}
+
+TEST_F(sequence_manager_test, cached_values_concurrent) {
+    manager mgr{*db_, {}, 10};
+    EXPECT_EQ(0, mgr.load_id_map());
+    mgr.register_sequence(nullptr, 1, "SEQ1");
+    auto* s = mgr.find_sequence(1);
+    ASSERT_TRUE(s);
+
+    constexpr std::size_t thread_count = 4;
+    constexpr std::size_t value_count = 1000;
+    std::vector<std::vector<sequence_value>> values(thread_count);
+    std::vector<std::thread> threads{};
+    for(std::size_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t]() {
+            auto tx = db_->create_transaction();
+            for(std::size_t i = 0; i < value_count; ++i) {
+                values[t].emplace_back(s->next(*tx).value());
+            }
+            mgr.notify_updates(*tx);
+            (void) tx->commit();
+        });
+    }
+    for(auto&& th : threads) {
+        th.join();
+    }
+    std::vector<sequence_value> all{};
+    for(auto&& v : values) {
+        all.insert(all.end(), v.begin(), v.end());
+    }
+    std::sort(all.begin(), all.end());
+    ASSERT_EQ(thread_count * value_count, all.size());
+    EXPECT_TRUE(std::adjacent_find(all.begin(), all.end()) == all.end());
+    EXPECT_LE(all.back(), s->get().value_);
+}
+
 // This test exercises concurrent access to the sequence manager's internal map.
 // Before fixing sequences_ to tbb::concurrent_hash_map, running this test under
 // ThreadSanitizer would report data races because std::unordered_map is not
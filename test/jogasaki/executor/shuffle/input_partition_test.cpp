@@ -14,11 +14,14 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cstdint>
 #include <iterator>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <utility>
+#include <vector>
 #include <boost/container/container_fwd.hpp>
 #include <boost/cstdint.hpp>
 #include <boost/dynamic_bitset/dynamic_bitset.hpp>
@@ -30,6 +33,7 @@
 
 #include <jogasaki/accessor/record_ref.h>
 #include <jogasaki/accessor/text.h>
+#include <jogasaki/configuration.h>
 #include <jogasaki/constants.h>
 #include <jogasaki/data/record_store.h>
 #include <jogasaki/executor/compare_info.h>
@@ -37,6 +41,7 @@
 #include <jogasaki/executor/exchange/group/input_partition.h>
 #include <jogasaki/executor/exchange/shuffle/pointer_table.h>
 #include <jogasaki/executor/process/impl/variable_table_info.h>
+#include <jogasaki/memory/memory_tracker.h>
 #include <jogasaki/memory/paged_memory_resource.h>
 #include <jogasaki/meta/character_field_option.h>
 #include <jogasaki/meta/field_type.h>
@@ -568,5 +573,212 @@ TEST_F(input_partition_test, sort_desc_asc) {
     EXPECT_EQ(mock::basic_record(ref22, meta), res22);
 }
 
+TEST_F(input_partition_test, spill_sorted_runs) {
+    auto cfg = std::make_shared<configuration>();
+    cfg->exchange_spill_threshold(1);  // spill on every flush
+    auto context = std::make_shared<request_context>(cfg);
+    auto meta = test_record_meta1();
+    input_partition partition{
+        std::make_unique<mock_memory_resource>(),
+        std::make_unique<mock_memory_resource>(),
+        std::make_unique<mock_memory_resource>(),
+        std::make_shared<group_info>(meta, std::vector<std::size_t>{0}),
+        context.get(),
+    };
+    test::record r1 {1, 1.0};
+    test::record r2 {2, 2.0};
+    test::record r3 {3, 3.0};
+
+    partition.write(r3.ref());
+    partition.write(r1.ref());
+    partition.write(r2.ref());
+    partition.flush();
+    EXPECT_EQ(0, partition.tables_count());
+    ASSERT_EQ(3, partition.runs_count());
+    std::vector<std::int64_t> keys{};
+    for(auto& r : partition.runs()) {
+        ASSERT_EQ(1, r->count());
+        ASSERT_TRUE(r->next());
+        keys.emplace_back(accessor::record_ref(r->current(), meta->record_size()).get_value<std::int64_t>(meta->value_offset(0)));
+        ASSERT_FALSE(r->next());
+    }
+    EXPECT_EQ((std::vector<std::int64_t>{3, 1, 2}), keys);
 }
 
+TEST_F(input_partition_test, spill_on_memory_pressure) {
+    // records are spilled on flush when the request tracker nears its limit even below the threshold
+    auto cfg = std::make_shared<configuration>();
+    cfg->exchange_spill_threshold(1UL << 30U);
+    cfg->exchange_spill_memory_percentage(80);
+    auto context = std::make_shared<request_context>(cfg);
+    auto meta = test_record_meta1();
+    auto tracker = std::make_shared<memory_tracker>(nullptr, 100);
+    std::unique_ptr<input_partition> partition{};
+    {
+        memory_tracker_scope scope{tracker};
+        partition = std::make_unique<input_partition>(
+            std::make_unique<mock_memory_resource>(),
+            std::make_unique<mock_memory_resource>(),
+            std::make_unique<mock_memory_resource>(),
+            std::make_shared<group_info>(meta, std::vector<std::size_t>{0}),
+            context.get()
+        );
+    }
+    test::record r1 {1, 1.0};
+    test::record r2 {2, 2.0};
+    test::record r3 {3, 3.0};
+
+    partition->write(r2.ref());
+    partition->flush();
+    EXPECT_EQ(1, partition->tables_count());
+    EXPECT_EQ(0, partition->runs_count());
+
+    tracker->consume(80);
+    partition->write(r3.ref());
+    partition->write(r1.ref());
+    partition->flush();
+    EXPECT_EQ(0, partition->tables_count());
+    ASSERT_EQ(1, partition->runs_count());
+    std::vector<std::int64_t> keys{};
+    auto& run = partition->runs()[0];
+    while(run->next()) {
+        keys.emplace_back(accessor::record_ref(run->current(), meta->record_size()).get_value<std::int64_t>(meta->value_offset(0)));
+    }
+    EXPECT_EQ((std::vector<std::int64_t>{1, 2, 3}), keys);
+    tracker->release(80);
+}
+
+TEST_F(input_partition_test, merge_spilled_runs) {
+    // every merge_fan_in runs are merged into one so that the number of runs stays small
+    auto cfg = std::make_shared<configuration>();
+    cfg->exchange_spill_threshold(1);  // spill on every flush
+    auto context = std::make_shared<request_context>(cfg);
+    auto meta = test_record_meta1();
+    input_partition partition{
+        std::make_unique<mock_memory_resource>(),
+        std::make_unique<mock_memory_resource>(),
+        std::make_unique<mock_memory_resource>(),
+        std::make_shared<group_info>(meta, std::vector<std::size_t>{0}),
+        context.get(),
+    };
+    auto fan_in = input_partition::merge_fan_in;
+    std::size_t count = fan_in * fan_in + 1;
+    for(std::size_t i=0; i < count; ++i) {
+        test::record r{static_cast<std::int64_t>(count - i), static_cast<double>(i)};
+        partition.write(r.ref());
+    }
+    partition.flush();
+    EXPECT_EQ(0, partition.tables_count());
+    ASSERT_EQ(2, partition.runs_count());
+    EXPECT_EQ(fan_in * fan_in, partition.runs()[0]->count());
+    EXPECT_EQ(1, partition.runs()[1]->count());
+
+    std::vector<std::int64_t> keys{};
+    auto& run = partition.runs()[0];
+    while(run->next()) {
+        keys.emplace_back(accessor::record_ref(run->current(), meta->record_size()).get_value<std::int64_t>(meta->value_offset(0)));
+    }
+    ASSERT_EQ(fan_in * fan_in, keys.size());
+    EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+    EXPECT_EQ(2, keys.front());
+
+    // the run can be read again from the beginning
+    run->rewind();
+    ASSERT_TRUE(run->next());
+    EXPECT_EQ(2, accessor::record_ref(run->current(), meta->record_size()).get_value<std::int64_t>(meta->value_offset(0)));
+}
+
+
+TEST_F(input_partition_test, shrink_to_limit) {
+    auto context = std::make_shared<request_context>();
+    auto meta = test_record_meta1();
+    input_partition partition{
+        std::make_unique<mock_memory_resource>(),
+        std::make_unique<mock_memory_resource>(),
+        std::make_unique<mock_memory_resource>(),
+        std::make_shared<group_info>(
+            meta,
+            std::vector<std::size_t>{0},
+            std::vector<std::size_t>{1},
+            std::vector<ordering>{ordering::ascending},
+            2
+        ),
+        context.get(),
+        3
+    };
+    test::record r13 {1, 3.0};
+    test::record r11 {1, 1.0};
+    test::record r25 {2, 5.0};
+    test::record r10 {1, 0.5};
+    test::record r12 {1, 2.0};
+    test::record r24 {2, 4.0};
+
+    partition.write(r13.ref());
+    partition.write(r11.ref());
+    partition.write(r25.ref());  // table is full and flushed - no group exceeds the limit yet
+    partition.write(r10.ref());
+    partition.write(r12.ref());
+    partition.write(r24.ref());  // group 1 exceeds the limit
+    partition.flush();
+
+    auto record_size = meta->record_size();
+    auto c1_offset = meta->value_offset(0);
+    auto c2_offset = meta->value_offset(1);
+    std::vector<std::pair<std::int64_t, double>> result{};
+    for(auto& t : partition) {
+        for(auto p : t) {
+            accessor::record_ref rec{p, record_size};
+            result.emplace_back(rec.get_value<std::int64_t>(c1_offset), rec.get_value<double>(c2_offset));
+        }
+    }
+    // survivors are compacted into tables holding the merged records
+    EXPECT_EQ(2, partition.tables_count());
+    std::vector<std::pair<std::int64_t, double>> exp{{1, 0.5}, {1, 1.0}, {2, 4.0}, {2, 5.0}};
+    EXPECT_EQ(exp, result);
+}
+
+TEST_F(input_partition_test, trim_table_to_limit) {
+    // the flushed table is trimmed by itself, and the tables are not merged until the kept records grow enough
+    auto context = std::make_shared<request_context>();
+    auto meta = test_record_meta1();
+    input_partition partition{
+        std::make_unique<mock_memory_resource>(),
+        std::make_unique<mock_memory_resource>(),
+        std::make_unique<mock_memory_resource>(),
+        std::make_shared<group_info>(
+            meta,
+            std::vector<std::size_t>{0},
+            std::vector<std::size_t>{1},
+            std::vector<ordering>{ordering::ascending},
+            1
+        ),
+        context.get(),
+        4
+    };
+    test::record r13 {1, 3.0};
+    test::record r11 {1, 1.0};
+    test::record r12 {1, 2.0};
+    test::record r25 {2, 5.0};
+
+    partition.write(r13.ref());
+    partition.write(r11.ref());
+    partition.write(r12.ref());
+    partition.write(r25.ref());  // table is full and flushed
+    partition.flush();
+
+    auto record_size = meta->record_size();
+    auto c1_offset = meta->value_offset(0);
+    auto c2_offset = meta->value_offset(1);
+    std::vector<std::pair<std::int64_t, double>> result{};
+    for(auto& t : partition) {
+        for(auto p : t) {
+            accessor::record_ref rec{p, record_size};
+            result.emplace_back(rec.get_value<std::int64_t>(c1_offset), rec.get_value<double>(c2_offset));
+        }
+    }
+    EXPECT_EQ(1, partition.tables_count());
+    std::vector<std::pair<std::int64_t, double>> exp{{1, 1.0}, {2, 5.0}};
+    EXPECT_EQ(exp, result);
+}
+
+}
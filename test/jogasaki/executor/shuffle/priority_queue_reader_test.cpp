@@ -27,6 +27,7 @@
 #include <takatori/util/maybe_shared_ptr.h>
 
 #include <jogasaki/accessor/record_ref.h>
+#include <jogasaki/configuration.h>
 #include <jogasaki/data/record_store.h>
 #include <jogasaki/executor/compare_info.h>
 #include <jogasaki/executor/exchange/group/group_info.h>
@@ -485,5 +486,50 @@ TEST_F(priority_queue_reader_test, record_limit_per_group) {
 
 }
 
+TEST_F(priority_queue_reader_test, merge_spilled_runs) {
+    auto cfg = std::make_shared<configuration>();
+    cfg->exchange_spill_threshold(64);
+    auto context = std::make_shared<request_context>(cfg);
+    std::vector<std::unique_ptr<input_partition>> partitions{};
+    partitions.reserve(10); // avoid relocation when using references into vector
+    auto& p1 = partitions.emplace_back(std::make_unique<input_partition>(
+            std::make_unique<mock_memory_resource>(),
+            std::make_unique<mock_memory_resource>(),
+            std::make_unique<mock_memory_resource>(),
+            info,
+            context.get()
+            ));
+    auto& p2 = partitions.emplace_back(std::make_unique<input_partition>(
+            std::make_unique<mock_memory_resource>(),
+            std::make_unique<mock_memory_resource>(),
+            std::make_unique<mock_memory_resource>(),
+            info,
+            context.get()
+    ));
+    for(std::int64_t i=0; i < 10; ++i) {
+        test::record rec{(i * 7) % 5, static_cast<double>(i)};
+        (i % 2 == 0 ? p1 : p2)->write(rec.ref());
+    }
+    p1->flush();
+    p2->flush();
+    ASSERT_LT(0, p1->runs_count());
+    ASSERT_LT(0, p2->runs_count());
+
+    priority_queue_reader r{info, partitions};
+    std::size_t members = 0;
+    for(std::int64_t key=0; key < 5; ++key) {
+        ASSERT_TRUE(r.next_group());
+        EXPECT_EQ(key, get_key(r));
+        std::multiset<double> res{};
+        while(r.next_member()) {
+            res.emplace(get_value(r));
+            ++members;
+        }
+        EXPECT_EQ(2, res.size());
+    }
+    ASSERT_FALSE(r.next_group());
+    EXPECT_EQ(10, members);
+}
+
 }
 
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <boost/dynamic_bitset/dynamic_bitset.hpp>
+#include <gtest/gtest.h>
+
+#include <jogasaki/accessor/record_ref.h>
+#include <jogasaki/accessor/text.h>
+#include <jogasaki/executor/exchange/shuffle/spilled_run.h>
+#include <jogasaki/meta/character_field_option.h>
+#include <jogasaki/meta/field_type.h>
+#include <jogasaki/meta/field_type_kind.h>
+#include <jogasaki/meta/record_meta.h>
+#include <jogasaki/mock_memory_resource.h>
+#include <jogasaki/test_root.h>
+
+namespace jogasaki::executor::exchange::shuffle {
+
+using namespace meta;
+using namespace accessor;
+using namespace std::string_view_literals;
+using namespace std::string_literals;
+
+using kind = meta::field_type_kind;
+
+class spilled_run_test : public test_root {};
+
+TEST_F(spilled_run_test, write_and_read_text) {
+    struct S {
+        text t1_{};
+        double f_{};
+        text t2_{};
+        char n_[1];
+    };
+    std::size_t nullity_base = offsetof(S, n_) * bits_per_byte;
+    auto meta = std::make_shared<meta::record_meta>(
+        std::vector<field_type>{
+            field_type(std::make_shared<meta::character_field_option>()),
+            field_type(field_enum_tag<kind::float8>),
+            field_type(std::make_shared<meta::character_field_option>()),
+        },
+        boost::dynamic_bitset<std::uint64_t>{"111"s},
+        std::vector<std::size_t>{
+            offsetof(S, t1_),
+            offsetof(S, f_),
+            offsetof(S, t2_),
+        },
+        std::vector<std::size_t>{nullity_base + 0, nullity_base + 1, nullity_base + 2},
+        alignof(S),
+        sizeof(S)
+    );
+    mock_memory_resource res{};
+    std::string long_str(100, 'A');
+    S r1{text{&res, "111"sv}, 1.0, text{&res, long_str}, '\0'};
+    S r2{text{&res, "222"sv}, 2.0, text{}, '\0'};
+    accessor::record_ref ref1{&r1, sizeof(S)};
+    accessor::record_ref ref2{&r2, sizeof(S)};
+    ref2.set_null(meta->nullity_offset(2), true);
+
+    std::filesystem::path path{};
+    {
+        spilled_run run{meta, spilled_run::create_path("")};
+        path = run.path();
+        ASSERT_TRUE(run.write(ref1));
+        ASSERT_TRUE(run.write(ref2));
+        ASSERT_TRUE(run.finish_write());
+        EXPECT_EQ(2, run.count());
+        ASSERT_TRUE(std::filesystem::exists(path));
+
+        ASSERT_TRUE(run.next());
+        accessor::record_ref res1{run.current(), sizeof(S)};
+        ASSERT_TRUE(run.next());
+        accessor::record_ref res2{run.current(), sizeof(S)};
+
+        // previous record is still valid
+        EXPECT_EQ("111"sv, static_cast<std::string_view>(res1.get_value<text>(meta->value_offset(0))));
+        EXPECT_EQ(1.0, res1.get_value<double>(meta->value_offset(1)));
+        EXPECT_EQ(long_str, static_cast<std::string_view>(res1.get_value<text>(meta->value_offset(2))));
+        EXPECT_EQ("222"sv, static_cast<std::string_view>(res2.get_value<text>(meta->value_offset(0))));
+        EXPECT_EQ(2.0, res2.get_value<double>(meta->value_offset(1)));
+        EXPECT_TRUE(res2.is_null(meta->nullity_offset(2)));
+        ASSERT_FALSE(run.next());
+    }
+    EXPECT_FALSE(std::filesystem::exists(path));
+}
+
+}  // namespace jogasaki::executor::exchange::shuffle
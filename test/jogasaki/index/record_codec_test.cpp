@@ -0,0 +1,145 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <jogasaki/accessor/text.h>
+#include <jogasaki/index/field_info.h>
+#include <jogasaki/index/record_codec.h>
+#include <jogasaki/kvs/coder.h>
+#include <jogasaki/kvs/coding_context.h>
+#include <jogasaki/kvs/readable_stream.h>
+#include <jogasaki/kvs/writable_stream.h>
+#include <jogasaki/meta/field_type_kind.h>
+#include <jogasaki/mock/basic_record.h>
+#include <jogasaki/mock_memory_resource.h>
+#include <jogasaki/status.h>
+#include <jogasaki/test_root.h>
+
+namespace jogasaki::index {
+
+using namespace std::string_view_literals;
+
+using kind = meta::field_type_kind;
+
+class record_codec_test : public test_root {};
+
+std::vector<field_info> create_fields(
+    mock::basic_record const& rec,
+    std::vector<bool> const& nullables,
+    std::vector<kvs::coding_spec> const& specs
+) {
+    std::vector<field_info> ret{};
+    auto& meta = rec.record_meta();
+    for(std::size_t i = 0, n = meta->field_count(); i < n; ++i) {
+        ret.emplace_back(meta->at(i), true, meta->value_offset(i), meta->nullity_offset(i), nullables[i], specs[i]);
+    }
+    return ret;
+}
+
+TEST_F(record_codec_test, encode_decode) {
+    mock_memory_resource resource{};
+    auto src = mock::create_nullable_record<kind::int4, kind::int8, kind::character, kind::float8>(
+        1, -2, accessor::text{&resource, "ABC"sv}, std::nullopt
+    );
+    auto fields = create_fields(
+        src,
+        {false, false, true, true},
+        {kvs::spec_key_ascending, kvs::spec_key_descending, kvs::spec_key_ascending, kvs::spec_key_ascending}
+    );
+    record_codec codec{fields};
+    EXPECT_EQ(2, codec.fixed_prefix_count());
+    EXPECT_EQ(sizeof(std::int32_t) + sizeof(std::int64_t), codec.fixed_prefix_bytes());
+
+    std::string buf(100, 0);
+    kvs::writable_stream s{buf};
+    ASSERT_EQ(status::ok, codec.encode(src.ref(), s));
+
+    // same encoding as field-by-field coder
+    std::string exp(100, 0);
+    kvs::writable_stream es{exp};
+    for(auto&& f : fields) {
+        kvs::coding_context ctx{};
+        ctx.coding_for_write(true);
+        if(f.nullable_) {
+            ASSERT_EQ(status::ok, kvs::encode_nullable(src.ref(), f.offset_, f.nullity_offset_, f.type_, f.spec_, ctx, es));
+            continue;
+        }
+        ASSERT_EQ(status::ok, kvs::encode(src.ref(), f.offset_, f.type_, f.spec_, ctx, es));
+    }
+    ASSERT_EQ(es.size(), s.size());
+    EXPECT_EQ(exp.substr(0, es.size()), buf.substr(0, s.size()));
+
+    auto dest = mock::create_nullable_record<kind::int4, kind::int8, kind::character, kind::float8>();
+    auto rs = s.readable();
+    ASSERT_EQ(status::ok, codec.decode(rs, dest.ref(), &resource));
+    EXPECT_EQ(s.size(), rs.size());
+    EXPECT_EQ(src, dest);
+}
+
+TEST_F(record_codec_test, decode_skips_missing_fields) {
+    mock_memory_resource resource{};
+    auto src = mock::create_nullable_record<kind::int8, kind::character, kind::int4>(
+        10, accessor::text{&resource, "ABC"sv}, 20
+    );
+    auto fields = create_fields(
+        src,
+        {false, true, false},
+        {kvs::spec_key_ascending, kvs::spec_key_ascending, kvs::spec_key_ascending}
+    );
+    record_codec codec{fields};
+    std::string buf(100, 0);
+    kvs::writable_stream s{buf};
+    ASSERT_EQ(status::ok, codec.encode(src.ref(), s));
+
+    fields[0].exists_ = false;
+    fields[1].exists_ = false;
+    record_codec reader{fields};
+    auto dest = mock::create_nullable_record<kind::int8, kind::character, kind::int4>(std::nullopt, std::nullopt, 0);
+    auto rs = s.readable();
+    ASSERT_EQ(status::ok, reader.decode(rs, dest.ref(), &resource));
+    EXPECT_TRUE(dest.is_null(0));
+    EXPECT_TRUE(dest.is_null(1));
+    EXPECT_EQ(20, dest.get_value<std::int32_t>(2));
+}
+
+TEST_F(record_codec_test, truncated_data) {
+    auto src = mock::create_nullable_record<kind::int8, kind::int8>(1, 2);
+    auto fields = create_fields(src, {false, false}, {kvs::spec_key_ascending, kvs::spec_key_ascending});
+    record_codec codec{fields};
+    std::string buf(100, 0);
+    kvs::writable_stream s{buf};
+    ASSERT_EQ(status::ok, codec.encode(src.ref(), s));
+
+    // shorter than the fixed-width prefix - falls back to checked decoding and detects the corruption
+    kvs::readable_stream rs{buf.data(), s.size() - 1};
+    auto dest = mock::create_nullable_record<kind::int8, kind::int8>();
+    EXPECT_EQ(status::err_data_corruption, codec.decode(rs, dest.ref(), nullptr));
+}
+
+TEST_F(record_codec_test, null_for_non_nullable) {
+    auto src = mock::create_nullable_record<kind::int4, kind::int4>(1, std::nullopt);
+    auto fields = create_fields(src, {false, false}, {kvs::spec_key_ascending, kvs::spec_key_ascending});
+    record_codec codec{fields};
+    std::string buf(100, 0);
+    kvs::writable_stream s{buf};
+    EXPECT_EQ(status::err_integrity_constraint_violation, codec.encode(src.ref(), s));
+}
+
+}  // namespace jogasaki::index
@@ -0,0 +1,118 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <memory>
+#include <gtest/gtest.h>
+
+#include <jogasaki/memory/lifo_paged_memory_resource.h>
+#include <jogasaki/memory/memory_tracker.h>
+#include <jogasaki/memory/monotonic_paged_memory_resource.h>
+#include <jogasaki/memory/page_pool.h>
+
+namespace jogasaki::testing {
+
+using namespace memory;
+
+class memory_tracker_test : public ::testing::Test {};
+
+TEST_F(memory_tracker_test, hierarchy) {
+    auto root = std::make_shared<memory_tracker>();
+    auto job = std::make_shared<memory_tracker>(root, 100);
+    ASSERT_TRUE(job->try_consume(60));
+    EXPECT_EQ(60, job->consumed());
+    EXPECT_EQ(60, root->consumed());
+    EXPECT_FALSE(job->try_consume(60));
+    EXPECT_EQ(60, job->consumed());
+    EXPECT_EQ(60, root->consumed());
+    job->release(20);
+    EXPECT_EQ(40, job->consumed());
+    EXPECT_EQ(40, root->consumed());
+    EXPECT_EQ(60, job->peak());
+    EXPECT_EQ(60, root->peak());
+}
+
+TEST_F(memory_tracker_test, parent_limit) {
+    auto root = std::make_shared<memory_tracker>(nullptr, 100);
+    auto job0 = std::make_shared<memory_tracker>(root);
+    auto job1 = std::make_shared<memory_tracker>(root);
+    ASSERT_TRUE(job0->try_consume(80));
+    EXPECT_FALSE(job1->try_consume(30));
+    EXPECT_EQ(0, job1->consumed());
+    EXPECT_EQ(80, root->consumed());
+    EXPECT_FALSE(root->reaches(90));
+    job1->consume(10);
+    EXPECT_TRUE(root->reaches(90));
+}
+
+TEST_F(memory_tracker_test, reaches_with_ancestors) {
+    auto root = std::make_shared<memory_tracker>(nullptr, 100);
+    auto job = std::make_shared<memory_tracker>(root, 1000);
+    auto other = std::make_shared<memory_tracker>(root);
+    job->consume(50);
+    EXPECT_FALSE(job->reaches(80));
+    EXPECT_FALSE(job->reaches_with_ancestors(80));
+    other->consume(30);
+    EXPECT_FALSE(job->reaches(80));
+    EXPECT_TRUE(job->reaches_with_ancestors(80));
+    EXPECT_FALSE(std::make_shared<memory_tracker>()->reaches_with_ancestors(80));
+}
+
+TEST_F(memory_tracker_test, resource_charges_pages) {
+    page_pool pool{};
+    auto root = std::make_shared<memory_tracker>();
+    auto job = std::make_shared<memory_tracker>(root);
+    {
+        memory_tracker_scope scope{job};
+        monotonic_paged_memory_resource resource{&pool};
+        EXPECT_EQ(job, resource.tracker());
+        (void) resource.allocate(page_size / 2);
+        (void) resource.allocate(page_size / 2 + 1);
+        EXPECT_EQ(2 * page_size, job->consumed());
+        EXPECT_EQ(2 * page_size, root->consumed());
+    }
+    EXPECT_EQ(0, job->consumed());
+    EXPECT_EQ(0, root->consumed());
+}
+
+TEST_F(memory_tracker_test, move_charge_to_other_tracker) {
+    page_pool pool{};
+    auto root = std::make_shared<memory_tracker>();
+    auto job0 = std::make_shared<memory_tracker>(root);
+    auto job1 = std::make_shared<memory_tracker>(root);
+    {
+        memory_tracker_scope scope{job0};
+        lifo_paged_memory_resource resource{&pool};
+        (void) resource.allocate(1);
+        EXPECT_EQ(page_size, job0->consumed());
+        resource.tracker(job1);
+        EXPECT_EQ(0, job0->consumed());
+        EXPECT_EQ(page_size, job1->consumed());
+        EXPECT_EQ(page_size, root->consumed());
+    }
+    EXPECT_EQ(0, job1->consumed());
+    EXPECT_EQ(0, root->consumed());
+}
+
+TEST_F(memory_tracker_test, limit_exceeded) {
+    page_pool pool{};
+    auto job = std::make_shared<memory_tracker>(nullptr, page_size);
+    memory_tracker_scope scope{job};
+    monotonic_paged_memory_resource resource{&pool};
+    (void) resource.allocate(page_size);
+    EXPECT_THROW((void) resource.allocate(1), memory_limit_exceeded);
+    EXPECT_EQ(page_size, job->consumed());
+}
+
+}  // namespace jogasaki::testing
@@ -0,0 +1,134 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <takatori/util/downcast.h>
+
+#include <jogasaki/api/executable_statement.h>
+#include <jogasaki/api/field_type_kind.h>
+#include <jogasaki/api/impl/executable_statement.h>
+#include <jogasaki/api/impl/prepared_statement.h>
+#include <jogasaki/api/parameter_set.h>
+#include <jogasaki/api/statement_handle.h>
+#include <jogasaki/configuration.h>
+#include <jogasaki/executor/common/execute.h>
+#include <jogasaki/executor/common/graph.h>
+#include <jogasaki/executor/process/processor_info.h>
+#include <jogasaki/executor/process/step.h>
+#include <jogasaki/mock/basic_record.h>
+#include <jogasaki/model/step_kind.h>
+#include <jogasaki/plan/execute_template.h>
+#include <jogasaki/plan/prepared_statement.h>
+#include <jogasaki/status.h>
+#include <jogasaki/utils/create_tx.h>
+
+#include "../api/api_test_base.h"
+
+namespace jogasaki::testing {
+
+using namespace std::string_view_literals;
+using takatori::util::unsafe_downcast;
+
+using kind = meta::field_type_kind;
+
+class execute_template_test :
+    public ::testing::Test,
+    public api_test_base {
+
+public:
+    bool to_explain() override {
+        return false;
+    }
+
+    void SetUp() override {
+        auto cfg = std::make_shared<configuration>();
+        db_setup(cfg);
+    }
+
+    void TearDown() override {
+        db_teardown();
+    }
+};
+
+executor::common::graph& graph_of(api::executable_statement& stmt) {
+    auto& body = unsafe_downcast<api::impl::executable_statement>(stmt).body();
+    return unsafe_downcast<executor::common::execute>(*body->operators()).operators();
+}
+
+TEST_F(execute_template_test, reuse_for_executions) {
+    execute_statement("CREATE TABLE T (C0 INT PRIMARY KEY, C1 INT)");
+    execute_statement("INSERT INTO T VALUES (1,10),(2,20),(3,10)");
+    std::unordered_map<std::string, api::field_type_kind> variables{
+        {"p0", api::field_type_kind::int4},
+    };
+    api::statement_handle prepared{};
+    ASSERT_EQ(status::ok, db_->prepare("SELECT C1, COUNT(*) FROM T WHERE C0 >= :p0 GROUP BY C1", variables, prepared));
+    auto& body = reinterpret_cast<api::impl::prepared_statement*>(prepared.get())->body();  //NOLINT
+    EXPECT_FALSE(body->execute_template());
+
+    std::vector<std::unique_ptr<api::executable_statement>> execs{};
+    for(std::int32_t p0 : {1, 3}) {
+        auto ps = api::create_parameter_set();
+        ps->set_int4("p0", p0);
+        std::unique_ptr<api::executable_statement> exec{};
+        ASSERT_EQ(status::ok, db_->resolve(prepared, std::shared_ptr{std::move(ps)}, exec));
+        execs.emplace_back(std::move(exec));
+    }
+    auto tmpl = body->execute_template();
+    ASSERT_TRUE(tmpl);
+    auto& g0 = graph_of(*execs[0]);
+    auto& g1 = graph_of(*execs[1]);
+    ASSERT_NE(&g0, &g1);
+    ASSERT_EQ(tmpl->prototype().size(), g0.size());
+    ASSERT_EQ(tmpl->prototype().size(), g1.size());
+    for(std::size_t i = 0, n = g0.size(); i < n; ++i) {
+        auto& s0 = unsafe_downcast<executor::common::step>(*g0.steps()[i]);
+        auto& s1 = unsafe_downcast<executor::common::step>(*g1.steps()[i]);
+        ASSERT_EQ(s0.kind(), s1.kind());
+        if(s0.kind() == model::step_kind::process) {
+            auto& p0 = unsafe_downcast<executor::process::step>(s0);
+            auto& p1 = unsafe_downcast<executor::process::step>(s1);
+            // compiled information is shared, but host variables are bound to each execution
+            EXPECT_EQ(p0.relation_io_map(), p1.relation_io_map());
+            EXPECT_EQ(p0.io_info(), p1.io_info());
+            EXPECT_NE(p0.info()->host_variables(), p1.info()->host_variables());
+        }
+    }
+    execs.clear();
+
+    {
+        auto tx = utils::create_transaction(*db_);
+        auto ps = api::create_parameter_set();
+        ps->set_int4("p0", 2);
+        std::vector<mock::basic_record> result{};
+        execute_query(prepared, *ps, *tx, result);
+        ASSERT_EQ(2, result.size());
+        std::sort(result.begin(), result.end());
+        EXPECT_EQ((mock::create_nullable_record<kind::int4, kind::int8>(10, 1)), result[0]);
+        EXPECT_EQ((mock::create_nullable_record<kind::int4, kind::int8>(20, 1)), result[1]);
+        ASSERT_EQ(status::ok, tx->commit());
+    }
+    EXPECT_EQ(tmpl, body->execute_template());
+    ASSERT_EQ(status::ok, db_->destroy_statement(prepared));
+}
+
+}  // namespace jogasaki::testing
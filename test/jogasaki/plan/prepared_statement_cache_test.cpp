@@ -0,0 +1,139 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <gtest/gtest.h>
+
+#include <jogasaki/api/field_type_kind.h>
+#include <jogasaki/api/impl/database.h>
+#include <jogasaki/api/impl/prepared_statement.h>
+#include <jogasaki/api/statement_handle.h>
+#include <jogasaki/configuration.h>
+#include <jogasaki/plan/compile_option.h>
+#include <jogasaki/plan/prepared_statement.h>
+#include <jogasaki/plan/prepared_statement_cache.h>
+#include <jogasaki/status.h>
+
+#include "../api/api_test_base.h"
+
+namespace jogasaki::testing {
+
+using namespace std::string_view_literals;
+
+using plan::prepared_statement_cache;
+
+class prepared_statement_cache_test :
+    public ::testing::Test,
+    public api_test_base {
+
+public:
+    bool to_explain() override {
+        return false;
+    }
+
+    void SetUp() override {
+        auto cfg = std::make_shared<configuration>();
+        cfg->prepared_statement_cache_size(10);
+        db_setup(cfg);
+    }
+
+    void TearDown() override {
+        db_teardown();
+    }
+
+    std::shared_ptr<plan::prepared_statement> const& body_of(api::statement_handle handle) {
+        return reinterpret_cast<api::impl::prepared_statement*>(handle.get())->body();  //NOLINT
+    }
+};
+
+TEST_F(prepared_statement_cache_test, create_key) {
+    std::unordered_map<std::string, api::field_type_kind> v0{
+        {"p0", api::field_type_kind::int4},
+        {"p1", api::field_type_kind::character},
+    };
+    std::unordered_map<std::string, api::field_type_kind> v1{
+        {"p0", api::field_type_kind::int8},
+        {"p1", api::field_type_kind::character},
+    };
+    auto k0 = prepared_statement_cache::create_key("select * from T"sv, v0, {});
+    EXPECT_EQ(k0, prepared_statement_cache::create_key("  select * from T\n"sv, v0, {}));
+    EXPECT_NE(k0, prepared_statement_cache::create_key("select  * from T"sv, v0, {}));
+    EXPECT_NE(k0, prepared_statement_cache::create_key("select * from T"sv, v1, {}));
+    EXPECT_NE(k0, prepared_statement_cache::create_key("select * from T"sv, {}, {}));
+}
+
+TEST_F(prepared_statement_cache_test, lru_eviction) {
+    prepared_statement_cache cache{2};
+    auto s0 = std::make_shared<plan::prepared_statement>();
+    auto s1 = std::make_shared<plan::prepared_statement>();
+    auto s2 = std::make_shared<plan::prepared_statement>();
+    auto v = cache.version();
+    ASSERT_TRUE(cache.put("k0", s0, v));
+    ASSERT_TRUE(cache.put("k1", s1, v));
+    EXPECT_EQ(s0, cache.find("k0"));  // k1 is the least recently used
+    ASSERT_TRUE(cache.put("k2", s2, v));
+    EXPECT_EQ(2, cache.size());
+    EXPECT_EQ(s0, cache.find("k0"));
+    EXPECT_FALSE(cache.find("k1"));
+    EXPECT_EQ(s2, cache.find("k2"));
+    EXPECT_EQ(3, cache.hit_count());
+}
+
+TEST_F(prepared_statement_cache_test, invalidate) {
+    prepared_statement_cache cache{2};
+    auto s0 = std::make_shared<plan::prepared_statement>();
+    auto v = cache.version();
+    ASSERT_TRUE(cache.put("k0", s0, v));
+    cache.invalidate();
+    EXPECT_FALSE(cache.find("k0"));
+    // statement compiled with old schema is not cached
+    EXPECT_FALSE(cache.put("k0", s0, v));
+    EXPECT_TRUE(cache.put("k0", s0, cache.version()));
+}
+
+TEST_F(prepared_statement_cache_test, disabled) {
+    prepared_statement_cache cache{};
+    EXPECT_FALSE(cache.enabled());
+    EXPECT_FALSE(cache.put("k0", std::make_shared<plan::prepared_statement>(), cache.version()));
+    EXPECT_FALSE(cache.find("k0"));
+}
+
+TEST_F(prepared_statement_cache_test, share_across_prepare) {
+    execute_statement("CREATE TABLE T (C0 INT PRIMARY KEY, C1 INT)");
+    std::unordered_map<std::string, api::field_type_kind> variables{
+        {"p0", api::field_type_kind::int4},
+    };
+    api::statement_handle h0{};
+    api::statement_handle h1{};
+    ASSERT_EQ(status::ok, db_->prepare("SELECT C1 FROM T WHERE C0 = :p0", variables, h0));
+    ASSERT_EQ(status::ok, db_->prepare("SELECT C1 FROM T WHERE C0 = :p0", variables, h1));
+    EXPECT_NE(h0, h1);
+    EXPECT_EQ(body_of(h0), body_of(h1));
+
+    // DDL invalidates the cache
+    execute_statement("CREATE TABLE T2 (C0 INT PRIMARY KEY)");
+    api::statement_handle h2{};
+    ASSERT_EQ(status::ok, db_->prepare("SELECT C1 FROM T WHERE C0 = :p0", variables, h2));
+    EXPECT_NE(body_of(h0), body_of(h2));
+
+    // handles are destroyed independently
+    ASSERT_EQ(status::ok, db_->destroy_statement(h0));
+    ASSERT_EQ(status::ok, db_->destroy_statement(h1));
+    ASSERT_EQ(status::ok, db_->destroy_statement(h2));
+}
+
+}  // namespace jogasaki::testing
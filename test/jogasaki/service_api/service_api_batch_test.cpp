@@ -0,0 +1,163 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <any>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <tateyama/api/server/mock/request_response.h>
+
+#include <jogasaki/api/impl/service.h>
+#include <jogasaki/mock/basic_record.h>
+#include <jogasaki/request_statistics.h>
+#include <jogasaki/utils/command_utils.h>
+#include "jogasaki/proto/sql/request.pb.h"
+#include "jogasaki/proto/sql/response.pb.h"
+
+#include "../api/api_test_base.h"
+#include "service_api_common.h"
+
+namespace jogasaki::api {
+
+using namespace std::literals::string_literals;
+using namespace jogasaki::utils;
+namespace sql = jogasaki::proto::sql;
+using ValueCase = sql::request::Parameter::ValueCase;
+using kind = meta::field_type_kind;
+
+std::string serialize(sql::request::Request& r);
+void deserialize(std::string_view s, sql::response::Response& res);
+
+TEST_F(service_api_test, batch_insert) {
+    execute_statement("create table T0 (C0 bigint primary key, C1 double)");
+    std::uint64_t stmt_handle{};
+    test_prepare(
+        stmt_handle,
+        "insert into T0(C0, C1) values (:c0, :c1)",
+        std::pair{"c0"s, sql::common::AtomType::INT8},
+        std::pair{"c1"s, sql::common::AtomType::FLOAT8}
+    );
+    std::vector<std::vector<parameter>> parameter_sets{};
+    for(std::int64_t i = 0; i < 3; ++i) {
+        parameter_sets.emplace_back(std::vector<parameter>{
+            {"c0"s, ValueCase::kInt8Value, std::any{std::in_place_type<std::int64_t>, i}},
+            {"c1"s, ValueCase::kFloat8Value, std::any{std::in_place_type<double>, i * 10.0}},
+        });
+    }
+    api::transaction_handle tx_handle{};
+    test_begin(tx_handle);
+    {
+        auto s = encode_batch(tx_handle, stmt_handle, parameter_sets);
+        auto req = std::make_shared<tateyama::api::server::mock::test_request>(s, session_id_);
+        auto res = std::make_shared<tateyama::api::server::mock::test_response>();
+
+        auto st = (*service_)(req, res);
+        EXPECT_TRUE(res->wait_completion());
+        EXPECT_TRUE(res->completed());
+        ASSERT_TRUE(st);
+
+        auto [success, error, stats, entries] = decode_batch_result(res->body_);
+        ASSERT_TRUE(success);
+        EXPECT_EQ(3, stats->counter(counter_kind::inserted).count());
+        ASSERT_EQ(3, entries.size());
+        for(auto&& e : entries) {
+            EXPECT_EQ(1, e->counter(counter_kind::inserted).count());
+        }
+    }
+    test_commit(tx_handle);
+    std::vector<mock::basic_record> result{};
+    execute_query("SELECT * FROM T0 ORDER BY C0", result);
+    ASSERT_EQ(3, result.size());
+    EXPECT_EQ((mock::create_nullable_record<kind::int8, kind::float8>(0, 0.0)), result[0]);
+    EXPECT_EQ((mock::create_nullable_record<kind::int8, kind::float8>(1, 10.0)), result[1]);
+    EXPECT_EQ((mock::create_nullable_record<kind::int8, kind::float8>(2, 20.0)), result[2]);
+}
+
+TEST_F(service_api_test, batch_update_in_order) {
+    // statements other than insert are executed in the order of parameter sets
+    execute_statement("create table T0 (C0 bigint primary key, C1 double)");
+    execute_statement("insert into T0(C0, C1) values (0, 0.0)");
+    std::uint64_t stmt_handle{};
+    test_prepare(
+        stmt_handle,
+        "update T0 set C1 = C1 * 10 + :c1 where C0 = :c0",
+        std::pair{"c0"s, sql::common::AtomType::INT8},
+        std::pair{"c1"s, sql::common::AtomType::FLOAT8}
+    );
+    std::vector<std::vector<parameter>> parameter_sets{};
+    for(double c1 : {1.0, 2.0, 3.0}) {
+        parameter_sets.emplace_back(std::vector<parameter>{
+            {"c0"s, ValueCase::kInt8Value, std::any{std::in_place_type<std::int64_t>, 0}},
+            {"c1"s, ValueCase::kFloat8Value, std::any{std::in_place_type<double>, c1}},
+        });
+    }
+    api::transaction_handle tx_handle{};
+    test_begin(tx_handle);
+    {
+        auto s = encode_batch(tx_handle, stmt_handle, parameter_sets);
+        auto req = std::make_shared<tateyama::api::server::mock::test_request>(s, session_id_);
+        auto res = std::make_shared<tateyama::api::server::mock::test_response>();
+
+        auto st = (*service_)(req, res);
+        EXPECT_TRUE(res->wait_completion());
+        EXPECT_TRUE(res->completed());
+        ASSERT_TRUE(st);
+
+        auto [success, error, stats, entries] = decode_batch_result(res->body_);
+        ASSERT_TRUE(success);
+        EXPECT_EQ(3, stats->counter(counter_kind::updated).count());
+        ASSERT_EQ(3, entries.size());
+    }
+    test_commit(tx_handle);
+    std::vector<mock::basic_record> result{};
+    execute_query("SELECT * FROM T0", result);
+    ASSERT_EQ(1, result.size());
+    EXPECT_EQ((mock::create_nullable_record<kind::int8, kind::float8>(0, 123.0)), result[0]);
+}
+
+TEST_F(service_api_test, batch_query_unsupported) {
+    execute_statement("create table T0 (C0 bigint primary key, C1 double)");
+    std::uint64_t stmt_handle{};
+    test_prepare(
+        stmt_handle,
+        "select * from T0 where C0 = :c0",
+        std::pair{"c0"s, sql::common::AtomType::INT8}
+    );
+    std::vector<std::vector<parameter>> parameter_sets{
+        {{"c0"s, ValueCase::kInt8Value, std::any{std::in_place_type<std::int64_t>, 0}}},
+    };
+    api::transaction_handle tx_handle{};
+    test_begin(tx_handle);
+    {
+        auto s = encode_batch(tx_handle, stmt_handle, parameter_sets);
+        auto req = std::make_shared<tateyama::api::server::mock::test_request>(s, session_id_);
+        auto res = std::make_shared<tateyama::api::server::mock::test_response>();
+
+        auto st = (*service_)(req, res);
+        EXPECT_TRUE(res->wait_completion());
+        EXPECT_TRUE(res->completed());
+        ASSERT_TRUE(st);
+
+        auto [success, error, stats, entries] = decode_batch_result(res->body_);
+        ASSERT_FALSE(success);
+        EXPECT_EQ(error_code::unsupported_runtime_feature_exception, error.code_);
+    }
+    test_rollback(tx_handle);
+}
+
+}  // namespace jogasaki::api
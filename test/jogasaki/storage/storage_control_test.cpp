@@ -13,7 +13,9 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <atomic>
 #include <string>
+#include <thread>
 #include <vector>
 #include <gtest/gtest.h>
 
@@ -117,6 +119,101 @@ TEST_F(storage_control_test, storage_control_mixed) {
     EXPECT_TRUE(ctrl.can_lock());
 }
 
+TEST_F(storage_control_test, storage_control_shared_on_slots) {
+    // shared locks are counted on different reader slots and released with the slot used to acquire
+    impl::storage_control ctrl{};
+    EXPECT_TRUE(ctrl.lock_shared(0));
+    EXPECT_TRUE(ctrl.lock_shared(5));
+    EXPECT_TRUE(ctrl.lock_shared(5));
+    EXPECT_TRUE(! ctrl.can_lock());
+    EXPECT_TRUE(! ctrl.lock());
+    ASSERT_THROW(ctrl.release_shared(1), std::logic_error);
+    ctrl.release_shared(0);
+    ctrl.release_shared(5);
+    EXPECT_TRUE(! ctrl.lock());
+    ctrl.release_shared(5);
+    EXPECT_TRUE(ctrl.can_lock());
+    EXPECT_TRUE(ctrl.lock());
+    EXPECT_TRUE(! ctrl.lock_shared(0));
+    EXPECT_TRUE(! ctrl.lock_shared(5));
+    ctrl.release();
+    EXPECT_TRUE(ctrl.can_lock());
+}
+
+TEST_F(storage_control_test, storage_control_concurrent_shared) {
+    // readers on many threads and a writer never hold the lock at the same time
+    impl::storage_control ctrl{};
+    std::atomic_bool stop{false};
+    std::atomic_size_t readers{};
+    std::atomic_bool violated{false};
+    std::vector<std::thread> threads{};
+    for(std::size_t i = 0; i < 8; ++i) {
+        threads.emplace_back([&]() {
+            while(! stop.load()) {
+                if(ctrl.lock_shared()) {
+                    ++readers;
+                    --readers;
+                    ctrl.release_shared();
+                }
+            }
+        });
+    }
+    for(std::size_t i = 0; i < 10000; ++i) {
+        if(ctrl.lock()) {
+            if(readers.load() != 0) {
+                violated = true;
+            }
+            ctrl.release();
+        }
+    }
+    stop = true;
+    for(auto&& t : threads) {
+        t.join();
+    }
+    EXPECT_TRUE(! violated.load());
+    EXPECT_TRUE(ctrl.lock());
+    ctrl.release();
+}
+
+TEST_F(storage_control_test, failing_writer_does_not_fail_readers) {
+    // a reader keeps holding the lock so that every writer attempt fails, and other readers must always succeed
+    impl::storage_control ctrl{};
+    ASSERT_TRUE(ctrl.lock_shared());
+    std::atomic_bool stop{false};
+    std::atomic_size_t failed{};
+    std::atomic_size_t succeeded{};
+    std::vector<std::thread> threads{};
+    for(std::size_t i = 0; i < 8; ++i) {
+        threads.emplace_back([&]() {
+            while(! stop.load()) {
+                if(! ctrl.lock_shared()) {
+                    ++failed;
+                    continue;
+                }
+                ++succeeded;
+                ctrl.release_shared();
+            }
+        });
+    }
+    std::size_t writer_succeeded = 0;
+    for(std::size_t i = 0; i < 10000; ++i) {
+        if(ctrl.lock()) {
+            ++writer_succeeded;
+            ctrl.release();
+        }
+    }
+    stop = true;
+    for(auto&& t : threads) {
+        t.join();
+    }
+    EXPECT_EQ(0, writer_succeeded);
+    EXPECT_EQ(0, failed.load());
+    EXPECT_LT(0, succeeded.load());
+    ctrl.release_shared();
+    EXPECT_TRUE(ctrl.lock());
+    ctrl.release();
+}
+
 TEST_F(storage_control_test, ref_transaction_count_init) {
     // ref_transaction_count starts at 0
     impl::storage_control ctrl{};
@@ -46,13 +46,16 @@ namespace jogasaki::testing {
 class custom_any_sequence_stream : public data::any_sequence_stream {
 public:
     using handler_type = std::function<status_type(data::any_sequence&)>;
+    using ready_handler_type = std::function<bool()>;
 
     /**
      * @brief constructs the stream with a custom try_next handler.
      * @param handler called on every try_next invocation.
+     * @param ready_handler called on every ready invocation. If empty, ready() always returns true.
      */
-    explicit custom_any_sequence_stream(handler_type handler) :
-        handler_(std::move(handler))
+    explicit custom_any_sequence_stream(handler_type handler, ready_handler_type ready_handler = {}) :
+        handler_(std::move(handler)),
+        ready_handler_(std::move(ready_handler))
     {}
 
     [[nodiscard]] status_type try_next(data::any_sequence& sequence) override {
@@ -65,10 +68,15 @@ public:
         return try_next(sequence);
     }
 
+    [[nodiscard]] bool ready() override {
+        return ready_handler_ ? ready_handler_() : true;
+    }
+
     void close() override {}
 
 private:
     handler_type handler_{};
+    ready_handler_type ready_handler_{};
 };
 
 }  // namespace jogasaki::testing
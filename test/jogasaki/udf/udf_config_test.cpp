@@ -0,0 +1,94 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <jogasaki/test_utils/temporary_folder.h>
+#include <jogasaki/udf/enum_types.h>
+#include <jogasaki/udf/error_info.h>
+#include <jogasaki/udf/udf_config.h>
+#include <jogasaki/udf/udf_loader.h>
+
+namespace plugin::udf {
+
+class udf_config_test : public ::testing::Test {
+public:
+    void SetUp() override {
+        temporary_.prepare();
+    }
+    void TearDown() override {
+        temporary_.clean();
+    }
+
+    std::optional<udf_config> parse(std::string_view content, std::vector<load_result>& results) {
+        std::filesystem::path path{temporary_.path()};
+        path /= "plugin.ini";
+        {
+            std::ofstream ofs{path};
+            ofs << content;
+        }
+        return udf_loader::parse_ini(path, results);
+    }
+
+    jogasaki::test::temporary_folder temporary_{};  //NOLINT
+};
+
+TEST_F(udf_config_test, memoize_default) {
+    std::vector<load_result> results{};
+    auto cfg = parse("[udf]\nenabled=true\n", results);
+    ASSERT_TRUE(cfg);
+    EXPECT_TRUE(results.empty());
+    EXPECT_TRUE(cfg->memoized_functions().empty());
+    EXPECT_FALSE(cfg->memoized("foo"));
+    EXPECT_EQ(udf_config::default_memoize_cache_size, cfg->memoize_cache_size());
+}
+
+TEST_F(udf_config_test, memoize_functions) {
+    // names are trimmed and lower-cased, and empty names are ignored
+    std::vector<load_result> results{};
+    auto cfg = parse("[udf]\nenabled=true\nmemoize= Foo ,bar,, BAZ\nmemoize_cache_size=16\n", results);
+    ASSERT_TRUE(cfg);
+    EXPECT_TRUE(results.empty());
+    EXPECT_EQ((std::vector<std::string>{"foo", "bar", "baz"}), cfg->memoized_functions());
+    EXPECT_TRUE(cfg->memoized("foo"));
+    EXPECT_TRUE(cfg->memoized("baz"));
+    EXPECT_FALSE(cfg->memoized("Foo"));
+    EXPECT_FALSE(cfg->memoized("qux"));
+    EXPECT_EQ(16, cfg->memoize_cache_size());
+}
+
+TEST_F(udf_config_test, memoize_cache_size_zero) {
+    std::vector<load_result> results{};
+    auto cfg = parse("[udf]\nenabled=true\nmemoize=foo\nmemoize_cache_size=0\n", results);
+    ASSERT_TRUE(cfg);
+    EXPECT_TRUE(cfg->memoized("foo"));
+    EXPECT_EQ(0, cfg->memoize_cache_size());
+}
+
+TEST_F(udf_config_test, missing_enabled) {
+    std::vector<load_result> results{};
+    auto cfg = parse("[udf]\nmemoize=foo\n", results);
+    EXPECT_FALSE(cfg);
+    ASSERT_EQ(1, results.size());
+    EXPECT_EQ(load_status::ini_invalid, results[0].status());
+}
+
+}  // namespace plugin::udf
@@ -0,0 +1,128 @@
+/*
+ * Copyright 2018-2026 Project Tsurugi.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <gtest/gtest.h>
+
+#include <jogasaki/udf/generic_record_impl.h>
+#include <jogasaki/udf/udf_result_cache.h>
+
+namespace plugin::udf {
+
+class udf_result_cache_test : public ::testing::Test {};
+
+std::shared_ptr<generic_record_impl const> response(std::int32_t v) {
+    auto ret = std::make_shared<generic_record_impl>();
+    ret->add_int4(v);
+    return ret;
+}
+
+template <class F>
+std::string key_of(F&& add) {
+    generic_record_impl rec{};
+    add(rec);
+    std::string ret{};
+    rec.serialize_values(ret);
+    return ret;
+}
+
+TEST_F(udf_result_cache_test, hit_and_miss) {
+    udf_result_cache cache{"f", 10};
+    EXPECT_FALSE(cache.find("a"));
+    EXPECT_EQ(0, cache.hits());
+    EXPECT_EQ(1, cache.misses());
+
+    auto r = response(1);
+    cache.put("a", r);
+    EXPECT_EQ(r, cache.find("a"));
+    EXPECT_EQ(1, cache.hits());
+    EXPECT_EQ(1, cache.misses());
+    EXPECT_FALSE(cache.find("b"));
+    EXPECT_EQ(1, cache.hits());
+    EXPECT_EQ(2, cache.misses());
+    EXPECT_EQ(1, cache.size());
+}
+
+TEST_F(udf_result_cache_test, put_same_key_replaces) {
+    udf_result_cache cache{"f", 10};
+    cache.put("a", response(1));
+    auto r = response(2);
+    cache.put("a", r);
+    EXPECT_EQ(1, cache.size());
+    EXPECT_EQ(r, cache.find("a"));
+}
+
+TEST_F(udf_result_cache_test, evict_least_recently_used) {
+    udf_result_cache cache{"f", 2};
+    cache.put("a", response(1));
+    cache.put("b", response(2));
+    // touching "a" makes "b" the least recently used
+    EXPECT_TRUE(cache.find("a"));
+    cache.put("c", response(3));
+    EXPECT_EQ(2, cache.size());
+    EXPECT_FALSE(cache.find("b"));
+    EXPECT_TRUE(cache.find("a"));
+    EXPECT_TRUE(cache.find("c"));
+}
+
+TEST_F(udf_result_cache_test, zero_capacity) {
+    udf_result_cache cache{"f", 0};
+    cache.put("a", response(1));
+    EXPECT_EQ(0, cache.size());
+    EXPECT_FALSE(cache.find("a"));
+    EXPECT_EQ(1, cache.misses());
+}
+
+TEST_F(udf_result_cache_test, key_same_values) {
+    auto k0 = key_of([](auto& r) { r.add_int4(1); r.add_string("abc"); });
+    auto k1 = key_of([](auto& r) { r.add_int4(1); r.add_string("abc"); });
+    EXPECT_EQ(k0, k1);
+}
+
+TEST_F(udf_result_cache_test, key_different_types) {
+    // same numeric value with different types must not share the cache entry
+    auto i4 = key_of([](auto& r) { r.add_int4(1); });
+    auto i8 = key_of([](auto& r) { r.add_int8(1); });
+    auto u4 = key_of([](auto& r) { r.add_uint4(1); });
+    auto f8 = key_of([](auto& r) { r.add_double(1.0); });
+    EXPECT_NE(i4, i8);
+    EXPECT_NE(i4, u4);
+    EXPECT_NE(i8, f8);
+}
+
+TEST_F(udf_result_cache_test, key_nulls) {
+    auto null = key_of([](auto& r) { r.add_int4_null(); });
+    auto zero = key_of([](auto& r) { r.add_int4(0); });
+    EXPECT_NE(null, zero);
+
+    auto null_first = key_of([](auto& r) { r.add_int4_null(); r.add_int4(1); });
+    auto null_second = key_of([](auto& r) { r.add_int4(1); r.add_int4_null(); });
+    EXPECT_NE(null_first, null_second);
+
+    auto empty = key_of([](auto& r) { r.add_string(""); });
+    auto null_string = key_of([](auto& r) { r.add_string_null(); });
+    EXPECT_NE(empty, null_string);
+}
+
+TEST_F(udf_result_cache_test, key_string_boundaries) {
+    // the length prefix keeps the boundary between adjacent strings
+    auto k0 = key_of([](auto& r) { r.add_string("ab"); r.add_string("c"); });
+    auto k1 = key_of([](auto& r) { r.add_string("a"); r.add_string("bc"); });
+    EXPECT_NE(k0, k1);
+}
+
+}  // namespace plugin::udf